@@ -399,6 +399,18 @@ STDMETHODIMP MyCOM::get_ShortTermLUFS(double* value) const {
 	return S_OK;
 }
 
+STDMETHODIMP MyCOM::get_IntegratedLUFS(double* value) const {
+	if (!value) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::get_IntegratedLUFS", L"Invalid pointer", false);
+	}
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::get_IntegratedLUFS", L"AudioWizard::Main not available", false);
+	}
+
+	AudioWizard::Main()->GetIntegratedLUFS(value);
+	return S_OK;
+}
+
 STDMETHODIMP MyCOM::get_RMS(double* value) const {
 	if (!value) {
 		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::get_RMS", L"Invalid pointer", false);
@@ -554,6 +566,18 @@ STDMETHODIMP MyCOM::get_StereoWidth(double* value) const {
 	AudioWizard::Main()->GetStereoWidth(value);
 	return S_OK;
 }
+
+STDMETHODIMP MyCOM::get_RealTimeQualityTier(LONG* value) const {
+	if (!value) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::get_RealTimeQualityTier", L"Invalid pointer", false);
+	}
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::get_RealTimeQualityTier", L"AudioWizard::Main not available", false);
+	}
+
+	*value = static_cast<LONG>(AudioWizard::Main()->GetRealTimeQualityTier());
+	return S_OK;
+}
 #pragma endregion
 
 
@@ -690,6 +714,47 @@ STDMETHODIMP MyCOM::SetFullTrackWaveformCallback(const VARIANT* callback) {
 	AudioWizard::Main()->SetFullTrackWaveformCallback(callback);
 	return S_OK;
 }
+
+STDMETHODIMP MyCOM::SetWaveformProgressCallback(const VARIANT* callback) {
+	if (!callback) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::SetWaveformProgressCallback", L"Invalid callback pointer", true);
+	}
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::SetWaveformProgressCallback", L"AudioWizard::Main not available", true);
+	}
+
+	AudioWizard::Main()->SetWaveformProgressCallback(callback);
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::SetFullTrackCombinedCallback(const VARIANT* callback) {
+	if (!callback) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::SetFullTrackCombinedCallback", L"Invalid callback pointer", true);
+	}
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::SetFullTrackCombinedCallback", L"AudioWizard::Main not available", true);
+	}
+
+	AudioWizard::Main()->SetFullTrackCombinedCallback(callback);
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::SetFullTrackResultCallback(const VARIANT* callback, VARIANT* releaseResults) {
+	if (!callback) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::SetFullTrackResultCallback", L"Invalid callback pointer", true);
+	}
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::SetFullTrackResultCallback", L"AudioWizard::Main not available", true);
+	}
+
+	bool bReleaseResults = false;
+	if (releaseResults && releaseResults->vt == VT_BOOL) {
+		bReleaseResults = (releaseResults->boolVal == VARIANT_TRUE);
+	}
+
+	AudioWizard::Main()->SetFullTrackResultCallback(callback, bReleaseResults);
+	return S_OK;
+}
 #pragma endregion
 
 
@@ -698,8 +763,17 @@ STDMETHODIMP MyCOM::SetFullTrackWaveformCallback(const VARIANT* callback) {
 /////////////////////////////////////////////////
 #pragma region MyCOM - Public API - Full-Track Methods
 STDMETHODIMP MyCOM::StartWaveformAnalysis(VARIANT metadata, LONG pointsPerSec, VARIANT* downmixToMono) const {
+	LONG jobId = 0;
+	return QueueWaveformAnalysis(metadata, pointsPerSec, downmixToMono, nullptr, nullptr, &jobId);
+}
+
+STDMETHODIMP MyCOM::QueueWaveformAnalysis(VARIANT metadata, LONG pointsPerSec, VARIANT* downmixToMono, VARIANT* compactBits,
+	VARIANT* priority, LONG* jobId) const {
+	if (!jobId) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::QueueWaveformAnalysis", L"Invalid pointer", true);
+	}
 	if (!AudioWizard::Waveform()) {
-		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::StartWaveformAnalysis", L"AudioWizard::Waveform not available", true);
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::QueueWaveformAnalysis", L"AudioWizard::Waveform not available", true);
 	}
 
 	bool bDownmixToMono = false;
@@ -707,6 +781,19 @@ STDMETHODIMP MyCOM::StartWaveformAnalysis(VARIANT metadata, LONG pointsPerSec, V
 		bDownmixToMono = (downmixToMono->boolVal == VARIANT_TRUE);
 	}
 
+	LONG bits = 0;
+	if (FAILED(AWHCOM::GetOptionalLong(compactBits, bits)) || (bits != 0 && bits != 8 && bits != 16)) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::QueueWaveformAnalysis", L"Invalid compact bits, must be 0, 8 or 16", true);
+	}
+	const auto encoding = bits == 8 ? AudioWizardWaveform::WaveformEncoding::Int8 :
+		bits == 16 ? AudioWizardWaveform::WaveformEncoding::Int16 : AudioWizardWaveform::WaveformEncoding::Float64;
+
+	LONG jobPriority = 0;
+	if (FAILED(AWHCOM::GetOptionalLong(priority, jobPriority, AudioWizardJobs::Config::DEF_PRIORITY)) ||
+		jobPriority < AudioWizardJobs::Config::MIN_PRIORITY || jobPriority > AudioWizardJobs::Config::MAX_PRIORITY) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::QueueWaveformAnalysis", L"Invalid priority, must be between 0 and 100", true);
+	}
+
 	auto resolution = static_cast<int>(pointsPerSec);
 	metadb_handle_list metadb = AWHCOM::GetMetadbHandlesFromStringArray(metadata);
 
@@ -716,7 +803,9 @@ STDMETHODIMP MyCOM::StartWaveformAnalysis(VARIANT metadata, LONG pointsPerSec, V
 		playlistManager->playlist_get_selected_items(playlistIndex, metadb);
 	}
 
-	AudioWizard::Waveform()->StartWaveformAnalysis(metadb, resolution, bDownmixToMono);
+	*jobId = static_cast<LONG>(AudioWizard::Waveform()->StartWaveformAnalysis(metadb, resolution, bDownmixToMono, encoding,
+		static_cast<int>(jobPriority)
+	));
 	return S_OK;
 }
 
@@ -730,19 +819,74 @@ STDMETHODIMP MyCOM::StopWaveformAnalysis() const {
 	return S_OK;
 }
 
+STDMETHODIMP MyCOM::StartFullTrackCombinedAnalysis(VARIANT metadata, LONG chunkDurationMs, LONG pointsPerSec, VARIANT* downmixToMono, VARIANT* compactBits,
+	VARIANT* priority, LONG* jobId) const {
+	if (!jobId) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::StartFullTrackCombinedAnalysis", L"Invalid pointer", true);
+	}
+	if (!AudioWizard::Main() || !AudioWizard::Waveform()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::StartFullTrackCombinedAnalysis", L"AudioWizard::Main or AudioWizard::Waveform not available", true);
+	}
+
+	bool bDownmixToMono = false;
+	if (downmixToMono && downmixToMono->vt == VT_BOOL) {
+		bDownmixToMono = (downmixToMono->boolVal == VARIANT_TRUE);
+	}
+
+	LONG bits = 0;
+	if (FAILED(AWHCOM::GetOptionalLong(compactBits, bits)) || (bits != 0 && bits != 8 && bits != 16)) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::StartFullTrackCombinedAnalysis", L"Invalid compact bits, must be 0, 8 or 16", true);
+	}
+	const auto encoding = bits == 8 ? AudioWizardWaveform::WaveformEncoding::Int8 :
+		bits == 16 ? AudioWizardWaveform::WaveformEncoding::Int16 : AudioWizardWaveform::WaveformEncoding::Float64;
+
+	LONG jobPriority = 0;
+	if (FAILED(AWHCOM::GetOptionalLong(priority, jobPriority, AudioWizardJobs::Config::DEF_PRIORITY)) ||
+		jobPriority < AudioWizardJobs::Config::MIN_PRIORITY || jobPriority > AudioWizardJobs::Config::MAX_PRIORITY) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::StartFullTrackCombinedAnalysis", L"Invalid priority, must be between 0 and 100", true);
+	}
+
+	metadb_handle_list metadb = AWHCOM::GetMetadbHandlesFromStringArray(metadata);
+
+	if (metadb.get_count() == 0) {
+		static_api_ptr_t<playlist_manager> playlistManager;
+		const t_size playlistIndex = playlistManager->get_active_playlist();
+		playlistManager->playlist_get_selected_items(playlistIndex, metadb);
+	}
+
+	*jobId = static_cast<LONG>(AudioWizard::Waveform()->StartCombinedAnalysis(metadb, static_cast<int>(pointsPerSec), bDownmixToMono, encoding,
+		static_cast<int>(chunkDurationMs), static_cast<int>(jobPriority)
+	));
+	return S_OK;
+}
+
 STDMETHODIMP MyCOM::GetWaveformData(LONG trackIndex, VARIANT* data) const {
+	return GetWaveformDataRange(trackIndex, nullptr, nullptr, nullptr, data);
+}
+
+STDMETHODIMP MyCOM::GetWaveformDataRange(LONG trackIndex, VARIANT* startTime, VARIANT* endTime, VARIANT* pixelWidth, VARIANT* data) const {
 	if (!AudioWizard::Waveform()) {
-		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetWaveformData", L"AudioWizard::Waveform not available", true);
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetWaveformDataRange", L"AudioWizard::Waveform not available", true);
 	}
 	if (!data) {
-		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetWaveformData", L"Invalid pointer", true);
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetWaveformDataRange", L"Invalid pointer", true);
 	}
 	if (trackIndex < 0 || trackIndex >= static_cast<LONG>(AudioWizard::Waveform()->GetWaveformTrackCount())) {
-		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetWaveformData", L"Invalid track index", true);
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetWaveformDataRange", L"Invalid track index", true);
+	}
+
+	double startSec = 0.0;
+	double endSec = 0.0;
+	LONG width = 0;
+	if (FAILED(AWHCOM::GetOptionalDouble(startTime, startSec)) || FAILED(AWHCOM::GetOptionalDouble(endTime, endSec))) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetWaveformDataRange", L"Invalid time range, must be numbers in seconds", true);
+	}
+	if (FAILED(AWHCOM::GetOptionalLong(pixelWidth, width)) || width < 0) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetWaveformDataRange", L"Invalid pixel width, must be a non-negative integer", true);
 	}
 
 	SAFEARRAY* outerArray = nullptr;
-	AudioWizard::Waveform()->GetWaveformData(static_cast<size_t>(trackIndex), &outerArray);
+	AudioWizard::Waveform()->GetWaveformData(static_cast<size_t>(trackIndex), &outerArray, startSec, endSec, static_cast<size_t>(width));
 
 	VariantInit(data);
 	V_VT(data) = VT_ARRAY | VT_VARIANT;
@@ -751,6 +895,45 @@ STDMETHODIMP MyCOM::GetWaveformData(LONG trackIndex, VARIANT* data) const {
 	return S_OK;
 }
 
+STDMETHODIMP MyCOM::GetWaveformDataFlat(LONG trackIndex, VARIANT* startTime, VARIANT* endTime, VARIANT* pixelWidth, VARIANT* doublePrecision, VARIANT* data) const {
+	if (!AudioWizard::Waveform()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetWaveformDataFlat", L"AudioWizard::Waveform not available", true);
+	}
+	if (!data) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetWaveformDataFlat", L"Invalid pointer", true);
+	}
+	if (trackIndex < 0 || trackIndex >= static_cast<LONG>(AudioWizard::Waveform()->GetWaveformTrackCount())) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetWaveformDataFlat", L"Invalid track index", true);
+	}
+
+	double startSec = 0.0;
+	double endSec = 0.0;
+	LONG width = 0;
+	if (FAILED(AWHCOM::GetOptionalDouble(startTime, startSec)) || FAILED(AWHCOM::GetOptionalDouble(endTime, endSec))) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetWaveformDataFlat", L"Invalid time range, must be numbers in seconds", true);
+	}
+	if (FAILED(AWHCOM::GetOptionalLong(pixelWidth, width)) || width < 0) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetWaveformDataFlat", L"Invalid pixel width, must be a non-negative integer", true);
+	}
+
+	bool bDoublePrecision = false;
+	if (doublePrecision && doublePrecision->vt == VT_BOOL) {
+		bDoublePrecision = (doublePrecision->boolVal == VARIANT_TRUE);
+	}
+
+	SAFEARRAY* flatArray = nullptr;
+	AudioWizard::Waveform()->GetWaveformDataFlat(static_cast<size_t>(trackIndex), &flatArray, startSec, endSec, static_cast<size_t>(width), bDoublePrecision);
+	if (!flatArray) {
+		return AWHCOM::LogError(E_OUTOFMEMORY, L"Audio Wizard => MyCOM::GetWaveformDataFlat", L"Failed to create waveform array", true);
+	}
+
+	VariantInit(data);
+	V_VT(data) = VT_ARRAY | (bDoublePrecision ? VT_R8 : VT_R4);
+	V_ARRAY(data) = flatArray;
+
+	return S_OK;
+}
+
 STDMETHODIMP MyCOM::GetWaveformDataInfo(VARIANT* trackIndex, BSTR* infoJson) const {
 	if (!AudioWizard::Waveform()) {
 		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetWaveformDataInfo", L"AudioWizard::Waveform not available", true);
@@ -845,12 +1028,93 @@ STDMETHODIMP MyCOM::GetWaveformTrackPath(LONG trackIndex, BSTR* path) const {
 	return S_OK;
 }
 
+STDMETHODIMP MyCOM::SetWaveformCache(VARIANT_BOOL enabled, VARIANT* maxSizeMB) const {
+	if (!AudioWizard::Waveform()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::SetWaveformCache", L"AudioWizard::Waveform not available", true);
+	}
+
+	LONG limitMB = 0;
+	if (FAILED(AWHCOM::GetOptionalLong(maxSizeMB, limitMB)) || limitMB < 0) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::SetWaveformCache", L"Invalid cache size, must be a positive number of MB", true);
+	}
+
+	AudioWizard::Waveform()->SetWaveformCache(enabled == VARIANT_TRUE,
+		limitMB > 0 ? limitMB : AudioWizardWaveform::Config::DEF_CACHE_LIMIT_MB
+	);
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::ClearWaveformCache() const {
+	if (!AudioWizard::Waveform()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::ClearWaveformCache", L"AudioWizard::Waveform not available", true);
+	}
+
+	AudioWizard::Waveform()->ClearWaveformCache();
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::GetWaveformStream(LONG trackIndex, LONG cursor, VARIANT* level, VARIANT* data) const {
+	if (!AudioWizard::Waveform()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetWaveformStream", L"AudioWizard::Waveform not available", true);
+	}
+	if (!data) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetWaveformStream", L"Invalid pointer", true);
+	}
+	if (trackIndex < 0 || trackIndex >= static_cast<LONG>(AudioWizard::Waveform()->GetWaveformTrackCount())) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetWaveformStream", L"Invalid track index", true);
+	}
+	if (cursor < 0) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetWaveformStream", L"Invalid cursor, must be a non-negative integer", true);
+	}
+
+	LONG streamLevel = 0;
+	if (FAILED(AWHCOM::GetOptionalLong(level, streamLevel)) || streamLevel < 0 ||
+		streamLevel > static_cast<LONG>(AudioWizardWaveform::Config::MAX_PYRAMID_LEVELS)) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetWaveformStream", L"Invalid level, must be between 0 and 20", true);
+	}
+
+	SAFEARRAY* outerArray = nullptr;
+	AudioWizard::Waveform()->GetWaveformStream(static_cast<size_t>(trackIndex), static_cast<size_t>(cursor),
+		static_cast<size_t>(streamLevel), &outerArray
+	);
+
+	VariantInit(data);
+	V_VT(data) = VT_ARRAY | VT_VARIANT;
+	V_ARRAY(data) = outerArray;
+
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::SetWaveformStreamInterval(LONG intervalMs) const {
+	if (!AudioWizard::Waveform()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::SetWaveformStreamInterval", L"AudioWizard::Waveform not available", true);
+	}
+
+	AudioWizard::Waveform()->SetWaveformStreamInterval(static_cast<int>(intervalMs));
+	return S_OK;
+}
+
 STDMETHODIMP MyCOM::StartFullTrackAnalysis(VARIANT metadata, LONG chunkDurationMs) const {
+	LONG jobId = 0;
+	return QueueFullTrackAnalysis(metadata, chunkDurationMs, nullptr, &jobId);
+}
+
+STDMETHODIMP MyCOM::QueueFullTrackAnalysis(VARIANT metadata, LONG chunkDurationMs, VARIANT* priority, LONG* jobId) const {
+	if (!jobId) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::QueueFullTrackAnalysis", L"Invalid pointer", true);
+	}
 	if (!AudioWizard::Main()) {
-		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::StartFullTrackAnalysis",
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::QueueFullTrackAnalysis",
 			L"AudioWizard::Main not available", true);
 	}
 
+	LONG jobPriority = 0;
+	if (FAILED(AWHCOM::GetOptionalLong(priority, jobPriority, AudioWizardJobs::Config::DEF_PRIORITY)) ||
+		jobPriority < AudioWizardJobs::Config::MIN_PRIORITY || jobPriority > AudioWizardJobs::Config::MAX_PRIORITY) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::QueueFullTrackAnalysis", L"Invalid priority, must be between 0 and 100", true);
+	}
+	*jobId = 0;
+
 	metadb_handle_list metadb = AWHCOM::GetMetadbHandlesFromStringArray(metadata);
 
 	// Explicit track lists from JavaScript cannot pass native metadb_handle_ptr across COM boundaries.
@@ -879,13 +1143,60 @@ STDMETHODIMP MyCOM::StartFullTrackAnalysis(VARIANT metadata, LONG chunkDurationM
 	}
 
 	if (metadb.get_count() == 0) {
-		FB2K_console_formatter() << "Audio Wizard => StartFullTrackAnalysis: No tracks provided or selected";
+		FB2K_console_formatter() << "Audio Wizard => QueueFullTrackAnalysis: No tracks provided or selected";
 		AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackAnalysisCallback, false);
 		return S_OK;
 	}
 
 	auto chunkDuration = static_cast<int>(chunkDurationMs);
-	AudioWizard::Main()->StartFullTrackAnalysis(metadb, chunkDuration);
+	*jobId = static_cast<LONG>(AudioWizard::Main()->StartFullTrackAnalysis(metadb, chunkDuration, static_cast<int>(jobPriority)));
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::CancelAnalysisJob(LONG jobId, VARIANT_BOOL* canceled) const {
+	if (!canceled) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::CancelAnalysisJob", L"Invalid pointer", true);
+	}
+	if (!AudioWizard::Jobs()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::CancelAnalysisJob", L"AudioWizard::Jobs not available", true);
+	}
+
+	const bool result = jobId > 0 && AudioWizard::Jobs()->CancelJob(static_cast<uint32_t>(jobId));
+	*canceled = result ? VARIANT_TRUE : VARIANT_FALSE;
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::GetAnalysisJobStatus(LONG jobId, BSTR* statusJson) const {
+	if (!statusJson) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetAnalysisJobStatus", L"Invalid pointer", true);
+	}
+	if (!AudioWizard::Jobs()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetAnalysisJobStatus", L"AudioWizard::Jobs not available", true);
+	}
+
+	std::string json;
+	AudioWizard::Jobs()->GetJobInfoJson(static_cast<uint32_t>(std::max<LONG>(jobId, 0)), json);
+	*statusJson = SysAllocString(pfc::stringcvt::string_wide_from_utf8(json.c_str()).get_ptr());
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::GetAnalysisMemoryReport(BSTR* reportJson) const {
+	if (!reportJson) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetAnalysisMemoryReport", L"Invalid pointer", true);
+	}
+	if (!AudioWizard::Jobs()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetAnalysisMemoryReport", L"AudioWizard::Jobs not available", true);
+	}
+
+	std::string json;
+	const AudioWizardJobs* jobs = AudioWizard::Jobs();
+	AWHPerf::MemoryAccounting::GetReportJson(json, jobs->GetRunningJobId(), [jobs](uint32_t jobId) { return jobs->GetJobStateName(jobId); });
+	*reportJson = SysAllocString(pfc::stringcvt::string_wide_from_utf8(json.c_str()).get_ptr());
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::ResetAnalysisMemoryPeaks() const {
+	AWHPerf::MemoryAccounting::ResetPeaks();
 	return S_OK;
 }
 
@@ -913,6 +1224,34 @@ STDMETHODIMP MyCOM::GetFullTrackMetrics(SAFEARRAY** metrics) const {
 	return S_OK;
 }
 
+STDMETHODIMP MyCOM::GetFullTrackMetricsBatch(VARIANT* trackIndices, VARIANT* metricMask, SAFEARRAY** metrics) const {
+	if (!metrics) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetFullTrackMetricsBatch", L"Invalid pointer", true);
+	}
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetFullTrackMetricsBatch", L"AudioWizard::Main not available", true);
+	}
+
+	std::vector<LONG> indices;
+	if (FAILED(AWHCOM::GetOptionalLongArray(trackIndices, indices))) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetFullTrackMetricsBatch", L"Invalid track indices, must be an array of integers", true);
+	}
+
+	LONG mask = 0;
+	if (FAILED(AWHCOM::GetOptionalLong(metricMask, mask)) || mask < 0 ||
+		static_cast<ULONG>(mask) > AudioWizardMainFullTrack::Config::FULL_METRICS_MASK_ALL) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetFullTrackMetricsBatch", L"Invalid metric mask, must be a bit mask of metricsPerTrack bits", true);
+	}
+
+	*metrics = nullptr;
+	AudioWizard::Main()->GetFullTrackMetricsBatch(indices, static_cast<ULONG>(mask), metrics);
+	if (!*metrics) {
+		return AWHCOM::LogError(E_OUTOFMEMORY, L"Audio Wizard => MyCOM::GetFullTrackMetricsBatch", L"Failed to create metrics array", true);
+	}
+
+	return S_OK;
+}
+
 STDMETHODIMP MyCOM::GetFullTrackMetricsDataInfo(BSTR* infoJson) const {
 	if (!AudioWizard::Main()) {
 		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetFullTrackMetricsDataInfo", L"AudioWizard::Main not available", true);
@@ -928,6 +1267,21 @@ STDMETHODIMP MyCOM::GetFullTrackMetricsDataInfo(BSTR* infoJson) const {
 	return S_OK;
 }
 
+STDMETHODIMP MyCOM::GetFullTrackStageTimings(BSTR* timingsJson) const {
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetFullTrackStageTimings", L"AudioWizard::Main not available", true);
+	}
+	if (!timingsJson) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetFullTrackStageTimings", L"Invalid pointer", true);
+	}
+
+	pfc::string8 json;
+	AudioWizard::Main()->GetFullTrackStageTimings(json);
+
+	*timingsJson = SysAllocString(pfc::stringcvt::string_wide_from_utf8(json).get_ptr());
+	return S_OK;
+}
+
 STDMETHODIMP MyCOM::GetMomentaryLUFSFull(VARIANT* trackIndex, double* value) const {
 	if (!value) {
 		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetMomentaryLUFSFull", L"Invalid pointer", true);
@@ -1250,6 +1604,43 @@ STDMETHODIMP MyCOM::StopRawAudioMonitoring() const {
 	return S_OK;
 }
 
+STDMETHODIMP MyCOM::StartSharedAudioRing(BSTR name, LONG refreshRateMs, LONG chunkDurationMs, VARIANT* capacityFrames, VARIANT_BOOL* success) const {
+	if (!success) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::StartSharedAudioRing", L"Invalid pointer", true);
+	}
+	*success = VARIANT_FALSE;
+
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::StartSharedAudioRing", L"AudioWizard::Main not available", true);
+	}
+	if (!name || SysStringLen(name) == 0) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::StartSharedAudioRing", L"Invalid ring name", true);
+	}
+
+	LONG frames = 0;
+	if (FAILED(AWHCOM::GetOptionalLong(capacityFrames, frames, AWHAudioBuffer::SharedAudioRing::DEF_CAPACITY_FRAMES)) || frames <= 0) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::StartSharedAudioRing", L"Invalid capacity, must be a positive frame count", true);
+	}
+
+	const std::string ringName = pfc::stringcvt::string_utf8_from_wide(name).get_ptr();
+	auto refreshRate = static_cast<int>(refreshRateMs);
+	auto chunkDuration = static_cast<int>(chunkDurationMs);
+
+	const bool started = AudioWizard::Main()->StartSharedAudioRing(ringName, static_cast<uint32_t>(frames), refreshRate, chunkDuration);
+	*success = started ? VARIANT_TRUE : VARIANT_FALSE;
+
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::StopSharedAudioRing() const {
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::StopSharedAudioRing", L"AudioWizard::Main not available", false);
+	}
+
+	AudioWizard::Main()->StopSharedAudioRing();
+	return S_OK;
+}
+
 STDMETHODIMP MyCOM::StartPeakmeterMonitoring(LONG refreshRateMs, LONG chunkDurationMs) const {
 	if (!AudioWizard::Main()) {
 		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::StartPeakmeterMonitoring", L"AudioWizard::Main not available", false);
@@ -1270,6 +1661,165 @@ STDMETHODIMP MyCOM::StopPeakmeterMonitoring() const {
 	AudioWizard::Main()->StopPeakmeterMonitoring();
 	return S_OK;
 }
+
+STDMETHODIMP MyCOM::GetRealTimeMetricsSnapshot(SAFEARRAY** metrics) const {
+	if (!metrics) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetRealTimeMetricsSnapshot", L"Invalid pointer", false);
+	}
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetRealTimeMetricsSnapshot", L"AudioWizard::Main not available", false);
+	}
+
+	AudioWizard::Main()->GetRealTimeMetricsSnapshot(metrics);
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::GetRealTimeMetricsDataInfo(BSTR* infoJson) const {
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetRealTimeMetricsDataInfo", L"AudioWizard::Main not available", false);
+	}
+	if (!infoJson) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetRealTimeMetricsDataInfo", L"Invalid pointer", false);
+	}
+
+	pfc::string8 json;
+	AudioWizard::Main()->GetRealTimeMetricsDataInfo(json);
+
+	*infoJson = SysAllocString(pfc::stringcvt::string_wide_from_utf8(json).get_ptr());
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::GetRealTimeStageTimings(BSTR* timingsJson) const {
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetRealTimeStageTimings", L"AudioWizard::Main not available", false);
+	}
+	if (!timingsJson) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetRealTimeStageTimings", L"Invalid pointer", false);
+	}
+
+	pfc::string8 json;
+	AudioWizard::Main()->GetRealTimeStageTimings(json);
+
+	*timingsJson = SysAllocString(pfc::stringcvt::string_wide_from_utf8(json).get_ptr());
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::GetRealTimeHistory(LONG since, LONG resolutionMs, VARIANT* history) const {
+	if (!history) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetRealTimeHistory", L"Invalid pointer", false);
+	}
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetRealTimeHistory", L"AudioWizard::Main not available", false);
+	}
+	if (!AudioWizardMainRealTime::IsValidHistoryResolution(static_cast<int>(resolutionMs))) {
+		return AWHCOM::LogError(E_INVALIDARG, L"Audio Wizard => MyCOM::GetRealTimeHistory", L"Invalid resolution, must be 100, 1000 or 10000 ms", false);
+	}
+
+	auto sinceSequence = static_cast<uint64_t>(std::max(since, 0L));
+
+	SAFEARRAY* historyArray = nullptr;
+	AudioWizard::Main()->GetRealTimeHistory(sinceSequence, static_cast<int>(resolutionMs), &historyArray);
+	if (!historyArray) {
+		return AWHCOM::LogError(E_OUTOFMEMORY, L"Audio Wizard => MyCOM::GetRealTimeHistory", L"Failed to create history array", false);
+	}
+
+	// Returned in a VARIANT, SAFEARRAY(double) return values are not supported by Spider Monkey Panel
+	VariantInit(history);
+	V_VT(history) = VT_ARRAY | VT_R8;
+	V_ARRAY(history) = historyArray;
+
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::StartSpectrumMonitoring(LONG bins, VARIANT_BOOL logBinning, double smoothing, double peakDecay) const {
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::StartSpectrumMonitoring", L"AudioWizard::Main not available", false);
+	}
+
+	AudioWizard::Main()->StartSpectrumMonitoring(static_cast<int>(bins), logBinning == VARIANT_TRUE, smoothing, peakDecay);
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::StopSpectrumMonitoring() const {
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::StopSpectrumMonitoring", L"AudioWizard::Main not available", false);
+	}
+
+	AudioWizard::Main()->StopSpectrumMonitoring();
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::GetSpectrumData(SAFEARRAY** data) const {
+	if (!data) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetSpectrumData", L"Invalid pointer", false);
+	}
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetSpectrumData", L"AudioWizard::Main not available", false);
+	}
+
+	AudioWizard::Main()->GetSpectrumData(data);
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::GetSpectrumDataInfo(BSTR* infoJson) const {
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetSpectrumDataInfo", L"AudioWizard::Main not available", false);
+	}
+	if (!infoJson) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetSpectrumDataInfo", L"Invalid pointer", false);
+	}
+
+	pfc::string8 json;
+	AudioWizard::Main()->GetSpectrumDataInfo(json);
+
+	*infoJson = SysAllocString(pfc::stringcvt::string_wide_from_utf8(json).get_ptr());
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::SetRealTimeCpuBudget(double percent) const {
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::SetRealTimeCpuBudget", L"AudioWizard::Main not available", false);
+	}
+
+	AudioWizard::Main()->SetRealTimeCpuBudget(percent);
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::GetChannelRMS(SAFEARRAY** data) const {
+	if (!data) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetChannelRMS", L"Invalid pointer", false);
+	}
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetChannelRMS", L"AudioWizard::Main not available", false);
+	}
+
+	AudioWizard::Main()->GetChannelRMS(data);
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::GetChannelSamplePeaks(SAFEARRAY** data) const {
+	if (!data) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetChannelSamplePeaks", L"Invalid pointer", false);
+	}
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetChannelSamplePeaks", L"AudioWizard::Main not available", false);
+	}
+
+	AudioWizard::Main()->GetChannelSamplePeaks(data);
+	return S_OK;
+}
+
+STDMETHODIMP MyCOM::GetChannelTruePeaks(SAFEARRAY** data) const {
+	if (!data) {
+		return AWHCOM::LogError(E_POINTER, L"Audio Wizard => MyCOM::GetChannelTruePeaks", L"Invalid pointer", false);
+	}
+	if (!AudioWizard::Main()) {
+		return AWHCOM::LogError(E_UNEXPECTED, L"Audio Wizard => MyCOM::GetChannelTruePeaks", L"AudioWizard::Main not available", false);
+	}
+
+	AudioWizard::Main()->GetChannelTruePeaks(data);
+	return S_OK;
+}
 #pragma endregion
 
 
@@ -126,6 +126,51 @@ public:
 	// * PUBLIC API - PATH METHODS * //
 	STDMETHOD(GetPhysicalFilePath)(BSTR virtualPath, BSTR* physicalPath) const;
 
+	// Declared in the same order as MyCOMAPI in MyCOM.idl, members added after the interface
+	// was published follow the original ones so the vtable layout stays compatible.
+
+	// * PUBLIC API - REAL-TIME METRIC PROPERTIES (ADDED) * //
+	STDMETHOD(get_IntegratedLUFS)(double* value) const;
+	STDMETHOD(get_RealTimeQualityTier)(LONG* value) const;
+
+	// * PUBLIC API - FULL-TRACK ANALYSIS CALLBACKS (ADDED) * //
+	STDMETHOD(SetWaveformProgressCallback)(const VARIANT* callback);
+	STDMETHOD(SetFullTrackCombinedCallback)(const VARIANT* callback);
+	STDMETHOD(SetFullTrackResultCallback)(const VARIANT* callback, VARIANT* releaseResults);
+
+	// * PUBLIC API - FULL-TRACK METHODS (ADDED) * //
+	STDMETHOD(QueueWaveformAnalysis)(VARIANT metadata, LONG pointsPerSec, VARIANT* downmixToMono, VARIANT* compactBits, VARIANT* priority, LONG* jobId) const;
+	STDMETHOD(StartFullTrackCombinedAnalysis)(VARIANT metadata, LONG chunkDurationMs, LONG pointsPerSec, VARIANT* downmixToMono, VARIANT* compactBits, VARIANT* priority, LONG* jobId) const;
+	STDMETHOD(QueueFullTrackAnalysis)(VARIANT metadata, LONG chunkDurationMs, VARIANT* priority, LONG* jobId) const;
+	STDMETHOD(GetWaveformDataRange)(LONG trackIndex, VARIANT* startTime, VARIANT* endTime, VARIANT* pixelWidth, VARIANT* data) const;
+	STDMETHOD(GetWaveformDataFlat)(LONG trackIndex, VARIANT* startTime, VARIANT* endTime, VARIANT* pixelWidth, VARIANT* doublePrecision, VARIANT* data) const;
+	STDMETHOD(SetWaveformCache)(VARIANT_BOOL enabled, VARIANT* maxSizeMB) const;
+	STDMETHOD(ClearWaveformCache)() const;
+	STDMETHOD(GetWaveformStream)(LONG trackIndex, LONG cursor, VARIANT* level, VARIANT* data) const;
+	STDMETHOD(SetWaveformStreamInterval)(LONG intervalMs) const;
+	STDMETHOD(CancelAnalysisJob)(LONG jobId, VARIANT_BOOL* canceled) const;
+	STDMETHOD(GetAnalysisJobStatus)(LONG jobId, BSTR* statusJson) const;
+	STDMETHOD(GetAnalysisMemoryReport)(BSTR* reportJson) const;
+	STDMETHOD(ResetAnalysisMemoryPeaks)() const;
+	STDMETHOD(GetFullTrackMetricsBatch)(VARIANT* trackIndices, VARIANT* metricMask, SAFEARRAY** metrics) const;
+	STDMETHOD(GetFullTrackStageTimings)(BSTR* timingsJson) const;
+
+	// * PUBLIC API - REAL-TIME METHODS (ADDED) * //
+	STDMETHOD(StartSharedAudioRing)(BSTR name, LONG refreshRateMs, LONG chunkDurationMs, VARIANT* capacityFrames, VARIANT_BOOL* success) const;
+	STDMETHOD(StopSharedAudioRing)() const;
+	STDMETHOD(GetRealTimeMetricsSnapshot)(SAFEARRAY** metrics) const;
+	STDMETHOD(GetRealTimeMetricsDataInfo)(BSTR* infoJson) const;
+	STDMETHOD(GetRealTimeStageTimings)(BSTR* timingsJson) const;
+	STDMETHOD(GetRealTimeHistory)(LONG since, LONG resolutionMs, VARIANT* history) const;
+	STDMETHOD(StartSpectrumMonitoring)(LONG bins, VARIANT_BOOL logBinning, double smoothing, double peakDecay) const;
+	STDMETHOD(StopSpectrumMonitoring)() const;
+	STDMETHOD(GetSpectrumData)(SAFEARRAY** data) const;
+	STDMETHOD(GetSpectrumDataInfo)(BSTR* infoJson) const;
+	STDMETHOD(SetRealTimeCpuBudget)(double percent) const;
+	STDMETHOD(GetChannelRMS)(SAFEARRAY** data) const;
+	STDMETHOD(GetChannelSamplePeaks)(SAFEARRAY** data) const;
+	STDMETHOD(GetChannelTruePeaks)(SAFEARRAY** data) const;
+
 private:
 	LONG refCount = 0;
 
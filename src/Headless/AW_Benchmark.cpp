@@ -0,0 +1,333 @@
+/////////////////////////////////////////////////////////////////////////////////
+// * FB2K Component: Audio Wizard                                            * //
+// * Description:    Audio Wizard Benchmark Source File                      * //
+// * Author:         TT                                                      * //
+// * Website:        https://github.com/The-Wizardium/Audio-Wizard           * //
+// * Version:        0.6.0                                                   * //
+// * Dev. started:   19-10-2026                                              * //
+// * Last change:    19-10-2026                                              * //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "AW_PCH.h"
+#include "AW.h"
+#include "AW_Benchmark.h"
+
+
+//////////////////////////////
+// * PUBLIC BENCHMARK API * //
+//////////////////////////////
+#pragma region Public Benchmark API
+uint32_t AudioWizardBenchmark::StartBenchmark(int durationSec, int priority) {
+	const int duration = std::clamp(durationSec, Config::MIN_DURATION_SEC, Config::MAX_DURATION_SEC);
+
+	return AudioWizard::Jobs()->SubmitJob(Config::JOB_BENCHMARK, priority, [duration](const JobContext& job) {
+		std::string json;
+		if (!RunBenchmark(duration, job, json)) return false;
+
+		job.SetResultJson(std::move(json));
+		return true;
+	});
+}
+
+bool AudioWizardBenchmark::RunBenchmark(int durationSec, const JobContext& job, std::string& json) {
+	struct Source {
+		std::string name;
+		std::vector<audioType> samples;
+		uint32_t sampleRate = 0;
+		uint32_t channels = 0;
+	};
+	std::vector<Source> sources;
+
+	for (uint32_t sampleRate : Config::SAMPLE_RATES) {
+		for (uint32_t channels : Config::CHANNEL_COUNTS) {
+			sources.push_back({ "synthetic", {}, sampleRate, channels });
+		}
+	}
+
+	std::vector<RunResult> results;
+	const double totalSteps = static_cast<double>(sources.size()) * 2.0;
+	double completedSteps = 0.0;
+
+	for (auto& source : sources) {
+		const auto frames = static_cast<size_t>(durationSec) * source.sampleRate;
+		GenerateSyntheticSignal(source.sampleRate, source.channels, frames, source.samples);
+
+		// One pass through the engine entry points, the per-stage split comes from the engines' own stage profile
+		for (const bool isFullTrack : { true, false }) {
+			RunResult result;
+			result.source = source.name;
+			const bool success = isFullTrack
+				? RunFullTrack(source.samples, source.sampleRate, source.channels, job, result)
+				: RunRealTime(source.samples, source.sampleRate, source.channels, job, result);
+
+			if (!success) return false;
+
+			results.push_back(std::move(result));
+			job.SetProgress(++completedSteps / totalSteps);
+		}
+
+		source.samples = {}; // Each source is only needed for its own runs
+	}
+
+	std::ostringstream oss;
+	oss << "{"
+		<< R"("componentVersion":")" << ::AW_COMPONENT_VERSION << "\","
+		<< "\"benchmarkDataVersion\":" << Config::BENCHMARK_DATA_VERSION
+		<< ",\"durationSec\":" << durationSec
+		<< ",\"stageTimingDataVersion\":" << AWHPerf::StageProfile::STAGE_TIMING_DATA_VERSION
+		<< ",\"stagesEnabled\":" << (AWHPerf::StageProfile::ENABLED ? "true" : "false")
+		<< ",\"stages\":[";
+
+	for (size_t i = 0; i < AWHPerf::StageProfile::STAGE_NAMES.size(); ++i) {
+		if (i > 0) oss << ",";
+		oss << "\"" << AWHPerf::StageProfile::STAGE_NAMES[i] << "\"";
+	}
+	oss << "]";
+
+	oss << ",\"runs\":[";
+	for (size_t i = 0; i < results.size(); ++i) {
+		if (i > 0) oss << ",";
+		WriteRunJson(oss, results[i]);
+
+		const double audioSeconds = static_cast<double>(results[i].frames) / results[i].sampleRate;
+		FB2K_console_formatter() << "Audio Wizard => Benchmark: " << results[i].engine.c_str() << " " << results[i].source.c_str()
+			<< ", " << results[i].sampleRate << " Hz, " << results[i].channels << " ch: "
+			<< AWHString::ToFixed(1, results[i].seconds > 0.0 ? audioSeconds / results[i].seconds : 0.0) << "x real-time";
+	}
+	oss << "]}";
+
+	json = oss.str();
+	return true;
+}
+
+void AudioWizardBenchmark::GenerateSyntheticSignal(uint32_t sampleRate, uint32_t channels, size_t frames, std::vector<audioType>& samples) {
+	// Deterministic program-like material: a low tone per channel, a shared 3.15 kHz partial and noise under a slow
+	// amplitude swell, so gating, loudness range, true peak and the dynamics stages all see varying input
+	samples.resize(frames * channels);
+
+	uint32_t noiseState = 0x9E3779B9u;
+	constexpr double PI = 3.14159265358979323846;
+	constexpr double twoPi = 2.0 * PI;
+
+	for (size_t frame = 0; frame < frames; ++frame) {
+		const double t = static_cast<double>(frame) / sampleRate;
+		const double envelope = 0.55 + 0.45 * std::sin(twoPi * 0.25 * t);
+		const double partial = 0.12 * std::sin(twoPi * 3150.0 * t);
+
+		for (uint32_t ch = 0; ch < channels; ++ch) {
+			noiseState = noiseState * 1664525u + 1013904223u;
+			const double noise = (static_cast<double>(noiseState >> 8) / 8388608.0 - 1.0) * 0.04;
+			const double tone = 0.3 * std::sin(twoPi * 110.0 * (ch + 1) * t + ch);
+
+			samples[frame * channels + ch] = static_cast<audioType>(envelope * (tone + partial + noise));
+		}
+	}
+}
+#pragma endregion
+
+
+////////////////////////////////
+// * PUBLIC MEMORY TEST API * //
+////////////////////////////////
+#pragma region Public Memory Test API
+uint32_t AudioWizardBenchmark::StartMemoryTest(int trackCount, int durationSec, int priority) {
+	const int tracks = std::clamp(trackCount, Config::MIN_MEMORY_TRACKS, Config::MAX_MEMORY_TRACKS);
+	const int duration = std::clamp(durationSec, Config::MIN_DURATION_SEC, Config::MAX_DURATION_SEC);
+
+	return AudioWizard::Jobs()->SubmitJob(Config::JOB_MEMORY, priority, [tracks, duration](const JobContext& job) {
+		std::string json;
+		if (!RunMemoryTest(tracks, duration, job, json)) return false;
+
+		job.SetResultJson(std::move(json));
+		return true;
+	});
+}
+
+bool AudioWizardBenchmark::RunMemoryTest(int trackCount, int durationSec, const JobContext& job, std::string& json) {
+	using AWHPerf::MemoryAccounting;
+
+	// A synthetic batch: every track keeps its analysis state until the batch ends, like a multi-track analysis,
+	// so the job's peak is what a batch of this size and track length costs. The shared source signal is not charged.
+	const uint32_t sampleRate = Config::MEMORY_SAMPLE_RATE;
+	const uint32_t channels = Config::MEMORY_CHANNELS;
+	const size_t totalFrames = static_cast<size_t>(durationSec) * sampleRate;
+	const size_t chunkFrames = static_cast<size_t>(sampleRate) * Config::FULL_TRACK_CHUNK_MS / 1000;
+
+	std::vector<audioType> samples;
+	GenerateSyntheticSignal(sampleRate, channels, totalFrames, samples);
+
+	std::vector<std::unique_ptr<FullTrackData>> batch;
+	batch.reserve(static_cast<size_t>(trackCount));
+
+	for (int track = 0; track < trackCount; ++track) {
+		auto& ftData = batch.emplace_back(std::make_unique<FullTrackData>());
+		AudioWizardAnalysisFullTrack::ProcessFullTrackMemory(*ftData);
+
+		for (size_t offset = 0; offset < totalFrames; offset += chunkFrames) {
+			if (job.IsCanceled()) return false;
+
+			ChunkData data;
+			data.data = samples.data() + offset * channels;
+			data.channels = channels;
+			data.frames = std::min(chunkFrames, totalFrames - offset);
+			data.sampleRate = sampleRate;
+			AudioWizardAnalysisFullTrack::ProcessFullTrackChunk(data, *ftData);
+		}
+
+		AudioWizardAnalysisFullTrack::ProcessOriginalBlocks(*ftData);
+		AudioWizardAnalysisFullTrack::ProcessDynamicsFactors(*ftData);
+		AudioWizardAnalysisFullTrack::ProcessFullTrackMemory(*ftData);
+		job.SetProgress(static_cast<double>(track + 1) / trackCount);
+	}
+
+	MemoryAccounting::Usage usage;
+	if (!MemoryAccounting::GetJobUsage(job.GetJobId(), usage)) return false;
+
+	const int64_t trackBytes = usage.peak[MemoryAccounting::CATEGORY_FULL_TRACK_BUFFERS] +
+		usage.peak[MemoryAccounting::CATEGORY_FULL_TRACK_BLOCKS];
+	const int64_t bytesPerTrack = trackBytes / trackCount;
+
+	std::ostringstream oss;
+	oss << "{"
+		<< R"("componentVersion":")" << ::AW_COMPONENT_VERSION << "\","
+		<< "\"memoryTestDataVersion\":" << Config::MEMORY_TEST_DATA_VERSION
+		<< ",\"memoryDataVersion\":" << MemoryAccounting::MEMORY_DATA_VERSION
+		<< ",\"trackCount\":" << trackCount
+		<< ",\"durationSec\":" << durationSec
+		<< ",\"sampleRate\":" << sampleRate
+		<< ",\"channels\":" << channels
+		<< ",\"peakBytes\":{";
+
+	for (size_t i = 0; i < MemoryAccounting::CATEGORY_COUNT; ++i) {
+		oss << (i ? "," : "") << "\"" << MemoryAccounting::CATEGORY_NAMES[i] << "\":" << std::max(int64_t{ 0 }, usage.peak[i]);
+	}
+
+	oss << "},\"peakTotalBytes\":" << std::max(int64_t{ 0 }, usage.peakTotal)
+		<< ",\"bytesPerTrack\":" << bytesPerTrack
+		<< ",\"bytesPerTrackSecond\":" << bytesPerTrack / durationSec << "}";
+
+	FB2K_console_formatter() << "Audio Wizard => Memory test: " << trackCount << " tracks of " << durationSec << "s, "
+		<< AWHString::ToFixed(2, static_cast<double>(usage.peakTotal) / (1024.0 * 1024.0)) << " MiB peak, "
+		<< AWHString::ToFixed(2, static_cast<double>(bytesPerTrack) / (1024.0 * 1024.0)) << " MiB per track";
+
+	json = oss.str();
+	return true;
+}
+#pragma endregion
+
+
+
+/////////////////////////////
+// * PRIVATE ENGINE RUNS * //
+/////////////////////////////
+#pragma region Private Engine Runs
+bool AudioWizardBenchmark::RunFullTrack(const std::vector<audioType>& samples, uint32_t sampleRate, uint32_t channels,
+	const JobContext& job, RunResult& result) {
+	auto ftData = std::make_unique<FullTrackData>();
+	const size_t totalFrames = samples.size() / channels;
+	const size_t chunkFrames = std::max<size_t>(1, static_cast<size_t>(sampleRate) * Config::FULL_TRACK_CHUNK_MS / 1000);
+
+	result.engine = "fullTrack";
+	result.sampleRate = sampleRate;
+	result.channels = channels;
+	result.chunkMs = Config::FULL_TRACK_CHUNK_MS;
+	result.frames = totalFrames;
+
+	const auto start = Clock::now();
+
+	for (size_t offset = 0; offset < totalFrames; offset += chunkFrames) {
+		if (job.IsCanceled()) return false;
+
+		ChunkData data;
+		data.data = samples.data() + offset * channels;
+		data.channels = channels;
+		data.frames = std::min(chunkFrames, totalFrames - offset);
+		data.sampleRate = sampleRate;
+		AudioWizardAnalysisFullTrack::ProcessFullTrackChunk(data, *ftData);
+	}
+
+	// Same finalization and stage laps as the decoder, results are computed but discarded
+	const auto finalizeStart = Clock::now();
+	FullTrackResults ftResults;
+	AW_STAGE_TIMER(timer, ftData->profile);
+	AudioWizardAnalysisFullTrack::ProcessOriginalBlocks(*ftData);
+	AW_STAGE_LAP(timer, STAGE_FINALIZE);
+	AudioWizardAnalysisFullTrack::ProcessDynamicsFactors(*ftData);
+	AW_STAGE_SKIP(timer);
+	AudioWizardAnalysisFullTrack::ProcessFullTrackResults(metadb_handle_ptr(), *ftData, ftResults);
+	AW_STAGE_LAP(timer, STAGE_FINALIZE);
+
+	result.finalizeSeconds = GetSecondsSince(finalizeStart);
+	result.seconds = GetSecondsSince(start);
+	result.profile = ftData->profile;
+	return true;
+}
+
+bool AudioWizardBenchmark::RunRealTime(const std::vector<audioType>& samples, uint32_t sampleRate, uint32_t channels,
+	const JobContext& job, RunResult& result) {
+	auto rtData = std::make_unique<RealTimeData>();
+	const size_t totalFrames = samples.size() / channels;
+	const size_t chunkFrames = std::max<size_t>(1, static_cast<size_t>(sampleRate) * Config::REAL_TIME_CHUNK_MS / 1000);
+
+	result.engine = "realTime";
+	result.sampleRate = sampleRate;
+	result.channels = channels;
+	result.chunkMs = Config::REAL_TIME_CHUNK_MS;
+	result.frames = totalFrames;
+
+	const auto start = Clock::now();
+
+	for (size_t offset = 0; offset < totalFrames; offset += chunkFrames) {
+		if (job.IsCanceled()) return false;
+
+		ChunkData data;
+		data.data = samples.data() + offset * channels;
+		data.channels = channels;
+		data.frames = std::min(chunkFrames, totalFrames - offset);
+		data.sampleRate = sampleRate;
+		AudioWizardAnalysisRealTime::ProcessRealtimeChunk(data, *rtData);
+	}
+
+	result.seconds = GetSecondsSince(start);
+	result.profile = rtData->profile;
+	return true;
+}
+
+#pragma endregion
+
+
+/////////////////////////
+// * PRIVATE HELPERS * //
+/////////////////////////
+#pragma region Private Helpers
+double AudioWizardBenchmark::GetSecondsSince(Clock::time_point start) {
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void AudioWizardBenchmark::WriteRunJson(std::ostringstream& oss, const RunResult& result) {
+	const bool isFullTrack = result.engine == "fullTrack";
+	const double audioSeconds = static_cast<double>(result.frames) / result.sampleRate;
+	const double seconds = std::max(result.seconds, 1e-9);
+
+	oss << "{\"engine\":\"" << result.engine << "\",\"source\":\"" << result.source << "\""
+		<< ",\"sampleRate\":" << result.sampleRate
+		<< ",\"channels\":" << result.channels
+		<< ",\"chunkMs\":" << result.chunkMs
+		<< ",\"frames\":" << result.frames
+		<< std::fixed << std::setprecision(6)
+		<< ",\"seconds\":" << result.seconds
+		<< std::setprecision(1)
+		<< ",\"samplesPerSec\":" << result.frames * result.channels / seconds
+		<< std::setprecision(2)
+		<< ",\"realTimeFactor\":" << audioSeconds / seconds;
+
+	if (isFullTrack) {
+		oss << std::setprecision(6) << ",\"finalizeSeconds\":" << result.finalizeSeconds;
+	}
+
+	// Same profile layout as GetFullTrackStageTimings, "ms" and "calls" follow the top-level "stages" names
+	oss << std::defaultfloat << std::setprecision(10) << ",\"profile\":{";
+	result.profile.WriteJsonFields(oss);
+	oss << "}}";
+}
+#pragma endregion
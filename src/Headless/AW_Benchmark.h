@@ -0,0 +1,87 @@
+/////////////////////////////////////////////////////////////////////////////////
+// * FB2K Component: Audio Wizard                                            * //
+// * Description:    Audio Wizard Benchmark Header File                      * //
+// * Author:         TT                                                      * //
+// * Website:        https://github.com/The-Wizardium/Audio-Wizard           * //
+// * Version:        0.6.0                                                   * //
+// * Dev. started:   19-10-2026                                              * //
+// * Last change:    19-10-2026                                              * //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+#include "AW_Analysis.h"
+#include "AW_Jobs.h"
+
+
+///////////////////
+// * BENCHMARK * //
+///////////////////
+#pragma region Benchmark
+// Throughput and memory runs of the analysis engines on synthetic audio. Headless only: built into aw_bench
+// and aw_tests against the SDK shim, never shipped in the component.
+class AudioWizardBenchmark {
+public:
+	// * TYPE ALIASES * //
+	using ChunkData = AWHAudioData::ChunkData;
+	using FullTrackData = AudioWizardAnalysisFullTrack::FullTrackData;
+	using FullTrackResults = AudioWizardAnalysisFullTrack::FullTrackResults;
+	using RealTimeData = AudioWizardAnalysisRealTime::RealTimeData;
+	using JobContext = AudioWizardJobs::JobContext;
+	using Clock = std::chrono::steady_clock;
+
+	// * CONFIG * //
+	struct Config {
+		static constexpr std::string_view JOB_BENCHMARK = "benchmark";
+		static constexpr int BENCHMARK_DATA_VERSION = 2; // NOTE: bump whenever the result JSON layout changes.
+		static constexpr int MIN_DURATION_SEC = 1;
+		static constexpr int DEF_DURATION_SEC = 5;
+		static constexpr int MAX_DURATION_SEC = 30;
+		static constexpr int FULL_TRACK_CHUNK_MS = 200; // Default full-track chunk duration
+		static constexpr int REAL_TIME_CHUNK_MS = 50;   // Default real-time chunk duration
+		static constexpr std::array<uint32_t, 3> SAMPLE_RATES = { 44100, 48000, 96000 };
+		static constexpr std::array<uint32_t, 3> CHANNEL_COUNTS = { 1, 2, 6 };
+
+		static constexpr std::string_view JOB_MEMORY = "memory";
+		static constexpr int MEMORY_TEST_DATA_VERSION = 1; // NOTE: bump whenever the result JSON layout changes.
+		static constexpr int MIN_MEMORY_TRACKS = 1;
+		static constexpr int DEF_MEMORY_TRACKS = 8;
+		static constexpr int MAX_MEMORY_TRACKS = 64;
+		static constexpr uint32_t MEMORY_SAMPLE_RATE = 48000;
+		static constexpr uint32_t MEMORY_CHANNELS = 2;
+	};
+
+	// * BENCHMARK RESULT * //
+	struct RunResult {
+		std::string source;
+		std::string engine;
+		uint32_t sampleRate = 0;
+		uint32_t channels = 0;
+		int chunkMs = 0;
+		size_t frames = 0;
+		double seconds = 0.0; // Wall time through the engine entry points, stage timers included
+		double finalizeSeconds = 0.0;
+		AWHPerf::StageProfile profile; // Filled by the engines themselves through the AW_STAGE_* timers
+	};
+
+	// * PUBLIC API * //
+	static uint32_t StartBenchmark(int durationSec, int priority);
+	static bool RunBenchmark(int durationSec, const JobContext& job, std::string& json);
+	static void GenerateSyntheticSignal(uint32_t sampleRate, uint32_t channels, size_t frames, std::vector<audioType>& samples);
+	static uint32_t StartMemoryTest(int trackCount, int durationSec, int priority);
+	static bool RunMemoryTest(int trackCount, int durationSec, const JobContext& job, std::string& json);
+
+private:
+	// * PRIVATE ENGINE RUNS * //
+	static bool RunFullTrack(const std::vector<audioType>& samples, uint32_t sampleRate, uint32_t channels,
+		const JobContext& job, RunResult& result
+	);
+	static bool RunRealTime(const std::vector<audioType>& samples, uint32_t sampleRate, uint32_t channels,
+		const JobContext& job, RunResult& result
+	);
+
+	// * PRIVATE HELPERS * //
+	static double GetSecondsSince(Clock::time_point start);
+	static void WriteRunJson(std::ostringstream& oss, const RunResult& result);
+};
+#pragma endregion
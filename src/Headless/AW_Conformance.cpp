@@ -0,0 +1,281 @@
+/////////////////////////////////////////////////////////////////////////////////
+// * FB2K Component: Audio Wizard                                            * //
+// * Description:    Audio Wizard Conformance Suite Source File              * //
+// * Author:         TT                                                      * //
+// * Website:        https://github.com/The-Wizardium/Audio-Wizard           * //
+// * Version:        0.6.0                                                   * //
+// * Dev. started:   19-10-2026                                              * //
+// * Last change:    19-10-2026                                              * //
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "AW_PCH.h"
+#include "AW.h"
+#include "AW_Conformance.h"
+
+
+////////////////////////////////
+// * PUBLIC CONFORMANCE API * //
+////////////////////////////////
+#pragma region Public Conformance API
+bool AudioWizardConformance::RunConformance(const JobContext& job, std::string& json) {
+	const std::vector<ConformanceCase> cases = GetConformanceCases();
+	const uint32_t sampleRate = Config::SAMPLE_RATE;
+	size_t checkCount = 0;
+	size_t failureCount = 0;
+	std::ostringstream casesJson;
+
+	for (size_t caseIndex = 0; caseIndex < cases.size(); ++caseIndex) {
+		const ConformanceCase& testCase = cases[caseIndex];
+		const auto channels = static_cast<uint32_t>(testCase.channelGainsDb.size());
+		std::vector<audioType> samples;
+		GenerateConformanceSignal(testCase, sampleRate, samples);
+		const double audioSeconds = static_cast<double>(samples.size() / channels) / sampleRate;
+
+		for (const bool isFullTrack : { true, false }) {
+			ConformanceValues values;
+			values.fill(std::numeric_limits<double>::quiet_NaN());
+
+			const auto start = Clock::now();
+			const bool success = isFullTrack
+				? MeasureFullTrack(samples, sampleRate, channels, job, values)
+				: MeasureRealTime(samples, sampleRate, channels, job, values);
+			const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+			if (!success) return false;
+
+			if (casesJson.tellp() > 0) casesJson << ",";
+			casesJson << "{\"name\":\"" << testCase.name << "\",\"engine\":\"" << (isFullTrack ? "fullTrack" : "realTime") << "\""
+				<< std::fixed << std::setprecision(6) << ",\"seconds\":" << seconds
+				<< std::setprecision(2) << ",\"realTimeFactor\":" << audioSeconds / std::max(seconds, 1e-9)
+				<< ",\"checks\":[";
+
+			bool isFirstCheck = true;
+			for (const ConformanceCheck& check : testCase.checks) {
+				const double measured = values[check.metric];
+				if (std::isnan(measured)) continue; // Metric not provided by this engine
+
+				const double deviation = measured - check.expected;
+				const bool passed = std::isfinite(measured) && deviation >= check.toleranceLow - 1e-9 && deviation <= check.toleranceHigh + 1e-9;
+				++checkCount;
+
+				if (!passed) {
+					++failureCount;
+					FB2K_console_formatter() << "Audio Wizard => Conformance: " << testCase.name.data() << " (" << (isFullTrack ? "fullTrack" : "realTime")
+						<< ") " << Config::METRIC_NAMES[check.metric].data() << " measured " << AWHString::ToFixed(2, measured)
+						<< ", expected " << AWHString::ToFixed(2, check.expected);
+				}
+
+				if (!isFirstCheck) casesJson << ",";
+				isFirstCheck = false;
+				casesJson << "{\"metric\":\"" << Config::METRIC_NAMES[check.metric] << "\""
+					<< std::setprecision(2) << ",\"expected\":" << check.expected
+					<< ",\"measured\":";
+				if (std::isfinite(measured)) casesJson << measured; else casesJson << "null";
+				casesJson << ",\"toleranceLow\":" << check.toleranceLow
+					<< ",\"toleranceHigh\":" << check.toleranceHigh
+					<< ",\"passed\":" << (passed ? "true" : "false") << "}";
+			}
+			casesJson << "]}";
+		}
+
+		job.SetProgress(static_cast<double>(caseIndex + 1) / cases.size());
+	}
+
+	std::ostringstream oss;
+	oss << "{"
+		<< R"("componentVersion":")" << ::AW_COMPONENT_VERSION << "\","
+		<< "\"conformanceDataVersion\":" << Config::CONFORMANCE_DATA_VERSION
+		<< ",\"passed\":" << (failureCount == 0 ? "true" : "false")
+		<< ",\"checks\":" << checkCount
+		<< ",\"failures\":" << failureCount
+		<< ",\"cases\":[" << casesJson.str() << "]}";
+
+	FB2K_console_formatter() << "Audio Wizard => Conformance: " << (checkCount - failureCount) << "/" << checkCount << " checks passed";
+
+	json = oss.str();
+	return true;
+}
+
+std::vector<AudioWizardConformance::ConformanceCase> AudioWizardConformance::GetConformanceCases() {
+	// Synthetic test signals of EBU Tech 3341 (loudness, true peak), EBU Tech 3342 (loudness range) and ITU-R BS.2217
+	// (channel weighting). The authentic programme items of these suites need external files and are not included.
+	const std::vector<double> stereo = { 0.0, 0.0 };
+	constexpr double LOUDNESS_TOLERANCE = 0.1;
+	constexpr double LRA_TOLERANCE = 1.0;
+	constexpr double TRUE_PEAK_FADE_IN = 0.05;
+
+	auto repeated = [](std::initializer_list<ConformanceSegment> period, size_t count) {
+		std::vector<ConformanceSegment> segments;
+		for (size_t i = 0; i < count; ++i) segments.insert(segments.end(), period);
+		return segments;
+	};
+	auto steady = [](double lufs) {
+		return std::vector<ConformanceCheck>{
+			{ METRIC_MOMENTARY_MAX, lufs, -LOUDNESS_TOLERANCE, LOUDNESS_TOLERANCE },
+			{ METRIC_MOMENTARY_MIN, lufs, -LOUDNESS_TOLERANCE, LOUDNESS_TOLERANCE },
+			{ METRIC_SHORT_TERM_MAX, lufs, -LOUDNESS_TOLERANCE, LOUDNESS_TOLERANCE },
+			{ METRIC_SHORT_TERM_MIN, lufs, -LOUDNESS_TOLERANCE, LOUDNESS_TOLERANCE },
+			{ METRIC_INTEGRATED, lufs, -LOUDNESS_TOLERANCE, LOUDNESS_TOLERANCE }
+		};
+	};
+	auto integrated = [](double lufs) {
+		return std::vector<ConformanceCheck>{ { METRIC_INTEGRATED, lufs, -LOUDNESS_TOLERANCE, LOUDNESS_TOLERANCE } };
+	};
+	auto loudnessRange = [](double lu) {
+		return std::vector<ConformanceCheck>{ { METRIC_LOUDNESS_RANGE, lu, -LRA_TOLERANCE, LRA_TOLERANCE } };
+	};
+	auto truePeak = [](double dbtp) {
+		return std::vector<ConformanceCheck>{ { METRIC_TRUE_PEAK, dbtp, -0.4, 0.2 } };
+	};
+	const double fs = Config::SAMPLE_RATE;
+
+	return {
+		// EBU Tech 3341 - 1 kHz stereo sine, -23 / -33 dBFS per channel
+		{ "EBU 3341 #1", Config::FREQUENCY, 0.0, stereo, { { -23.0, 20.0 } }, steady(-23.0) },
+		{ "EBU 3341 #2", Config::FREQUENCY, 0.0, stereo, { { -33.0, 20.0 } }, steady(-33.0) },
+
+		// EBU Tech 3341 - absolute and relative gating
+		{ "EBU 3341 #3", Config::FREQUENCY, 0.0, stereo, { { -36.0, 10.0 }, { -23.0, 60.0 }, { -36.0, 10.0 } }, integrated(-23.0) },
+		{ "EBU 3341 #4", Config::FREQUENCY, 0.0, stereo,
+			{ { -72.0, 10.0 }, { -36.0, 10.0 }, { -23.0, 60.0 }, { -36.0, 10.0 }, { -72.0, 10.0 } }, integrated(-23.0) },
+		{ "EBU 3341 #5", Config::FREQUENCY, 0.0, stereo, { { -26.0, 20.0 }, { -20.0, 20.1 }, { -26.0, 20.0 } }, integrated(-23.0) },
+
+		// EBU Tech 3341 - 5.0 channel weighting, L/R at -28 dBFS, C at -24 dBFS and Ls/Rs at -30 dBFS
+		{ "EBU 3341 #6", Config::FREQUENCY, 0.0, { -28.0, -28.0, -24.0, -30.0, -30.0 }, { { 0.0, 20.0 } }, integrated(-23.0) },
+
+		// EBU Tech 3341 - constant short-term and momentary loudness from tone bursts
+		{ "EBU 3341 #9", Config::FREQUENCY, 0.0, stereo, repeated({ { -20.0, 1.34 }, { -30.0, 1.66 } }, 20), {
+			{ METRIC_SHORT_TERM_MAX, -23.0, -LOUDNESS_TOLERANCE, LOUDNESS_TOLERANCE },
+			{ METRIC_SHORT_TERM_MIN, -23.0, -LOUDNESS_TOLERANCE, LOUDNESS_TOLERANCE } }
+		},
+		{ "EBU 3341 #12", Config::FREQUENCY, 0.0, stereo, repeated({ { -20.0, 0.18 }, { -30.0, 0.22 } }, 25), {
+			{ METRIC_MOMENTARY_MAX, -23.0, -LOUDNESS_TOLERANCE, LOUDNESS_TOLERANCE },
+			{ METRIC_MOMENTARY_MIN, -23.0, -LOUDNESS_TOLERANCE, LOUDNESS_TOLERANCE } }
+		},
+
+		// EBU Tech 3341 - true peak of -6 dBFS sines whose peaks fall between samples, faded in so only the steady sine is measured
+		{ "EBU 3341 #15", fs / 4.0, 0.0, stereo, { { -6.0, 5.0 } }, truePeak(-6.0), TRUE_PEAK_FADE_IN },
+		{ "EBU 3341 #16", fs / 4.0, 45.0, stereo, { { -6.0, 5.0 } }, truePeak(-6.0), TRUE_PEAK_FADE_IN },
+		{ "EBU 3341 #17", fs / 6.0, 60.0, stereo, { { -6.0, 5.0 } }, truePeak(-6.0), TRUE_PEAK_FADE_IN },
+		{ "EBU 3341 #18", fs / 8.0, 67.5, stereo, { { -6.0, 5.0 } }, truePeak(-6.0), TRUE_PEAK_FADE_IN },
+
+		// EBU Tech 3342 - loudness range of stepped 1 kHz sines
+		{ "EBU 3342 #1", Config::FREQUENCY, 0.0, stereo, { { -20.0, 20.0 }, { -30.0, 20.0 } }, loudnessRange(10.0) },
+		{ "EBU 3342 #2", Config::FREQUENCY, 0.0, stereo, { { -20.0, 20.0 }, { -15.0, 20.0 } }, loudnessRange(5.0) },
+		{ "EBU 3342 #3", Config::FREQUENCY, 0.0, stereo, { { -40.0, 20.0 }, { -20.0, 20.0 } }, loudnessRange(20.0) },
+		{ "EBU 3342 #4", Config::FREQUENCY, 0.0, stereo,
+			{ { -50.0, 20.0 }, { -35.0, 20.0 }, { -20.0, 20.0 }, { -35.0, 20.0 }, { -50.0, 20.0 } }, loudnessRange(15.0) },
+
+		// ITU-R BS.2217 - a full scale 1 kHz sine in one front channel reads -3.01, the LFE is excluded
+		{ "ITU BS.2217 front", Config::FREQUENCY, 0.0, { 0.0, -INFINITY }, { { 0.0, 20.0 } }, integrated(-3.01) },
+		{ "ITU BS.2217 LFE", Config::FREQUENCY, 0.0, { -28.0, -28.0, -24.0, -20.0, -30.0, -30.0 }, { { 0.0, 20.0 } }, integrated(-23.0) }
+	};
+}
+
+void AudioWizardConformance::GenerateConformanceSignal(const ConformanceCase& testCase, uint32_t sampleRate, std::vector<audioType>& samples) {
+	constexpr double PI = 3.14159265358979323846;
+	const size_t channels = testCase.channelGainsDb.size();
+	const double phaseStep = 2.0 * PI * testCase.frequency / sampleRate;
+	const double startPhase = testCase.phaseDeg * PI / 180.0;
+	const auto fadeFrames = static_cast<size_t>(std::llround(testCase.fadeInSeconds * sampleRate));
+	size_t index = 0;
+
+	std::vector<double> channelGains(channels);
+	for (size_t ch = 0; ch < channels; ++ch) {
+		channelGains[ch] = std::isfinite(testCase.channelGainsDb[ch]) ? AWHAudio::DbToLinear(testCase.channelGainsDb[ch]) : 0.0;
+	}
+
+	samples.clear();
+
+	// The phase runs on across segments, level steps never restart the sine
+	for (const ConformanceSegment& segment : testCase.segments) {
+		const auto frames = static_cast<size_t>(std::llround(segment.seconds * sampleRate));
+		const double amplitude = AWHAudio::DbToLinear(segment.levelDb);
+
+		for (size_t frame = 0; frame < frames; ++frame, ++index) {
+			const double fade = index < fadeFrames ? 0.5 - 0.5 * std::cos(PI * static_cast<double>(index) / fadeFrames) : 1.0;
+			const double value = fade * amplitude * std::sin(startPhase + phaseStep * static_cast<double>(index));
+			for (size_t ch = 0; ch < channels; ++ch) {
+				samples.push_back(static_cast<audioType>(value * channelGains[ch]));
+			}
+		}
+	}
+}
+#pragma endregion
+
+
+/////////////////////////////
+// * PRIVATE ENGINE RUNS * //
+/////////////////////////////
+#pragma region Private Engine Runs
+bool AudioWizardConformance::MeasureFullTrack(const std::vector<audioType>& samples, uint32_t sampleRate, uint32_t channels,
+	const JobContext& job, ConformanceValues& values) {
+	auto ftData = std::make_unique<FullTrackData>();
+	const size_t totalFrames = samples.size() / channels;
+	const size_t chunkFrames = std::max<size_t>(1, static_cast<size_t>(sampleRate) * Config::FULL_TRACK_CHUNK_MS / 1000);
+
+	for (size_t offset = 0; offset < totalFrames; offset += chunkFrames) {
+		if (job.IsCanceled()) return false;
+
+		ChunkData data;
+		data.data = samples.data() + offset * channels;
+		data.channels = channels;
+		data.frames = std::min(chunkFrames, totalFrames - offset);
+		data.sampleRate = sampleRate;
+		AudioWizardAnalysisFullTrack::ProcessFullTrackChunk(data, *ftData);
+	}
+
+	values[METRIC_MOMENTARY_MAX] = AudioWizardAnalysisFullTrack::GetMomentaryLUFSFull(*ftData);
+	values[METRIC_SHORT_TERM_MAX] = AudioWizardAnalysisFullTrack::GetShortTermLUFSFull(*ftData);
+	values[METRIC_INTEGRATED] = AudioWizardAnalysisFullTrack::GetIntegratedLUFSFull(*ftData);
+	values[METRIC_LOUDNESS_RANGE] = AudioWizardAnalysisFullTrack::GetLoudnessRangeFull(*ftData);
+	values[METRIC_TRUE_PEAK] = AudioWizardAnalysisFullTrack::GetTruePeakFull(*ftData);
+	return true;
+}
+
+bool AudioWizardConformance::MeasureRealTime(const std::vector<audioType>& samples, uint32_t sampleRate, uint32_t channels,
+	const JobContext& job, ConformanceValues& values) {
+	auto rtData = std::make_unique<RealTimeData>();
+	const size_t totalFrames = samples.size() / channels;
+	const size_t chunkFrames = std::max<size_t>(1, static_cast<size_t>(sampleRate) * Config::REAL_TIME_CHUNK_MS / 1000);
+
+	// Extremes only count once the measurement window is filled, like the full-track windows, a partial window reads the first burst alone
+	const auto momentaryFilled = static_cast<size_t>(0.4 * sampleRate);
+	const auto shortTermFilled = static_cast<size_t>(3.0 * sampleRate);
+	double momentaryMax = -INFINITY;
+	double momentaryMin = INFINITY;
+	double shortTermMax = -INFINITY;
+	double shortTermMin = INFINITY;
+	double truePeakMax = -INFINITY;
+
+	for (size_t offset = 0; offset < totalFrames; offset += chunkFrames) {
+		if (job.IsCanceled()) return false;
+
+		ChunkData data;
+		data.data = samples.data() + offset * channels;
+		data.channels = channels;
+		data.frames = std::min(chunkFrames, totalFrames - offset);
+		data.sampleRate = sampleRate;
+		AudioWizardAnalysisRealTime::ProcessRealtimeChunk(data, *rtData);
+
+		const size_t processedFrames = offset + data.frames;
+		truePeakMax = std::max(truePeakMax, rtData->truePeak);
+		if (processedFrames >= momentaryFilled) {
+			momentaryMax = std::max(momentaryMax, rtData->momentaryLUFS);
+			momentaryMin = std::min(momentaryMin, rtData->momentaryLUFS);
+		}
+		if (processedFrames >= shortTermFilled) {
+			shortTermMax = std::max(shortTermMax, rtData->shortTermLUFS);
+			shortTermMin = std::min(shortTermMin, rtData->shortTermLUFS);
+		}
+	}
+
+	values[METRIC_MOMENTARY_MAX] = momentaryMax;
+	values[METRIC_MOMENTARY_MIN] = momentaryMin;
+	values[METRIC_SHORT_TERM_MAX] = shortTermMax;
+	values[METRIC_SHORT_TERM_MIN] = shortTermMin;
+	values[METRIC_INTEGRATED] = rtData->integratedLUFS;
+	values[METRIC_TRUE_PEAK] = truePeakMax;
+	return true;
+}
+#pragma endregion
@@ -0,0 +1,91 @@
+/////////////////////////////////////////////////////////////////////////////////
+// * FB2K Component: Audio Wizard                                            * //
+// * Description:    Audio Wizard Conformance Suite Header File              * //
+// * Author:         TT                                                      * //
+// * Website:        https://github.com/The-Wizardium/Audio-Wizard           * //
+// * Version:        0.6.0                                                   * //
+// * Dev. started:   19-10-2026                                              * //
+// * Last change:    19-10-2026                                              * //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+#include "AW_Analysis.h"
+#include "AW_Jobs.h"
+
+
+/////////////////////
+// * CONFORMANCE * //
+/////////////////////
+#pragma region Conformance
+// Synthetic EBU Tech 3341/3342 and ITU-R BS.2217 cases measured with both analysis engines.
+// Test code only: built into aw_tests and run by ctest as the Conformance test, never shipped in the component.
+class AudioWizardConformance {
+public:
+	// * TYPE ALIASES * //
+	using ChunkData = AWHAudioData::ChunkData;
+	using FullTrackData = AudioWizardAnalysisFullTrack::FullTrackData;
+	using RealTimeData = AudioWizardAnalysisRealTime::RealTimeData;
+	using JobContext = AudioWizardJobs::JobContext;
+	using Clock = std::chrono::steady_clock;
+
+	// * CONFIG * //
+	struct Config {
+		static constexpr std::string_view JOB_CONFORMANCE = "conformance";
+		static constexpr int CONFORMANCE_DATA_VERSION = 1; // NOTE: bump whenever the result JSON layout changes.
+		static constexpr uint32_t SAMPLE_RATE = 48000;
+		static constexpr double FREQUENCY = 1000.0;
+		static constexpr int FULL_TRACK_CHUNK_MS = 200; // Default full-track chunk duration
+		static constexpr int REAL_TIME_CHUNK_MS = 50;   // Default real-time chunk duration
+		static constexpr std::array<std::string_view, 7> METRIC_NAMES = {
+			"momentaryMax", "momentaryMin", "shortTermMax", "shortTermMin", "integrated", "loudnessRange", "truePeak"
+		};
+	};
+
+	// * CONFORMANCE CASES * //
+	enum ConformanceMetric : size_t {
+		METRIC_MOMENTARY_MAX,  // Largest momentary loudness once the 400ms window is filled
+		METRIC_MOMENTARY_MIN,  // Smallest momentary loudness once the 400ms window is filled, real-time only
+		METRIC_SHORT_TERM_MAX, // Largest short-term loudness once the 3s window is filled
+		METRIC_SHORT_TERM_MIN, // Smallest short-term loudness once the 3s window is filled, real-time only
+		METRIC_INTEGRATED,
+		METRIC_LOUDNESS_RANGE, // Full-track only
+		METRIC_TRUE_PEAK,
+		METRIC_COUNT
+	};
+	struct ConformanceSegment {
+		double levelDb;
+		double seconds;
+	};
+	struct ConformanceCheck {
+		ConformanceMetric metric;
+		double expected;
+		double toleranceLow;  // Accepted deviation below the expected value, negative
+		double toleranceHigh; // Accepted deviation above the expected value
+	};
+	struct ConformanceCase {
+		std::string_view name;
+		double frequency = Config::FREQUENCY;
+		double phaseDeg = 0.0;
+		std::vector<double> channelGainsDb; // One entry per channel, -INFINITY for a silent channel
+		std::vector<ConformanceSegment> segments;
+		std::vector<ConformanceCheck> checks;
+		double fadeInSeconds = 0.0; // Raised-cosine onset, a sine that starts mid-cycle is a step whose overshoot is a real true peak
+	};
+	using ConformanceValues = std::array<double, METRIC_COUNT>; // NaN where the engine has no such metric
+
+	// * PUBLIC API * //
+	static bool RunConformance(const JobContext& job, std::string& json);
+	static std::vector<ConformanceCase> GetConformanceCases();
+	static void GenerateConformanceSignal(const ConformanceCase& testCase, uint32_t sampleRate, std::vector<audioType>& samples);
+
+private:
+	// * PRIVATE ENGINE RUNS * //
+	static bool MeasureFullTrack(const std::vector<audioType>& samples, uint32_t sampleRate, uint32_t channels,
+		const JobContext& job, ConformanceValues& values
+	);
+	static bool MeasureRealTime(const std::vector<audioType>& samples, uint32_t sampleRate, uint32_t channels,
+		const JobContext& job, ConformanceValues& values
+	);
+};
+#pragma endregion
@@ -0,0 +1,208 @@
+/////////////////////////////////////////////////////////////////////////////////
+// * FB2K Component: Audio Wizard                                            * //
+// * Description:    Audio Wizard Headless SDK Shim Header File              * //
+// * Author:         TT                                                      * //
+// * Website:        https://github.com/The-Wizardium/Audio-Wizard           * //
+// * Version:        0.6.0                                                   * //
+// * Dev. started:   19-10-2026                                              * //
+// * Last change:    19-10-2026                                              * //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+
+// * Standard C++ libraries * //
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// * POSIX shared memory, the SharedAudioRing backend where Win32 file mappings are unavailable * //
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+///////////////////////////
+// * HEADLESS SDK SHIM * //
+///////////////////////////
+#pragma region Headless SDK Shim
+// The few foobar2000 SDK types and calls the analysis core touches, so AW_Analysis, AW_Helpers, AW_Jobs
+// and the headless AW_Benchmark build with AW_HEADLESS outside Windows. Everything here is a stand-in with the same
+// spelling as the SDK: no playback, no metadata and no decoding, just enough to feed synthetic chunks.
+using audio_sample = double; // Same as the x64 SDK build
+using audioType = audio_sample;
+using t_size = size_t;
+using t_uint32 = uint32_t;
+
+namespace pfc {
+	class string8 {
+	public:
+		string8() = default;
+		string8(const char* text) : text(text ? text : "") {}
+		string8(std::string text) : text(std::move(text)) {}
+
+		const char* get_ptr() const { return text.c_str(); }
+		const char* c_str() const { return text.c_str(); }
+		size_t get_length() const { return text.size(); }
+		bool is_empty() const { return text.empty(); }
+		void reset() { text.clear(); }
+		void set_string(const char* value) { text = value ? value : ""; }
+		void add_string(const char* value) { text += value ? value : ""; }
+
+		string8 toLower() const {
+			std::string lower = text;
+			std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+			return lower;
+		}
+
+		string8& operator+=(const char* value) { add_string(value); return *this; }
+		string8 operator+(const char* value) const { return text + (value ? value : ""); }
+		bool operator==(const char* value) const { return text == (value ? value : ""); }
+		operator const char*() const { return text.c_str(); }
+
+		template<typename T>
+		string8& operator<<(const T& value) {
+			std::ostringstream oss;
+			oss << value;
+			text += oss.str();
+			return *this;
+		}
+
+	private:
+		std::string text;
+	};
+	using string_formatter = string8;
+
+	namespace stringcvt {
+		class string_wide_from_utf8 {
+		public:
+			explicit string_wide_from_utf8(const char* text) {
+				for (const auto* c = reinterpret_cast<const unsigned char*>(text ? text : ""); *c;) {
+					const int extra = *c >= 0xF0 ? 3 : *c >= 0xE0 ? 2 : *c >= 0xC0 ? 1 : 0;
+					uint32_t codePoint = *c++ & (0x7F >> extra);
+					for (int i = 0; i < extra && (*c & 0xC0) == 0x80; ++i) {
+						codePoint = (codePoint << 6) | (*c++ & 0x3F);
+					}
+					wide.push_back(static_cast<wchar_t>(codePoint));
+				}
+			}
+
+			const wchar_t* get_ptr() const { return wide.c_str(); }
+			operator const wchar_t*() const { return wide.c_str(); }
+
+		private:
+			std::wstring wide;
+		};
+	}
+}
+
+class FB2K_console_formatter { // Collects one console line and prints it to stderr when done
+public:
+	FB2K_console_formatter() = default;
+	FB2K_console_formatter(const FB2K_console_formatter&) = delete;
+	FB2K_console_formatter& operator=(const FB2K_console_formatter&) = delete;
+	~FB2K_console_formatter() { std::cerr << line.str() << '\n'; }
+
+	template<typename T>
+	FB2K_console_formatter& operator<<(const T& value) {
+		line << value;
+		return *this;
+	}
+
+private:
+	std::ostringstream line;
+};
+
+template<typename... Args>
+void FB2K_console_print(const Args&... args) {
+	(FB2K_console_formatter() << ... << args);
+}
+
+template<typename T>
+class service_ptr_t { // Never holds a service, headless code has no service registry
+public:
+	bool is_valid() const { return false; }
+	bool is_empty() const { return true; }
+	T* operator->() const { return nullptr; }
+};
+
+class visualisation_stream_v3;
+
+class audio_chunk_impl { // Interleaved audio owned by the chunk, the only part of the SDK chunk the core reads
+public:
+	const audio_sample* get_data() const { return data.data(); }
+	unsigned get_channels() const { return channels; }
+	unsigned get_srate() const { return sampleRate; }
+	unsigned get_sample_rate() const { return sampleRate; }
+	size_t get_sample_count() const { return channels ? data.size() / channels : 0; }
+
+	void set_data(const audio_sample* samples, size_t frames, unsigned chunkChannels, unsigned chunkSampleRate) {
+		data.assign(samples, samples + frames * chunkChannels);
+		channels = chunkChannels;
+		sampleRate = chunkSampleRate;
+	}
+
+private:
+	std::vector<audio_sample> data;
+	unsigned channels = 0;
+	unsigned sampleRate = 0;
+};
+
+class metadb_handle { // Headless runs have no library, a handle only carries the path it was made from
+public:
+	explicit metadb_handle(std::string path) : path(std::move(path)) {}
+	const char* get_path() const { return path.c_str(); }
+
+private:
+	std::string path;
+};
+
+class metadb_handle_ptr {
+public:
+	metadb_handle_ptr() = default;
+	bool is_valid() const { return handle != nullptr; }
+	bool is_empty() const { return handle == nullptr; }
+	const metadb_handle* operator->() const { return handle.get(); }
+
+private:
+	std::shared_ptr<metadb_handle> handle;
+};
+#pragma endregion
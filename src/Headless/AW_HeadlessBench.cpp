@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////
+// * FB2K Component: Audio Wizard                                            * //
+// * Description:    Audio Wizard Headless Benchmark Source File             * //
+// * Author:         TT                                                      * //
+// * Website:        https://github.com/The-Wizardium/Audio-Wizard           * //
+// * Version:        0.6.0                                                   * //
+// * Dev. started:   19-10-2026                                              * //
+// * Last change:    19-10-2026                                              * //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#include "AW_PCH.h"
+#include "AW.h"
+#include "AW_Benchmark.h"
+
+
+////////////////////////////
+// * HEADLESS BENCHMARK * //
+////////////////////////////
+#pragma region Headless Benchmark
+// Runs the benchmark job on the synthetic signal and prints the result JSON, so throughput can be
+// reproduced and compared outside foobar2000. The benchmark is not part of the component API:
+//
+//   aw_bench [--duration <seconds>] [--memory <tracks>]
+//
+// The conformance suite is test code, it runs under ctest from aw_tests.
+namespace {
+	int RunJob(uint32_t id) {
+		using State = AudioWizardJobs::JobState;
+		AudioWizardJobs::JobInfo info;
+
+		while (AudioWizard::Jobs()->GetJobInfo(id, info) && (info.state == State::Queued || info.state == State::Running)) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		}
+
+		if (info.state != State::Completed) {
+			std::cerr << "aw_bench: job " << id << " ended as "
+				<< AudioWizardJobs::Config::JOB_STATE_NAMES[static_cast<size_t>(info.state)]
+				<< (info.error.empty() ? "" : " - ") << info.error << '\n';
+			return 1;
+		}
+
+		std::cout << info.resultJson << '\n';
+		return 0;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	int durationSec = AudioWizardBenchmark::Config::DEF_DURATION_SEC;
+	int memoryTracks = 0;
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view arg = argv[i];
+
+		if (arg == "--duration" && i + 1 < argc) {
+			durationSec = std::atoi(argv[++i]);
+		}
+		else if (arg == "--memory" && i + 1 < argc) {
+			memoryTracks = std::atoi(argv[++i]);
+		}
+		else {
+			std::cerr << "Usage: aw_bench [--duration <seconds>] [--memory <tracks>]\n";
+			return 2;
+		}
+	}
+
+	const int priority = AudioWizardJobs::Config::DEF_PRIORITY;
+
+	if (memoryTracks > 0) {
+		return RunJob(AudioWizardBenchmark::StartMemoryTest(memoryTracks, durationSec, priority));
+	}
+
+	return RunJob(AudioWizardBenchmark::StartBenchmark(durationSec, priority));
+}
+#pragma endregion
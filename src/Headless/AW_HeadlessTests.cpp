@@ -0,0 +1,955 @@
+/////////////////////////////////////////////////////////////////////////////////
+// * FB2K Component: Audio Wizard                                            * //
+// * Description:    Audio Wizard Headless Tests Source File                 * //
+// * Author:         TT                                                      * //
+// * Website:        https://github.com/The-Wizardium/Audio-Wizard           * //
+// * Version:        0.6.0                                                   * //
+// * Dev. started:   19-10-2026                                              * //
+// * Last change:    19-10-2026                                              * //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#include "AW_PCH.h"
+#include "AW.h"
+#include "AW_Analysis.h"
+#include "AW_Benchmark.h"
+#include "AW_Conformance.h"
+#include "AW_WaveformCache.h"
+
+
+//////////////////////
+// * TEST HARNESS * //
+//////////////////////
+#pragma region Test Harness
+// Each test is registered by name and run by ctest as "aw_tests <name>", see CMakeLists.txt.
+// A failed check prints its location and fails the test but lets the remaining checks run.
+namespace {
+	int failedChecks = 0;
+
+	bool Check(bool condition, const char* expression, const char* file, int line) {
+		if (!condition) {
+			std::cerr << file << ":" << line << ": check failed: " << expression << '\n';
+			++failedChecks;
+		}
+		return condition;
+	}
+
+	#define AW_CHECK(condition) Check((condition), #condition, __FILE__, __LINE__)
+
+	using TestFunc = void(*)();
+	std::map<std::string, TestFunc, std::less<>>& Tests() {
+		static std::map<std::string, TestFunc, std::less<>> tests;
+		return tests;
+	}
+
+	struct TestRegistration {
+		TestRegistration(const char* name, TestFunc func) { Tests()[name] = func; }
+	};
+
+	#define AW_TEST(name) \
+		void Test_##name(); \
+		const TestRegistration registration_##name(#name, Test_##name); \
+		void Test_##name()
+}
+#pragma endregion
+
+
+////////////////////////////
+// * COUNTING ALLOCATOR * //
+////////////////////////////
+#pragma region Counting Allocator
+// Replaces the global allocation functions for the whole test binary. Only allocations made
+// on a thread that enabled counting are tallied, so scheduler and library threads do not interfere.
+namespace {
+	thread_local bool countAllocations = false;
+	thread_local size_t allocationCount = 0;
+
+	class AllocationCounter {
+	public:
+		AllocationCounter() { allocationCount = 0; countAllocations = true; }
+		~AllocationCounter() { countAllocations = false; }
+		AllocationCounter(const AllocationCounter&) = delete;
+		AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+		size_t Count() const { return allocationCount; }
+	};
+}
+
+void* operator new(size_t size) {
+	if (countAllocations) ++allocationCount;
+	if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+	return operator new(size);
+}
+
+void* operator new(size_t size, std::align_val_t align) {
+	if (countAllocations) ++allocationCount;
+	const auto alignment = static_cast<size_t>(align);
+	if (void* ptr = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)) return ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new[](size_t size, std::align_val_t align) {
+	return operator new(size, align);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+#pragma endregion
+
+
+////////////////////////////
+// * REAL-TIME ANALYSIS * //
+////////////////////////////
+#pragma region Real-Time Analysis
+// ProcessRealtimeChunk runs on the audio callback thread and must not allocate once its state is sized.
+// The warm-up covers state initialization, the first DR14 block, the Pure Dynamics window and the first FFT frames.
+// The measured chunks step through every governor tier once per second, a tier change must not allocate either.
+AW_TEST(RealTimeZeroAllocation) {
+	constexpr uint32_t SAMPLE_RATES[] = { 44100, 48000 };
+	constexpr uint32_t CHANNELS[] = { 1, 2, 6 };
+	constexpr double WARM_UP_SEC = 8.0;
+	constexpr double MEASURE_SEC = 20.0;
+
+	for (uint32_t sampleRate : SAMPLE_RATES) {
+		for (uint32_t channels : CHANNELS) {
+			const size_t chunkFrames = sampleRate * AudioWizardBenchmark::Config::REAL_TIME_CHUNK_MS / 1000;
+			const auto warmUpFrames = static_cast<size_t>(WARM_UP_SEC * sampleRate);
+			const auto totalFrames = static_cast<size_t>((WARM_UP_SEC + MEASURE_SEC) * sampleRate);
+
+			std::vector<audioType> samples;
+			AudioWizardBenchmark::GenerateSyntheticSignal(sampleRate, channels, totalFrames, samples);
+			auto rtData = std::make_unique<AudioWizardAnalysisRealTime::RealTimeData>();
+			rtData->spectrumActive = true; // Covers the display spectrum as well
+
+			size_t allocatingChunks = 0;
+			size_t allocations = 0;
+
+			for (size_t offset = 0; offset + chunkFrames <= totalFrames; offset += chunkFrames) {
+				AWHAudioData::ChunkData data;
+				data.data = samples.data() + offset * channels;
+				data.channels = channels;
+				data.frames = chunkFrames;
+				data.sampleRate = sampleRate;
+
+				if (offset < warmUpFrames) {
+					AudioWizardAnalysisRealTime::ProcessRealtimeChunk(data, *rtData);
+					continue;
+				}
+
+				rtData->qualityTier = static_cast<int>((offset - warmUpFrames) / sampleRate % (AWHPerf::QualityGovernor::TIER_LOW_OVERSAMPLING + 1));
+
+				AllocationCounter counter;
+				AudioWizardAnalysisRealTime::ProcessRealtimeChunk(data, *rtData);
+				if (counter.Count() > 0) {
+					++allocatingChunks;
+					allocations += counter.Count();
+				}
+			}
+
+			if (!AW_CHECK(allocatingChunks == 0)) {
+				std::cerr << "  " << sampleRate << " Hz, " << channels << " ch: " << allocations
+					<< " allocations in " << allocatingChunks << " chunks\n";
+			}
+		}
+	}
+}
+#pragma endregion
+
+
+///////////////////////
+// * JOB SCHEDULER * //
+///////////////////////
+#pragma region Job Scheduler
+// Each test owns its scheduler. Jobs block on flags or poll IsCanceled() like the analysis jobs do,
+// so the order of events is fixed by the test and not by thread timing.
+namespace {
+	using Jobs = AudioWizardJobs;
+	using JobState = AudioWizardJobs::JobState;
+	constexpr auto JOB_TIMEOUT = std::chrono::seconds(10);
+
+	bool WaitForJobState(const Jobs& jobs, uint32_t id, JobState state) {
+		const auto deadline = std::chrono::steady_clock::now() + JOB_TIMEOUT;
+		Jobs::JobInfo info;
+
+		while (std::chrono::steady_clock::now() < deadline) {
+			if (jobs.GetJobInfo(id, info) && info.state == state) return true;
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		return false;
+	}
+
+	Jobs::JobInfo GetJob(const Jobs& jobs, uint32_t id) {
+		Jobs::JobInfo info;
+		jobs.GetJobInfo(id, info);
+		return info;
+	}
+
+	class JobLog { // Names of the jobs in the order they ran
+	public:
+		void Add(std::string name) {
+			std::scoped_lock lock(mutex);
+			names.push_back(std::move(name));
+		}
+		std::vector<std::string> Get() const {
+			std::scoped_lock lock(mutex);
+			return names;
+		}
+
+	private:
+		mutable std::mutex mutex;
+		std::vector<std::string> names;
+	};
+
+	Jobs::JobWork BlockingJob(const std::atomic<bool>& release) {
+		return [&release](const Jobs::JobContext&) {
+			while (!release.load()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			return true;
+		};
+	}
+
+	Jobs::JobWork CooperativeJob() { // Runs until canceled or preempted, then reports it did not finish
+		return [](const Jobs::JobContext& context) {
+			while (!context.IsCanceled()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			return false;
+		};
+	}
+
+	Jobs::JobWork LoggingJob(JobLog& log, std::string name) {
+		return [&log, name](const Jobs::JobContext&) {
+			log.Add(name);
+			return true;
+		};
+	}
+}
+
+AW_TEST(SchedulerPriorityOrder) {
+	Jobs jobs;
+	JobLog log;
+	std::atomic<bool> release = false;
+
+	const uint32_t blocker = jobs.SubmitJob("blocker", 90, BlockingJob(release));
+	AW_CHECK(WaitForJobState(jobs, blocker, JobState::Running));
+
+	// Lower than the running job, so nothing is preempted and all of them wait in the queue
+	const uint32_t ids[] = {
+		jobs.SubmitJob("test", 10, LoggingJob(log, "low")),
+		jobs.SubmitJob("test", 40, LoggingJob(log, "high 1")),
+		jobs.SubmitJob("test", 40, LoggingJob(log, "high 2")),
+		jobs.SubmitJob("test", 30, LoggingJob(log, "mid")),
+		jobs.SubmitJob("test", Jobs::Config::MAX_PRIORITY + 50, LoggingJob(log, "clamped"))
+	};
+	AW_CHECK(GetJob(jobs, ids[4]).priority == Jobs::Config::MAX_PRIORITY);
+	AW_CHECK(GetJob(jobs, ids[0]).state == JobState::Queued);
+	AW_CHECK(GetJob(jobs, blocker).state == JobState::Running); // 100 preempts 90 only once the blocker looks at IsCanceled
+
+	release = true;
+	for (uint32_t id : ids) {
+		AW_CHECK(WaitForJobState(jobs, id, JobState::Completed));
+	}
+
+	// Highest priority first, submission order among equals
+	const std::vector<std::string> expected = { "clamped", "high 1", "high 2", "mid", "low" };
+	AW_CHECK(log.Get() == expected);
+	AW_CHECK(GetJob(jobs, ids[0]).progress == 1.0);
+}
+
+AW_TEST(SchedulerPreemptRequeue) {
+	Jobs jobs;
+	JobLog log;
+	std::atomic<int> runs = 0;
+	std::atomic<int> handlerCalls = 0;
+	std::atomic<bool> wasPreempted = false;
+
+	// The first run is interrupted and gives up, the rerun after the preempting job finishes normally
+	const uint32_t low = jobs.SubmitJob("low", 10, [&](const Jobs::JobContext& context) {
+		const int run = ++runs;
+		log.Add("low " + std::to_string(run));
+		context.SetCancelHandler([&handlerCalls] { ++handlerCalls; });
+		if (run > 1) return true;
+
+		while (!context.IsCanceled()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		wasPreempted = context.IsPreempted();
+		return false;
+	});
+	AW_CHECK(WaitForJobState(jobs, low, JobState::Running));
+	while (runs.load() == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	const uint32_t high = jobs.SubmitJob("high", 90, LoggingJob(log, "high"));
+	AW_CHECK(WaitForJobState(jobs, high, JobState::Completed));
+	AW_CHECK(WaitForJobState(jobs, low, JobState::Completed));
+
+	const std::vector<std::string> expected = { "low 1", "high", "low 2" };
+	AW_CHECK(log.Get() == expected);
+	AW_CHECK(GetJob(jobs, low).preemptions == 1);
+	AW_CHECK(handlerCalls.load() == 1);
+	AW_CHECK(wasPreempted.load()); // Tells the job it will run again, so it holds back its failure callback
+
+	// Equal priority never preempts
+	std::atomic<bool> release = false;
+	const uint32_t first = jobs.SubmitJob("first", 50, BlockingJob(release));
+	AW_CHECK(WaitForJobState(jobs, first, JobState::Running));
+	const uint32_t second = jobs.SubmitJob("second", 50, LoggingJob(log, "second"));
+	AW_CHECK(GetJob(jobs, second).state == JobState::Queued);
+	release = true;
+	AW_CHECK(WaitForJobState(jobs, second, JobState::Completed));
+	AW_CHECK(GetJob(jobs, first).preemptions == 0);
+}
+
+AW_TEST(SchedulerPreemptResume) {
+	Jobs jobs;
+	constexpr int STEPS = 8;
+	auto cursor = std::make_shared<int>(0); // Owned by the job like a full-track table, so a rerun continues where the last run stopped
+	std::vector<int> stepRuns(STEPS, 0);
+	std::atomic<bool> isHalfway = false;
+	std::atomic<double> resumedProgress = -1.0;
+
+	const uint32_t low = jobs.SubmitJob("scan", 10, [&, cursor](const Jobs::JobContext& context) {
+		if (*cursor > 0) resumedProgress = GetJob(jobs, context.GetJobId()).progress;
+
+		for (; *cursor < STEPS; ++*cursor) {
+			if (*cursor == STEPS / 2 && !isHalfway.exchange(true)) {
+				while (!context.IsCanceled()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			if (context.IsCanceled()) return false;
+
+			++stepRuns[*cursor];
+			context.SetProgress(static_cast<double>(*cursor + 1) / STEPS);
+		}
+		return true;
+	});
+	AW_CHECK(WaitForJobState(jobs, low, JobState::Running));
+	while (!isHalfway.load()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	std::atomic<bool> release = false;
+	const uint32_t high = jobs.SubmitJob("now playing", 90, BlockingJob(release));
+	AW_CHECK(WaitForJobState(jobs, high, JobState::Running));
+	AW_CHECK(GetJob(jobs, low).state == JobState::Queued);
+
+	release = true;
+	AW_CHECK(WaitForJobState(jobs, low, JobState::Completed));
+
+	// Every step ran once, and the rerun started from the progress the preempted run reached
+	AW_CHECK(stepRuns == std::vector<int>(STEPS, 1));
+	AW_CHECK(resumedProgress.load() == 0.5);
+	AW_CHECK(GetJob(jobs, low).preemptions == 1);
+}
+
+AW_TEST(SchedulerSupersede) {
+	Jobs jobs;
+	JobLog log;
+	std::atomic<bool> release = false;
+
+	const uint32_t blocker = jobs.SubmitJob("blocker", 90, BlockingJob(release));
+	AW_CHECK(WaitForJobState(jobs, blocker, JobState::Running));
+
+	// Only queued jobs of the same kind and priority are replaced
+	const uint32_t replaced = jobs.SubmitJob("waveform", 50, LoggingJob(log, "replaced"));
+	const uint32_t otherKind = jobs.SubmitJob("metrics", 50, LoggingJob(log, "other kind"));
+	const uint32_t otherPriority = jobs.SubmitJob("waveform", 40, LoggingJob(log, "other priority"));
+	const uint32_t replacement = jobs.SubmitJob("waveform", 50, LoggingJob(log, "replacement"), true);
+	AW_CHECK(GetJob(jobs, replaced).state == JobState::Canceled);
+
+	release = true;
+	AW_CHECK(WaitForJobState(jobs, replacement, JobState::Completed));
+	AW_CHECK(WaitForJobState(jobs, otherKind, JobState::Completed));
+	AW_CHECK(WaitForJobState(jobs, otherPriority, JobState::Completed));
+	const std::vector<std::string> expected = { "other kind", "replacement", "other priority" };
+	AW_CHECK(log.Get() == expected);
+
+	// A running job of the same kind and priority is canceled, not requeued
+	std::atomic<bool> wasPreempted = true;
+	const uint32_t running = jobs.SubmitJob("waveform", 50, [&wasPreempted](const Jobs::JobContext& context) {
+		while (!context.IsCanceled()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		wasPreempted = context.IsPreempted();
+		return false;
+	});
+	AW_CHECK(WaitForJobState(jobs, running, JobState::Running));
+	const uint32_t next = jobs.SubmitJob("waveform", 50, LoggingJob(log, "next"), true);
+	AW_CHECK(WaitForJobState(jobs, running, JobState::Canceled));
+	AW_CHECK(WaitForJobState(jobs, next, JobState::Completed));
+	AW_CHECK(GetJob(jobs, running).preemptions == 0);
+	AW_CHECK(!wasPreempted.load());
+}
+
+AW_TEST(SchedulerCancel) {
+	std::vector<std::pair<uint32_t, std::string>> observed;
+	std::mutex observedMutex;
+	Jobs jobs([&](uint32_t jobId, std::string_view kind) {
+		std::scoped_lock lock(observedMutex);
+		observed.emplace_back(jobId, std::string(kind));
+	});
+	JobLog log;
+	std::atomic<bool> release = false;
+
+	const uint32_t blocker = jobs.SubmitJob("blocker", 90, BlockingJob(release));
+	AW_CHECK(WaitForJobState(jobs, blocker, JobState::Running));
+
+	// Queued: dropped without running
+	const uint32_t queued = jobs.SubmitJob("queued", 50, LoggingJob(log, "queued"));
+	AW_CHECK(jobs.CancelJob(queued));
+	AW_CHECK(GetJob(jobs, queued).state == JobState::Canceled);
+	AW_CHECK(!jobs.CancelJob(queued));
+	AW_CHECK(!jobs.CancelJob(12345));
+	release = true;
+	AW_CHECK(WaitForJobState(jobs, blocker, JobState::Completed));
+
+	// Running: interrupted through IsCanceled and finished as canceled
+	const uint32_t running = jobs.SubmitJob("running", 50, CooperativeJob());
+	AW_CHECK(WaitForJobState(jobs, running, JobState::Running));
+	AW_CHECK(jobs.CancelJob(running));
+	AW_CHECK(WaitForJobState(jobs, running, JobState::Canceled));
+
+	// CancelJobs with wait returns once the running job of that kind has stopped
+	const uint32_t waited = jobs.SubmitJob("analysis", 50, CooperativeJob());
+	const uint32_t waitedQueued = jobs.SubmitJob("analysis", 40, LoggingJob(log, "analysis"));
+	const uint32_t kept = jobs.SubmitJob("other", 30, LoggingJob(log, "other"));
+	AW_CHECK(WaitForJobState(jobs, waited, JobState::Running));
+	jobs.CancelJobs({ "analysis" }, true);
+	AW_CHECK(GetJob(jobs, waited).state == JobState::Canceled);
+	AW_CHECK(GetJob(jobs, waitedQueued).state == JobState::Canceled);
+	AW_CHECK(WaitForJobState(jobs, kept, JobState::Completed));
+	AW_CHECK(log.Get() == std::vector<std::string>{ "other" });
+
+	// Failures report why
+	const uint32_t failed = jobs.SubmitJob("failed", 50, [](const Jobs::JobContext&) { return false; });
+	const uint32_t threw = jobs.SubmitJob("threw", 50, [](const Jobs::JobContext&) -> bool { throw std::runtime_error("decoder error"); });
+	AW_CHECK(WaitForJobState(jobs, failed, JobState::Failed));
+	AW_CHECK(WaitForJobState(jobs, threw, JobState::Failed));
+	AW_CHECK(GetJob(jobs, failed).error == "job reported failure");
+	AW_CHECK(GetJob(jobs, threw).error == "decoder error");
+	AW_CHECK(jobs.GetJobStateName(threw) == "failed");
+	AW_CHECK(jobs.GetJobStateName(12345) == "unknown");
+
+	// The observer sees every job that ran start and stop, on the job thread
+	std::scoped_lock lock(observedMutex);
+	AW_CHECK(observed.size() % 2 == 0);
+	for (size_t i = 0; i + 1 < observed.size(); i += 2) {
+		AW_CHECK(observed[i].first != 0 && observed[i + 1].first == 0 && observed[i + 1].second.empty());
+	}
+	AW_CHECK(observed.size() == 12); // Six jobs ran, the canceled queued ones never started
+	AW_CHECK(!observed.empty() && observed.front() == std::make_pair(blocker, std::string("blocker")));
+}
+#pragma endregion
+
+
+//////////////////////////
+// * QUALITY GOVERNOR * //
+//////////////////////////
+#pragma region Quality Governor
+// The governor is driven by a mocked clock: each window advances it by exactly WINDOW_MICROS and feeds
+// a fixed cost, so the smoothed load and the tier steps follow deterministically from the constants.
+namespace {
+	using Governor = AWHPerf::QualityGovernor;
+	static_assert(Governor::DEGRADE_WINDOWS == 2 && Governor::RESTORE_WINDOWS == 6, "Expected tiers below assume these");
+	static_assert(Governor::LOAD_SMOOTHING == 0.5 && Governor::RESTORE_HEADROOM == 0.6, "Expected tiers below assume these");
+
+	int64_t mockMicros = 1; // 0 is the governor's "no window yet" marker
+
+	int64_t MockClock() {
+		return mockMicros;
+	}
+
+	int RunWindow(Governor& governor, double loadPercent) {
+		governor.AddStageCost(Governor::STAGE_ANALYSIS, static_cast<int64_t>(Governor::WINDOW_MICROS * loadPercent / 100.0));
+		mockMicros += Governor::WINDOW_MICROS;
+		return governor.Evaluate();
+	}
+}
+
+AW_TEST(QualityGovernorTransitions) {
+	Governor governor(&MockClock);
+	governor.SetBudget(50.0);
+	AW_CHECK(governor.Evaluate() == Governor::TIER_FULL); // Opens the first window
+
+	// Partial windows are not evaluated
+	governor.AddStageCost(Governor::STAGE_ANALYSIS, Governor::WINDOW_MICROS);
+	mockMicros += Governor::WINDOW_MICROS / 2;
+	AW_CHECK(governor.Evaluate() == Governor::TIER_FULL);
+	AW_CHECK(governor.GetLoad() == 0.0);
+	mockMicros += Governor::WINDOW_MICROS / 2;
+	governor.Reset();
+	AW_CHECK(governor.Evaluate() == Governor::TIER_FULL);
+
+	// Full load, smoothed 50, 75, 87.5, ...: one step down every two windows over budget, capped at the lowest tier
+	constexpr int DEGRADE[] = { 0, 0, 1, 1, 2, 2, 3, 3 };
+	for (int expected : DEGRADE) {
+		AW_CHECK(RunWindow(governor, 100.0) == expected);
+	}
+
+	// Idle, smoothed 49.8, 24.9, ...: the first window is inside the hysteresis band, then one step up every six windows
+	for (int window = 1; window <= 19; ++window) {
+		const int expected = window < 7 ? 3 : window < 13 ? 2 : window < 19 ? 1 : 0;
+		AW_CHECK(RunWindow(governor, 0.0) == expected);
+	}
+
+	// A window inside the band resets the over budget count
+	for (int i = 0; i < 8; ++i) RunWindow(governor, 0.0);
+	AW_CHECK(RunWindow(governor, 110.0) == Governor::TIER_FULL); // 55
+	AW_CHECK(RunWindow(governor, 35.0) == Governor::TIER_FULL);  // 45, in band
+	AW_CHECK(RunWindow(governor, 110.0) == Governor::TIER_FULL); // 77.5, first over budget again
+	AW_CHECK(RunWindow(governor, 110.0) == Governor::TIER_REDUCED_FFT);
+
+	// A zero budget disables the governor and restores full quality at the next window
+	governor.SetBudget(0.0);
+	AW_CHECK(RunWindow(governor, 500.0) == Governor::TIER_FULL);
+
+	governor.SetBudget(50.0);
+	for (int i = 0; i < 6; ++i) RunWindow(governor, 200.0);
+	AW_CHECK(governor.GetTier() == Governor::TIER_LOW_OVERSAMPLING);
+	governor.Reset();
+	AW_CHECK(governor.GetTier() == Governor::TIER_FULL);
+	AW_CHECK(governor.GetLoad() == 0.0);
+}
+#pragma endregion
+
+
+///////////////////////////
+// * MEMORY ACCOUNTING * //
+///////////////////////////
+#pragma region Memory Accounting
+// A charge belongs to the job of the thread that makes it: other threads, like the real-time thread,
+// only reach the totals unless they join the job with a JobScope, as the batch workers do.
+AW_TEST(MemoryAccountingThreadJob) {
+	using AWHPerf::MemoryAccounting;
+	constexpr uint32_t JOB_ID = 1000;
+
+	MemoryAccounting::SetActiveJob(JOB_ID, "test");
+	AWHPerf::MemoryCharge jobCharge{ MemoryAccounting::CATEGORY_WAVEFORM };
+	jobCharge.Set(1000);
+
+	std::thread([] {
+		AW_CHECK(MemoryAccounting::GetActiveJob() == 0);
+		AWHPerf::MemoryCharge cacheCharge{ MemoryAccounting::CATEGORY_FFT_CACHE };
+		cacheCharge.Set(500);
+
+		const MemoryAccounting::JobScope memoryJob(JOB_ID);
+		AWHPerf::MemoryCharge workerCharge{ MemoryAccounting::CATEGORY_FULL_TRACK_BLOCKS };
+		workerCharge.Set(200);
+	}).join();
+
+	MemoryAccounting::Usage usage;
+	AW_CHECK(MemoryAccounting::GetJobUsage(JOB_ID, usage));
+	AW_CHECK(usage.peak[MemoryAccounting::CATEGORY_WAVEFORM] == 1000);
+	AW_CHECK(usage.peak[MemoryAccounting::CATEGORY_FULL_TRACK_BLOCKS] == 200);
+	AW_CHECK(usage.peak[MemoryAccounting::CATEGORY_FFT_CACHE] == 0);
+	AW_CHECK(usage.currentTotal == 1000);
+
+	MemoryAccounting::Usage total;
+	std::vector<MemoryAccounting::JobUsage> jobUsages;
+	MemoryAccounting::GetUsage(total, jobUsages);
+	AW_CHECK(total.peak[MemoryAccounting::CATEGORY_FFT_CACHE] == 500);
+	AW_CHECK(total.current[MemoryAccounting::CATEGORY_FFT_CACHE] == 0);
+	AW_CHECK(total.peakTotal == 1700);
+	AW_CHECK(total.currentTotal == 1000);
+
+	MemoryAccounting::SetActiveJob(0);
+	AW_CHECK(MemoryAccounting::GetActiveJob() == 0);
+}
+#pragma endregion
+
+
+////////////////////////
+// * WAVEFORM CACHE * //
+////////////////////////
+#pragma region Waveform Cache
+// The cache runs against a scratch directory under the system temp path, removed when the test ends.
+// Entries hold two channels of five values per point in Float64, a base level and one pyramid level.
+namespace {
+	using WaveformCache = AudioWizardWaveformCache;
+	constexpr size_t CACHE_VALUES_PER_CHANNEL = 5;
+	constexpr uint32_t CACHE_ENCODING_BITS = 64;
+	constexpr uint64_t CACHE_LIMIT_BYTES = 1 << 20;
+
+	class TempDirectory {
+	public:
+		explicit TempDirectory(std::string_view name) {
+			const auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+			path = std::filesystem::temp_directory_path() / ("aw_tests_" + std::string(name) + "_" + std::to_string(stamp));
+			std::filesystem::remove_all(path);
+		}
+		~TempDirectory() {
+			std::error_code ec;
+			std::filesystem::remove_all(path, ec);
+		}
+		TempDirectory(const TempDirectory&) = delete;
+		TempDirectory& operator=(const TempDirectory&) = delete;
+
+		std::filesystem::path path;
+	};
+
+	struct CacheTrack {
+		std::vector<double> base;
+		std::vector<double> level1;
+		WaveformCache::Entry entry;
+
+		explicit CacheTrack(double seed) {
+			for (size_t i = 0; i < 40; ++i) base.push_back(seed + static_cast<double>(i) * 0.25);
+			for (size_t i = 0; i < 20; ++i) level1.push_back(seed - static_cast<double>(i) * 0.5);
+
+			entry.channels = 2;
+			entry.pointsPerSecond = 20;
+			entry.encodingBits = CACHE_ENCODING_BITS;
+			entry.duration = seed;
+			entry.peakScale = 1.0;
+			entry.maxAmplitude = 0.5;
+			entry.levels = { { base.data(), base.size() }, { level1.data(), level1.size() } };
+		}
+	};
+
+	bool LoadCacheTrack(const WaveformCache& cache, const std::string& key, std::vector<std::vector<double>>* levels = nullptr,
+		double* duration = nullptr) {
+		return cache.Load(key, CACHE_ENCODING_BITS, CACHE_VALUES_PER_CHANNEL, [&](const WaveformCache::FileHeader& header, const char* view) {
+			if (duration) *duration = header.duration;
+			if (!levels) return;
+
+			levels->clear();
+			for (size_t level = 0; level < header.levelCount; ++level) {
+				const auto* values = reinterpret_cast<const double*>(view + header.levelOffsets[level]);
+				levels->emplace_back(values, values + header.levelElements[level]);
+			}
+		});
+	}
+
+	std::vector<char> ReadFileBytes(const std::filesystem::path& path) {
+		std::ifstream file(path, std::ios::binary);
+		return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+	}
+
+	void WriteFileBytes(const std::filesystem::path& path, const std::vector<char>& bytes) {
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	}
+
+	template <typename T>
+	void PatchFileBytes(std::vector<char>& bytes, size_t offset, T value) {
+		std::memcpy(bytes.data() + offset, &value, sizeof(T));
+	}
+}
+
+AW_TEST(WaveformCacheRoundTrip) {
+	TempDirectory directory("WaveformCacheRoundTrip");
+	WaveformCache cache(directory.path, CACHE_LIMIT_BYTES);
+	cache.SetCache(true, CACHE_LIMIT_BYTES);
+
+	const std::string key = "C:\\Music\\track.flac|0|123456|987654|20|0|64|1";
+	const CacheTrack track(3.0);
+	AW_CHECK(!LoadCacheTrack(cache, key));
+	AW_CHECK(cache.Store(key, track.entry));
+	AW_CHECK(std::filesystem::exists(cache.GetFilePath(key)));
+	AW_CHECK(cache.GetFilePath(key).extension() == WaveformCache::Config::CACHE_EXTENSION);
+
+	std::vector<std::vector<double>> levels;
+	double duration = 0.0;
+	AW_CHECK(LoadCacheTrack(cache, key, &levels, &duration));
+	AW_CHECK(duration == 3.0);
+	AW_CHECK(levels.size() == 2 && levels[0] == track.base && levels[1] == track.level1);
+
+	// The key is part of the file: a different key misses, even when it finds this file under its own name
+	const std::string otherKey = key + "|other";
+	AW_CHECK(cache.GetFilePath(otherKey) != cache.GetFilePath(key));
+	AW_CHECK(!LoadCacheTrack(cache, otherKey));
+	std::filesystem::copy_file(cache.GetFilePath(key), cache.GetFilePath(otherKey));
+	AW_CHECK(!LoadCacheTrack(cache, otherKey));
+	AW_CHECK(!cache.Load(key, 16, CACHE_VALUES_PER_CHANNEL, [](const WaveformCache::FileHeader&, const char*) {}));
+
+	// Storing the same key replaces the entry
+	const CacheTrack replacement(7.0);
+	AW_CHECK(cache.Store(key, replacement.entry));
+	AW_CHECK(LoadCacheTrack(cache, key, &levels, &duration));
+	AW_CHECK(duration == 7.0 && levels[0] == replacement.base);
+
+	// Clear removes every entry but leaves unrelated files alone
+	WriteFileBytes(directory.path / "notes.txt", { 'x' });
+	cache.Clear();
+	AW_CHECK(!std::filesystem::exists(cache.GetFilePath(key)));
+	AW_CHECK(!std::filesystem::exists(cache.GetFilePath(otherKey)));
+	AW_CHECK(std::filesystem::exists(directory.path / "notes.txt"));
+	AW_CHECK(!LoadCacheTrack(cache, key));
+}
+
+AW_TEST(WaveformCacheEviction) {
+	TempDirectory directory("WaveformCacheEviction");
+	WaveformCache cache(directory.path, CACHE_LIMIT_BYTES);
+	cache.SetCache(true, CACHE_LIMIT_BYTES);
+
+	const CacheTrack track(1.0);
+	AW_CHECK(cache.Store("a", track.entry));
+	const uint64_t entryBytes = std::filesystem::file_size(cache.GetFilePath("a"));
+	AW_CHECK(cache.Store("b", track.entry));
+
+	// Room for two entries: a is older than b, but a load refreshes it, so b is the least recently used
+	const auto now = std::filesystem::file_time_type::clock::now();
+	std::filesystem::last_write_time(cache.GetFilePath("a"), now - std::chrono::hours(3));
+	std::filesystem::last_write_time(cache.GetFilePath("b"), now - std::chrono::hours(2));
+	cache.SetCache(true, entryBytes * 5 / 2);
+	AW_CHECK(LoadCacheTrack(cache, "a"));
+	AW_CHECK(cache.Store("c", track.entry));
+	AW_CHECK(std::filesystem::exists(cache.GetFilePath("a")));
+	AW_CHECK(!std::filesystem::exists(cache.GetFilePath("b")));
+	AW_CHECK(std::filesystem::exists(cache.GetFilePath("c")));
+
+	// Lowering the limit evicts right away, and a store always keeps the entry it just wrote
+	cache.SetCache(true, entryBytes);
+	AW_CHECK(std::filesystem::exists(cache.GetFilePath("a")) != std::filesystem::exists(cache.GetFilePath("c")));
+	cache.SetCache(true, 1);
+	AW_CHECK(!std::filesystem::exists(cache.GetFilePath("a")) && !std::filesystem::exists(cache.GetFilePath("c")));
+	AW_CHECK(cache.Store("d", track.entry));
+	AW_CHECK(LoadCacheTrack(cache, "d"));
+}
+
+AW_TEST(WaveformCacheCorruption) {
+	TempDirectory directory("WaveformCacheCorruption");
+	WaveformCache cache(directory.path, CACHE_LIMIT_BYTES);
+	cache.SetCache(true, CACHE_LIMIT_BYTES);
+
+	using Header = WaveformCache::FileHeader;
+	const std::string key = "track";
+	const CacheTrack track(2.0);
+	AW_CHECK(cache.Store(key, track.entry));
+
+	const std::filesystem::path filePath = cache.GetFilePath(key);
+	const std::vector<char> original = ReadFileBytes(filePath);
+	AW_CHECK(original.size() > sizeof(Header) + key.size());
+
+	struct Corruption {
+		const char* name;
+		std::function<void(std::vector<char>&)> apply;
+	};
+
+	const Corruption corruptions[] = {
+		{ "empty file", [](std::vector<char>& bytes) { bytes.clear(); } },
+		{ "truncated header", [](std::vector<char>& bytes) { bytes.resize(sizeof(Header) - 1); } },
+		{ "header and key only", [&](std::vector<char>& bytes) { bytes.resize(sizeof(Header) + key.size()); } },
+		{ "truncated last level", [](std::vector<char>& bytes) { bytes.pop_back(); } },
+		{ "magic", [](std::vector<char>& bytes) { bytes[offsetof(Header, magic)] = 'X'; } },
+		{ "version", [](std::vector<char>& bytes) { PatchFileBytes<uint32_t>(bytes, offsetof(Header, version), WaveformCache::Config::CACHE_FORMAT_VERSION + 1); } },
+		{ "header size", [](std::vector<char>& bytes) { PatchFileBytes<uint32_t>(bytes, offsetof(Header, headerSize), sizeof(Header) - 8); } },
+		{ "key length", [&](std::vector<char>& bytes) { PatchFileBytes<uint32_t>(bytes, offsetof(Header, keyLength), static_cast<uint32_t>(key.size() + 1)); } },
+		{ "key bytes", [](std::vector<char>& bytes) { bytes[sizeof(Header)] ^= 0x20; } },
+		{ "zero channels", [](std::vector<char>& bytes) { PatchFileBytes<uint32_t>(bytes, offsetof(Header, channels), 0); } },
+		{ "encoding", [](std::vector<char>& bytes) { PatchFileBytes<uint32_t>(bytes, offsetof(Header, encodingBits), 16); } },
+		{ "zero levels", [](std::vector<char>& bytes) { PatchFileBytes<uint32_t>(bytes, offsetof(Header, levelCount), 0); } },
+		{ "too many levels", [](std::vector<char>& bytes) {
+			PatchFileBytes<uint32_t>(bytes, offsetof(Header, levelCount), static_cast<uint32_t>(WaveformCache::Config::MAX_LEVELS + 1));
+		} },
+		{ "partial point", [](std::vector<char>& bytes) { PatchFileBytes<uint64_t>(bytes, offsetof(Header, levelElements) + sizeof(uint64_t), 7); } },
+		{ "offset past end", [](std::vector<char>& bytes) { PatchFileBytes<uint64_t>(bytes, offsetof(Header, levelOffsets), bytes.size() + 8); } },
+		{ "misaligned offset", [](std::vector<char>& bytes) { PatchFileBytes<uint64_t>(bytes, offsetof(Header, levelOffsets), sizeof(Header) + 1); } },
+		{ "overflowing size", [](std::vector<char>& bytes) { PatchFileBytes<uint64_t>(bytes, offsetof(Header, levelElements), uint64_t(1) << 62); } }
+	};
+
+	for (const auto& corruption : corruptions) {
+		std::vector<char> bytes = original;
+		corruption.apply(bytes);
+		WriteFileBytes(filePath, bytes);
+
+		bool isRead = false;
+		const bool isLoaded = cache.Load(key, CACHE_ENCODING_BITS, CACHE_VALUES_PER_CHANNEL,
+			[&isRead](const Header&, const char*) { isRead = true; }
+		);
+		if (!AW_CHECK(!isLoaded && !isRead)) {
+			std::cerr << "  accepted corruption: " << corruption.name << '\n';
+		}
+	}
+
+	WriteFileBytes(filePath, original);
+	AW_CHECK(LoadCacheTrack(cache, key));
+}
+#pragma endregion
+
+///////////////////////////
+// * SHARED AUDIO RING * //
+///////////////////////////
+#pragma region Shared Audio Ring
+// The producer and the reader are two mappings of the same named region in this process, the same path an
+// external visualizer takes. Names carry the process start time so parallel ctest runs never share a ring.
+namespace {
+	using SharedAudioRing = AWHAudioBuffer::SharedAudioRing;
+
+	std::string GetRingName(std::string_view test) {
+		return "AW_Test_" + std::string(test) + "_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+	}
+
+	std::vector<audioType> CreateRingFrames(size_t frames, uint32_t channels, size_t firstFrame) {
+		std::vector<audioType> data(frames * channels);
+		for (size_t f = 0; f < frames; ++f) {
+			for (uint32_t ch = 0; ch < channels; ++ch) {
+				data[f * channels + ch] = static_cast<audioType>((firstFrame + f) % 1000) / 1000.0 + ch * 0.0001;
+			}
+		}
+		return data;
+	}
+
+	bool IsRingFrame(const float* frame, uint32_t channels, size_t frameIndex) {
+		for (uint32_t ch = 0; ch < channels; ++ch) {
+			const auto expected = static_cast<float>(static_cast<audioType>(frameIndex % 1000) / 1000.0 + ch * 0.0001);
+			if (frame[ch] != expected) return false;
+		}
+		return true;
+	}
+}
+
+AW_TEST(SharedAudioRingRoundTrip) {
+	const std::string name = GetRingName("RoundTrip");
+	SharedAudioRing writer;
+	SharedAudioRing reader;
+	SharedAudioRing::ReaderState state;
+	uint32_t channels = 0;
+	uint32_t sampleRate = 0;
+	std::vector<float> out(SharedAudioRing::MIN_CAPACITY_FRAMES * SharedAudioRing::MAX_CHANNELS);
+
+	AW_CHECK(!reader.Attach(name));
+	AW_CHECK(writer.Create(name, 5000));
+	AW_CHECK(writer.IsOpen() && writer.GetName() == name);
+	AW_CHECK(reader.Attach(name));
+
+	// A new reader syncs to the live edge first, then sees every frame written after that
+	AW_CHECK(reader.Read(state, out.data(), 512, channels, sampleRate) == 0);
+	auto data = CreateRingFrames(300, 2, 0);
+	writer.Write(data.data(), 300, 2, 48000);
+	AW_CHECK(reader.Read(state, out.data(), 200, channels, sampleRate) == 0); // The format changed from the empty ring
+	writer.Write(data.data(), 300, 2, 48000);
+	AW_CHECK(reader.Read(state, out.data(), 200, channels, sampleRate) == 200);
+	AW_CHECK(channels == 2 && sampleRate == 48000);
+	AW_CHECK(IsRingFrame(out.data(), 2, 0) && IsRingFrame(out.data() + 199 * 2, 2, 199));
+	AW_CHECK(reader.Read(state, out.data(), 512, channels, sampleRate) == 100);
+	AW_CHECK(IsRingFrame(out.data(), 2, 200) && IsRingFrame(out.data() + 99 * 2, 2, 299));
+	AW_CHECK(reader.Read(state, out.data(), 512, channels, sampleRate) == 0);
+
+	// Channels above MAX_CHANNELS are dropped, a format change resyncs the reader
+	data = CreateRingFrames(10, 10, 0);
+	writer.Write(data.data(), 10, 10, 44100);
+	AW_CHECK(reader.Read(state, out.data(), 512, channels, sampleRate) == 0);
+	writer.Write(data.data(), 10, 10, 44100);
+	AW_CHECK(reader.Read(state, out.data(), 512, channels, sampleRate) == 10);
+	AW_CHECK(channels == SharedAudioRing::MAX_CHANNELS && sampleRate == 44100);
+	AW_CHECK(IsRingFrame(out.data() + 9 * channels, channels, 9));
+
+	// The owner removes the name on close, readers that are still attached keep their mapping
+	writer.Close();
+	AW_CHECK(!writer.IsOpen());
+	AW_CHECK(reader.IsOpen());
+	SharedAudioRing lateReader;
+	AW_CHECK(!lateReader.Attach(name));
+	reader.Close();
+	AW_CHECK(reader.Read(state, out.data(), 512, channels, sampleRate) == 0);
+}
+
+AW_TEST(SharedAudioRingOverrun) {
+	const std::string name = GetRingName("Overrun");
+	SharedAudioRing writer;
+	SharedAudioRing reader;
+	SharedAudioRing::ReaderState state;
+	uint32_t channels = 0;
+	uint32_t sampleRate = 0;
+
+	// Capacities are rounded up to a power of two within the limits
+	AW_CHECK(writer.Create(name, 1));
+	AW_CHECK(reader.Attach(name));
+	constexpr size_t capacity = SharedAudioRing::MIN_CAPACITY_FRAMES;
+	std::vector<float> out(capacity * 2 * SharedAudioRing::MAX_CHANNELS);
+
+	auto data = CreateRingFrames(1, 1, 0);
+	writer.Write(data.data(), 1, 1, 48000);
+	AW_CHECK(reader.Read(state, out.data(), 1, channels, sampleRate) == 0);
+	size_t written = 0;
+
+	// A reader that fell more than a ring behind gets the newest capacity frames
+	for (int block = 0; block < 5; ++block) {
+		data = CreateRingFrames(1000, 1, written);
+		writer.Write(data.data(), 1000, 1, 48000);
+		written += 1000;
+	}
+	AW_CHECK(reader.Read(state, out.data(), out.size(), channels, sampleRate) == capacity);
+	AW_CHECK(IsRingFrame(out.data(), 1, written - capacity) && IsRingFrame(out.data() + capacity - 1, 1, written - 1));
+
+	// A block larger than the ring keeps only its tail
+	data = CreateRingFrames(capacity + 100, 1, written);
+	writer.Write(data.data(), capacity + 100, 1, 48000);
+	written += capacity + 100;
+	AW_CHECK(reader.Read(state, out.data(), out.size(), channels, sampleRate) == capacity);
+	AW_CHECK(IsRingFrame(out.data(), 1, written - capacity));
+
+#ifndef _WIN32
+	// A header that describes more samples than the mapping holds is rejected
+	const int descriptor = shm_open(("/" + name).c_str(), O_RDWR, 0);
+	AW_CHECK(descriptor >= 0);
+	if (descriptor >= 0) {
+		void* view = mmap(nullptr, sizeof(SharedAudioRing::Header), PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+		AW_CHECK(view != MAP_FAILED);
+		if (view != MAP_FAILED) {
+			static_cast<SharedAudioRing::Header*>(view)->capacityFrames = capacity * 4;
+			SharedAudioRing corrupt;
+			AW_CHECK(!corrupt.Attach(name));
+			static_cast<SharedAudioRing::Header*>(view)->capacityFrames = capacity;
+			AW_CHECK(corrupt.Attach(name));
+			munmap(view, sizeof(SharedAudioRing::Header));
+		}
+		close(descriptor);
+	}
+#endif
+}
+#pragma endregion
+
+
+/////////////////////
+// * CONFORMANCE * //
+/////////////////////
+#pragma region Conformance
+// Runs the EBU Tech 3341/3342 and ITU-R BS.2217 cases through both engines on a job thread.
+// Each failed check is printed by RunConformance with the measured and expected value.
+AW_TEST(Conformance) {
+	AudioWizardJobs jobs;
+	std::string json;
+
+	const uint32_t id = jobs.SubmitJob(AudioWizardConformance::Config::JOB_CONFORMANCE, AudioWizardJobs::Config::DEF_PRIORITY,
+		[&json](const AudioWizardJobs::JobContext& job) { return AudioWizardConformance::RunConformance(job, json); }
+	);
+
+	AudioWizardJobs::JobInfo info;
+	while (jobs.GetJobInfo(id, info) && (info.state == AudioWizardJobs::JobState::Queued || info.state == AudioWizardJobs::JobState::Running)) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	AW_CHECK(info.state == AudioWizardJobs::JobState::Completed);
+	AW_CHECK(json.find("\"passed\":true,") != std::string::npos);
+	AW_CHECK(json.find("\"failures\":0,") != std::string::npos);
+	AW_CHECK(json.find("\"passed\":false") == std::string::npos);
+}
+#pragma endregion
+
+
+//////////////
+// * MAIN * //
+//////////////
+#pragma region Main
+int main(int argc, char* argv[]) {
+	const auto& tests = Tests();
+
+	if (argc < 2) {
+		for (const auto& [name, test] : tests) {
+			std::cout << name << '\n';
+		}
+		return 0;
+	}
+
+	const auto test = tests.find(std::string_view(argv[1]));
+	if (test == tests.end()) {
+		std::cerr << "aw_tests: unknown test " << argv[1] << '\n';
+		return 2;
+	}
+
+	test->second();
+	return failedChecks == 0 ? 0 : 1;
+}
+#pragma endregion
@@ -57,6 +57,7 @@ FOOBAR2000_IMPLEMENT_CFG_VAR_DOWNGRADE;
 /////////////////////////////
 #pragma region Main Initialization
 void AudioWizard::InitAudioWizard() {
+	audioWizardJobs = std::make_unique<AudioWizardJobs>(&AWHPerf::MemoryAccounting::SetActiveJob);
 	audioWizardMain = std::make_unique<AudioWizardMain>();
 	audioWizardPeakmeter = std::make_unique<AudioWizardPeakmeter>();
 	audioWizardWaveform = std::make_unique<AudioWizardWaveform>();
@@ -69,6 +70,7 @@ void AudioWizard::QuitAudioWizard() {
 	audioWizardMain->StopFullTrackAudioProcessor();
 	audioWizardMain->StopRealTimeAudioProcessor();
 
+	audioWizardJobs.reset(); // Joins the job worker before the modules its jobs use go away
 	audioWizardMain.reset();
 	audioWizardPeakmeter.reset();
 	audioWizardWaveform.reset();
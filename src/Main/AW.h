@@ -10,11 +10,16 @@
 
 
 #pragma once
+#include "AW_Helpers.h"
+#include "AW_Jobs.h"
+#include "AW_WaveformCache.h"
+#ifndef AW_HEADLESS
 #include "AW_DialogFullTrack.h"
 #include "AW_DialogRealTime.h"
 #include "AW_Main.h"
 #include "AW_Peakmeter.h"
 #include "AW_Waveform.h"
+#endif
 
 
 ////////////////////////////////////////
@@ -29,6 +34,15 @@ inline constexpr const char* AW_COMPONENT_VERSION = "0.6.0";
 // * AUDIO WIZARD * //
 //////////////////////
 #pragma region Audio Wizard
+#ifdef AW_HEADLESS
+class AudioWizard { // The headless build only has the job scheduler, started on first use
+public:
+	static AudioWizardJobs* Jobs() {
+		static AudioWizardJobs jobs(&AWHPerf::MemoryAccounting::SetActiveJob);
+		return &jobs;
+	}
+};
+#else
 class AudioWizard {
 public:
 	AudioWizard() = default;
@@ -39,6 +53,7 @@ public:
 	static void QuitAudioWizard();
 
 	// * PUBLIC GETTERS - SINGLETON ACCESSORS * //
+	static AudioWizardJobs* Jobs() { return audioWizardJobs.get(); }
 	static AudioWizardMain* Main() { return audioWizardMain.get(); }
 	static AudioWizardPeakmeter* Peakmeter() { return audioWizardPeakmeter.get(); }
 	static AudioWizardWaveform* Waveform() { return audioWizardWaveform.get(); }
@@ -51,6 +66,7 @@ public:
 	}
 
 private:
+	static inline std::unique_ptr<AudioWizardJobs> audioWizardJobs = nullptr;
 	static inline std::unique_ptr<AudioWizardMain> audioWizardMain = nullptr;
 	static inline std::unique_ptr<AudioWizardPeakmeter> audioWizardPeakmeter = nullptr;
 	static inline std::unique_ptr<AudioWizardWaveform> audioWizardWaveform = nullptr;
@@ -59,4 +75,5 @@ private:
 
 	friend class AudioWizardMain;
 };
+#endif
 #pragma endregion
@@ -50,6 +50,8 @@ AudioWizardAnalysisInterpolator::AudioWizardAnalysisInterpolator(WindowType wind
 	for (auto& channel_z : interpolation.z) {
 		channel_z.resize(interpolation.delay, 0.0);
 	}
+
+	block.reserve(BLOCK_SIZE * interpolation.factor * interpolation.channels);
 }
 
 size_t AudioWizardAnalysisInterpolator::ProcessInterpolation(size_t frames, const audioType* in, audioType* out) {
@@ -76,9 +78,21 @@ size_t AudioWizardAnalysisInterpolator::ProcessInterpolation(size_t frames, cons
 	return frames * interpolation.factor;
 }
 
-double AudioWizardAnalysisInterpolator::CalculateTruePeakLinear(const ChunkData& chkData, AudioWizardAnalysisInterpolator* interp) {
+void AudioWizardAnalysisInterpolator::ResetInterpolation() {
+	for (auto& channel_z : interpolation.z) {
+		std::fill(channel_z.begin(), channel_z.end(), 0.0);
+	}
+	interpolation.zi = 0;
+}
+
+double AudioWizardAnalysisInterpolator::CalculateTruePeakLinear(const ChunkData& chkData, AudioWizardAnalysisInterpolator* interp,
+	std::vector<double>* channelPeaks) {
 	const size_t totalOriginalSamples = chkData.frames * chkData.channels;
 
+	if (channelPeaks) {
+		channelPeaks->assign(chkData.channels, 0.0);
+	}
+
 	if (totalOriginalSamples == 0 || chkData.data == nullptr) {
 		return 0.0;
 	}
@@ -86,30 +100,52 @@ double AudioWizardAnalysisInterpolator::CalculateTruePeakLinear(const ChunkData&
 	const audioType* const data = chkData.data;
 	audioType truePeak = 0.0;
 
+	// Per-channel peaks, original and interpolated samples are both interleaved by channel
+	auto accumulateChannelPeaks = [&](const audioType* samples, size_t count) {
+		double* peaks = channelPeaks->data();
+		for (size_t i = 0; i < count; i += chkData.channels) {
+			for (size_t ch = 0; ch < chkData.channels; ++ch) {
+				peaks[ch] = std::max(peaks[ch], static_cast<double>(std::abs(samples[i + ch])));
+			}
+		}
+	};
+
 	// Compute peak of original samples
-	for (size_t i = 0; i < totalOriginalSamples; ++i) {
-		truePeak = std::max(truePeak, std::abs(data[i]));
+	if (channelPeaks) {
+		accumulateChannelPeaks(data, totalOriginalSamples);
+		truePeak = static_cast<audioType>(*std::max_element(channelPeaks->begin(), channelPeaks->end()));
+	}
+	else {
+		for (size_t i = 0; i < totalOriginalSamples; ++i) {
+			truePeak = std::max(truePeak, std::abs(data[i]));
+		}
 	}
 
 	if (!interp || interp->interpolation.channels != chkData.channels || interp->interpolation.factor <= 0) {
 		return truePeak;
 	}
 
-	// Process interpolation
-	const size_t BLOCK_SIZE = 4096;
-	std::vector<audioType> block;
-	block.reserve(BLOCK_SIZE * interp->interpolation.factor * chkData.channels);
+	// Process interpolation, reusing the interpolator's scratch block
+	std::vector<audioType>& block = interp->block;
 
 	for (size_t offset = 0; offset < chkData.frames; offset += BLOCK_SIZE) {
 		const size_t block_frames = std::min(BLOCK_SIZE, chkData.frames - offset);
 		block.resize(block_frames * interp->interpolation.factor * chkData.channels);
 		interp->ProcessInterpolation(block_frames, data + offset * chkData.channels, block.data());
 		// Find peak in interpolated samples
+		if (channelPeaks) {
+			accumulateChannelPeaks(block.data(), block.size());
+			continue;
+		}
 		for (audioType sample : block) {
 			truePeak = std::max(truePeak, std::abs(sample));
 		}
 	}
 
+	if (channelPeaks) {
+		truePeak = static_cast<audioType>(*std::max_element(channelPeaks->begin(), channelPeaks->end()));
+	}
+
 	return truePeak;
 }
 
@@ -293,19 +329,35 @@ void AudioWizardAnalysisFilter::ProcessKWeightedChunk(const ChunkData& chkData,
 	}
 }
 
-void AudioWizardAnalysisFilter::InitInterpolation(const ChunkData& chkData, FilterData& ftData) {
-	unsigned int oversamplingFactor = (chkData.sampleRate < 96000.0) ? 4 : (chkData.sampleRate < 192000.0) ? 2 : 1;
+void AudioWizardAnalysisFilter::InitInterpolation(const ChunkData& chkData, FilterData& ftData, bool withReducedOversampling) {
+	const unsigned int oversamplingFactor = (chkData.sampleRate < 96000.0) ? 4 : (chkData.sampleRate < 192000.0) ? 2 : 1;
 	const unsigned int tapsPerPhase = 48; // 32, 40, 48, 56, 64
-	const unsigned int totalTaps = oversamplingFactor * tapsPerPhase + 1; // +1 making it odd for filter symmetry
 
-	if (oversamplingFactor > 1) {
-		ftData.interp = std::make_unique<AudioWizardAnalysisInterpolator>(
-			AudioWizardAnalysisInterpolator::WindowType::KAISER, totalTaps, oversamplingFactor, chkData.channels
+	auto createInterpolator = [&](unsigned int factor) -> std::unique_ptr<AudioWizardAnalysisInterpolator> {
+		if (factor <= 1) return nullptr;
+		const unsigned int totalTaps = factor * tapsPerPhase + 1; // +1 making it odd for filter symmetry
+		return std::make_unique<AudioWizardAnalysisInterpolator>(
+			AudioWizardAnalysisInterpolator::WindowType::KAISER, totalTaps, factor, chkData.channels
 		);
+	};
+
+	// The governor's low oversampling tier limits true peak to 2x, that interpolator is built here
+	// so a tier change on the audio thread only switches the pointer
+	ftData.interp = createInterpolator(oversamplingFactor);
+	ftData.interpReduced = withReducedOversampling && oversamplingFactor > 2 ? createInterpolator(2) : nullptr;
+	ftData.activeInterp = nullptr;
+	SelectInterpolation(ftData, oversamplingFactor);
+}
+
+void AudioWizardAnalysisFilter::SelectInterpolation(FilterData& ftData, unsigned int maxOversampling) {
+	AudioWizardAnalysisInterpolator* selected = maxOversampling <= 2 && ftData.interpReduced ? ftData.interpReduced.get() : ftData.interp.get();
+	ftData.maxOversampling = maxOversampling;
+
+	// The switched-in interpolator's delay line holds samples from before it was last switched out
+	if (selected != ftData.activeInterp && selected) {
+		selected->ResetInterpolation();
 	}
-	else {
-		ftData.interp.reset();
-	}
+	ftData.activeInterp = selected;
 }
 #pragma endregion
 
@@ -477,8 +529,8 @@ double AudioWizardAnalysisFullTrack::GetDynamicRangeFull(const FullTrackData& ft
 		return 0.0;
 	}
 
-	constexpr double MIN_RMS_LINEAR = 1e-5;  // Minimum RMS to avoid log(0)
-	constexpr double TOP_RMS_FRACTION = 0.2; // Top 20% RMS blocks per DR14 spec
+	static constexpr double MIN_RMS_LINEAR = 1e-5;  // Minimum RMS to avoid log(0)
+	static constexpr double TOP_RMS_FRACTION = 0.2; // Top 20% RMS blocks per DR14 spec
 	std::vector<size_t> drIndices;
 	drIndices.reserve(std::max(ftData.originalRMSLinearLeft.size(), ftData.originalRMSLinearRight.size()));
 
@@ -809,7 +861,8 @@ void AudioWizardAnalysisFullTrack::ProcessDynamicsLoudnessAdaptation(FullTrackDa
 	double tau = std::clamp(baseTau, 80.0, 200.0);
 
 	double frequencyFactor = std::log1p(std::accumulate(dynamics.frequencyPowers.begin(), dynamics.frequencyPowers.end(), 0.0) / (dynamics.blockCount + 1e-12) / 0.001);
-	double entropy = AWHMath::CalculateEntropy({ dynamics.transientScore, dynamics.spectralFlatnessMean, dynamics.spectralFluxMean });
+	const std::array<double, 3> features = { dynamics.transientScore, dynamics.spectralFlatnessMean, dynamics.spectralFluxMean };
+	double entropy = AWHMath::CalculateEntropy(features);
 	double adaptStrength = std::clamp(0.7 * (1.0 - entropy) + 0.3 * frequencyFactor, 0.0, 1.0) * dynamics.varianceScale;
 
 	for (size_t i = 0; i < dynamics.blockCount; ++i) {
@@ -902,12 +955,13 @@ void AudioWizardAnalysisFullTrack::ProcessDynamicsCognitiveLoudness(const FullTr
 }
 
 void AudioWizardAnalysisFullTrack::ProcessDynamicsTransientBoostsDetection(FullTrackDataDynamics& dynamics) {
-	std::vector<double> loudnessNormalized = AWHAudioDSP::NormalizeLoudness(dynamics.adaptedLoudness, dynamics.blockDurationMs, 500.0);
+	std::vector<double> loudnessNormalized;
+	AWHAudioDSP::NormalizeLoudness(dynamics.adaptedLoudness, dynamics.blockDurationMs, 500.0, loudnessNormalized);
 
-	dynamics.transientBoosts = AWHAudioDynamics::DetectTransients(loudnessNormalized,
+	AWHAudioDynamics::DetectTransients(loudnessNormalized,
 		dynamics.blockDurationMs, dynamics.harmonicComplexityFactor, dynamics.maskingFactor,
 		dynamics.spectralFlux, dynamics.spectralCentroid, dynamics.spectralFlatness,
-		dynamics.genreFactor, dynamics.varianceScale
+		dynamics.genreFactor, dynamics.varianceScale, dynamics.transientBoosts
 	);
 
 	dynamics.transientDensity = std::count_if(dynamics.transientBoosts.begin(), dynamics.transientBoosts.end(),
@@ -937,9 +991,8 @@ void AudioWizardAnalysisFullTrack::ProcessDynamicsTransientBoostsAdjustment(Full
 
 void AudioWizardAnalysisFullTrack::ProcessDynamicsSpread(FullTrackDataDynamics& dynamics) {
 	// 1. Normalize loudness with 3000ms time constant
-	const std::vector<double> loudnessNormalized = AWHAudioDSP::NormalizeLoudness(
-		dynamics.adaptedLoudness, dynamics.blockDurationMs, 3000.0
-	);
+	std::vector<double> loudnessNormalized;
+	AWHAudioDSP::NormalizeLoudness(dynamics.adaptedLoudness, dynamics.blockDurationMs, 3000.0, loudnessNormalized);
 
 	// 2. Filter loudness values above perceptual threshold (-80 dB)
 	std::vector<double> validLoudness;
@@ -968,7 +1021,8 @@ void AudioWizardAnalysisFullTrack::ProcessDynamicsSpread(FullTrackDataDynamics&
 	const double dynamicThreshold = std::max(dynamics.integratedLUFS - 22.0 + 4.0 * dynamics.genreFactor, -80.0);
 	const double preMaskingMs = 20.0 + 30.0 * dynamics.varianceScale; // 20–50 ms
 	const double postMaskingMs = 100.0 + 140.0 * dynamics.varianceScale; // 100–240 ms
-	const std::vector<double> temporalWeights = AWHAudioDynamics::ComputeTemporalWeights(loudnessNormalized, dynamics.blockDurationMs, preMaskingMs, postMaskingMs, dynamics.variance);
+	std::vector<double> temporalWeights;
+	AWHAudioDynamics::ComputeTemporalWeights(loudnessNormalized, dynamics.blockDurationMs, preMaskingMs, postMaskingMs, dynamics.variance, temporalWeights);
 
 	// 6. Define adaptive window sizes based on rhythm and genre
 	const double rhythmFactor = 1.0 + 0.4 * (dynamics.spectralFluxMean / 0.15) * dynamics.genreFactor;
@@ -1079,6 +1133,9 @@ void AudioWizardAnalysisFullTrack::ProcessDynamicsFactors(FullTrackData& ftData)
 	std::vector<double> barkBandPower(AWHAudioFFT::BARK_BAND_NUMBER, 0.0);
 	std::vector<std::complex<double>> fftOutput(ftData.fftSize);
 
+	AW_STAGE_TIMER(timer, ftData.profile);
+	AW_STAGE_COUNT(ftData.profile, blocks, numBlocks);
+
 	// Process each block
 	for (size_t i = 0; i < numBlocks; ++i) {
 		const size_t index = indexStart + i;
@@ -1102,6 +1159,7 @@ void AudioWizardAnalysisFullTrack::ProcessDynamicsFactors(FullTrackData& ftData)
 		AWHAudioDSP::ExtractStereoChannels(block.data(), ftData.stepSize, ftData.channels, leftChannel, rightChannel);
 		ftData.binauralFactor[index] = AWHAudioDynamics::ComputeSpatialScore(leftChannel, rightChannel, ftData.stepSize, ftData.sampleRate);
 		// ftData.binauralFactor[index] = 1.0;
+		AW_STAGE_LAP(timer, STAGE_SPATIAL);
 
 		// Energy computation
 		double energy;
@@ -1117,26 +1175,31 @@ void AudioWizardAnalysisFullTrack::ProcessDynamicsFactors(FullTrackData& ftData)
 			ftData.spectralCentroid[index] = 0.0;
 			ftData.spectralFlatness[index] = 1.0;
 			ftData.spectralFlux[index] = 0.0;
+			AW_STAGE_LAP(timer, STAGE_FFT);
 			continue;
 		}
 
 		// FFT and power spectrum
 		AWHAudioFFT::ComputeFFTGeneral(blockSamples, fftOutput);
 		AWHAudioFFT::ComputePowerSpectrum(fftOutput.data(), ftData.fftSize, ftData.stepSize, powerSpectrum);
+		AW_STAGE_LAP(timer, STAGE_FFT);
 		AWHAudioFFT::MapPowerSpectrumToBarkBands(powerSpectrum, ftData.fftSize, ftData.sampleRate, barkBandPower);
 		ftData.bandPowers[index] = barkBandPower;
+		AW_STAGE_LAP(timer, STAGE_BARK_MAPPING);
 
 		// Psychoacoustic factors
 		ftData.criticalBandFactor[index] = AWHAudioFFT::ComputeCriticalBandsFromPowerSpectrum(powerSpectrum, ftData.fftSize, ftData.sampleRate, barkBandPower);
 		ftData.harmonicComplexityFactor[index] = AWHAudioFFT::ComputeHarmonicComplexity(barkBandPower);
 		ftData.maskingFactor[index] = AWHAudioFFT::ComputeFrequencyMaskingFromPowerSpectrum(powerSpectrum, ftData.fftSize, ftData.sampleRate, barkBandPower);
 		ftData.frequencyPowers[index] = AWHAudioFFT::ComputePerceptualFrequencyPower(barkBandPower, ftData.barkWeights);
+		AW_STAGE_LAP(timer, STAGE_PSYCHOACOUSTIC);
 
 		// Spectral features
 		ftData.spectralCentroid[index] = AWHAudioFFT::ComputeSpectralCentroid(barkBandPower, ftData.sampleRate);
 		ftData.spectralFlatness[index] = AWHAudioFFT::ComputeSpectralFlatness(barkBandPower, AWHAudioFFT::BARK_BAND_NUMBER);
 		ftData.spectralFlux[index] = AWHAudioFFT::ComputeSpectralFlux(barkBandPower, ftData.bandPowersPrevious, AWHAudioFFT::BARK_BAND_NUMBER);
 		ftData.bandPowersPrevious = barkBandPower; // Update for next iteration
+		AW_STAGE_LAP(timer, STAGE_SPECTRAL);
 
 		// ftData.spectralCentroid[index] = 4000.0;
 		// ftData.spectralFlatness[index] = 1.0;
@@ -1465,6 +1528,10 @@ void AudioWizardAnalysisFullTrack::ProcessFullTrackChunk(const ChunkData& chkDat
 	const auto samplesPerChunk = chunkSeconds * static_cast<size_t>(ftData.sampleRate) * ftData.channels;
 	size_t remainingSamples = chkData.frames * ftData.channels;
 
+	AW_STAGE_TIMER(timer, ftData.profile);
+	AW_STAGE_COUNT(ftData.profile, chunks, 1);
+	AW_STAGE_COUNT(ftData.profile, frames, chkData.frames);
+
 	for (size_t offset = 0; offset < remainingSamples; offset += samplesPerChunk) {
 		size_t samplesToProcess = std::min(samplesPerChunk, remainingSamples - offset);
 		size_t framesToProcess = samplesToProcess / ftData.channels;
@@ -1477,20 +1544,53 @@ void AudioWizardAnalysisFullTrack::ProcessFullTrackChunk(const ChunkData& chkDat
 		std::vector<double> chunkBuffer;
 		AudioWizardAnalysisFilter::ProcessKWeightedChunk(subChunk, ftData.filterData, chunkBuffer);
 		ProcessKWeightedSum(ftData, chunkBuffer);
+		AW_STAGE_LAP(timer, STAGE_K_WEIGHTING);
 
 		// Process Loudness
 		ProcessShortTermLUFS(ftData);
 		ProcessIntegratedLUFS(ftData);
+		AW_STAGE_LAP(timer, STAGE_LOUDNESS);
 
 		// Process Original Audio
 		ProcessOriginalSamples(subChunk, ftData);
 		ProcessOriginalBlocks(ftData);
+		AW_STAGE_LAP(timer, STAGE_ORIGINAL_SAMPLES);
 		ProcessSamplePeakMax(subChunk, ftData);
+		AW_STAGE_LAP(timer, STAGE_SAMPLE_PEAK);
 		ProcessTruePeakMax(subChunk, ftData);
+		AW_STAGE_LAP(timer, STAGE_TRUE_PEAK);
 
-		// Process Dynamics
+		// Process Dynamics, ProcessDynamicsFactors charges its own stages
 		ProcessDynamicsChunkData(subChunk, ftData);
+		AW_STAGE_SKIP(timer);
 	}
+
+	ProcessFullTrackMemory(ftData);
+}
+
+void AudioWizardAnalysisFullTrack::ProcessFullTrackMemory(FullTrackData& ftData) {
+	using AWHPerf::GetVectorBytes;
+
+	const size_t bufferBytes =
+		(ftData.originalBlockBuffer.getCapacity() + ftData.dynamicsBlockBuffer.getCapacity()) * sizeof(audioType) +
+		(ftData.integratedBlockSums.getCapacity() + ftData.shortTermBlockSums.getCapacity() +
+		 ftData.pureDynamicsBlockSums.getCapacity() + ftData.loudnessHistory100ms.getCapacity() +
+		 ftData.loudnessHistory1s.getCapacity() + ftData.loudnessHistory10s.getCapacity()) * sizeof(double) +
+		GetVectorBytes(ftData.histogramOfBlockLoudness) + GetVectorBytes(ftData.histogramOfBlockLoudnessLRA);
+
+	// Band powers hold one BARK_BAND_NUMBER vector per block, counted by size to keep this O(1) per chunk
+	const size_t blockBytes =
+		GetVectorBytes(ftData.bandPowers) + ftData.bandPowers.size() * AWHAudioFFT::BARK_BAND_NUMBER * sizeof(double) +
+		GetVectorBytes(ftData.bandPowersPrevious) + GetVectorBytes(ftData.binauralFactor) +
+		GetVectorBytes(ftData.criticalBandFactor) + GetVectorBytes(ftData.harmonicComplexityFactor) +
+		GetVectorBytes(ftData.maskingFactor) + GetVectorBytes(ftData.frequencyPowers) +
+		GetVectorBytes(ftData.spectralCentroid) + GetVectorBytes(ftData.spectralFlatness) +
+		GetVectorBytes(ftData.spectralFlux) + GetVectorBytes(ftData.hannWindow) +
+		GetVectorBytes(ftData.originalRMSLinearLeft) + GetVectorBytes(ftData.originalRMSLinearRight) +
+		GetVectorBytes(ftData.originalPeakLinearLeft) + GetVectorBytes(ftData.originalPeakLinearRight);
+
+	ftData.bufferMemory.Set(bufferBytes);
+	ftData.blockMemory.Set(blockBytes);
 }
 
 void AudioWizardAnalysisFullTrack::ProcessFullTrackResults(metadb_handle_ptr track, const FullTrackData& ftData, FullTrackResults& ftResult) {
@@ -1542,14 +1642,12 @@ double AudioWizardAnalysisRealTime::GetShortTermLUFS(const ChunkData& chkData, c
 	return ProcessLUFS(rtData.kWeightedBuffer, maxSamples);
 }
 
-double AudioWizardAnalysisRealTime::GetRMS(const ChunkData& chkData) {
+double AudioWizardAnalysisRealTime::GetRMS(const ChunkData& chkData, const RealTimeData& rtData) {
+	// Uses the per-channel sums accumulated by ProcessChannelLevels
 	double sumSquares = 0.0;
 
-	for (size_t i = 0; i < chkData.frames; ++i) {
-		for (size_t ch = 0; ch < chkData.channels; ++ch) {
-			double sample = chkData.data[i * chkData.channels + ch];
-			sumSquares += sample * sample;
-		}
+	for (double channelSum : rtData.channelSumSquares) {
+		sumSquares += channelSum;
 	}
 
 	return AWHAudio::LinearToDb(std::sqrt(sumSquares / static_cast<double>(chkData.frames * chkData.channels)));
@@ -1557,15 +1655,19 @@ double AudioWizardAnalysisRealTime::GetRMS(const ChunkData& chkData) {
 
 double AudioWizardAnalysisRealTime::GetTruePeak(const ChunkData& chkData, RealTimeData& rtData) {
 	double truePeakLinear = AudioWizardAnalysisInterpolator::CalculateTruePeakLinear(
-		chkData, rtData.filterData.interp.get()
+		chkData, rtData.filterData.activeInterp, &rtData.channelTruePeaksLinear
 	);
 
+	rtData.channelTruePeaks.resize(rtData.channelTruePeaksLinear.size());
+	for (size_t ch = 0; ch < rtData.channelTruePeaksLinear.size(); ++ch) {
+		const double peak = rtData.channelTruePeaksLinear[ch];
+		rtData.channelTruePeaks[ch] = peak > 0.0 ? AWHMath::RoundTo(AWHAudio::LinearToDb(peak), 1) : -INFINITY;
+	}
+
 	return AWHAudio::LinearToDb(truePeakLinear);
 }
 
-double AudioWizardAnalysisRealTime::GetPSR(const ChunkData& chkData, RealTimeData& rtData) {
-	double truePeak = GetTruePeak(chkData, rtData);
-	double shortTermLUFS = GetShortTermLUFS(chkData, rtData);
+double AudioWizardAnalysisRealTime::GetPSR(double truePeak, double shortTermLUFS) {
 	return truePeak - shortTermLUFS;
 }
 
@@ -1573,15 +1675,14 @@ double AudioWizardAnalysisRealTime::GetPLR(double truePeak, double integratedLUF
 	return truePeak - integratedLUFS;
 }
 
-double AudioWizardAnalysisRealTime::GetCrestFactor(const ChunkData& chkData) {
-	double peak = ProcessFramePeak(chkData);
+double AudioWizardAnalysisRealTime::GetCrestFactor(const ChunkData& chkData, const RealTimeData& rtData) {
+	// Uses the per-channel sums and peaks accumulated by ProcessChannelLevels
+	double peak = 0.0;
 	double sumSquares = 0.0;
 
-	for (size_t i = 0; i < chkData.frames; ++i) {
-		for (size_t ch = 0; ch < chkData.channels; ++ch) {
-			double sample = chkData.data[i * chkData.channels + ch];
-			sumSquares += sample * sample;
-		}
+	for (size_t ch = 0; ch < rtData.channelSumSquares.size(); ++ch) {
+		peak = std::max(peak, rtData.channelPeaksLinear[ch]);
+		sumSquares += rtData.channelSumSquares[ch];
 	}
 
 	double RMS = std::sqrt(sumSquares / static_cast<double>(chkData.frames * chkData.channels));
@@ -1589,79 +1690,38 @@ double AudioWizardAnalysisRealTime::GetCrestFactor(const ChunkData& chkData) {
 }
 
 double AudioWizardAnalysisRealTime::GetDynamicRange(const ChunkData& chkData, RealTimeData& rtData) {
-	const size_t frames = chkData.frames;
-	if (chkData.frames == 0) return 0.0;
+	if (chkData.frames == 0 || rtData.drBlockSize == 0) return 0.0;
 
-	constexpr double MIN_RMS_LINEAR = 1e-5;
-	constexpr double TOP_RMS_FRACTION = 0.2;
+	static constexpr double MIN_RMS_LINEAR = 1e-5;
+	const size_t channels = std::min<size_t>(chkData.channels, 2); // Left/right, or mono
 
-	// Calculate RMS and peak for the current 100ms chunk
-	auto calculateChunkMetrics = [&chkData, frames](size_t channelIdx, RingBufferSimple& rmsBuffer, RingBufferSimple& peakBuffer) {
-		double sumSquares = 0.0;
-		double chunkPeak = 0.0;
-		const size_t stride = chkData.channels;
-		const audioType* samplePtr = chkData.data + channelIdx;
-
-		for (size_t i = 0; i < frames; ++i) {
-			const double sample = *samplePtr;
-			sumSquares += sample * sample;
-			chunkPeak = std::max(chunkPeak, std::abs(sample));
-			samplePtr += stride;
-		}
-
-		const double chunkRMS = std::sqrt(sumSquares / frames);
-		rmsBuffer.pushBack(chunkRMS);
-		peakBuffer.pushBack(chunkPeak);
-	};
+	// Accumulate per-channel RMS and peak into 3000ms blocks
+	for (size_t i = 0; i < chkData.frames; ++i) {
+		const audioType* frame = chkData.data + i * chkData.channels;
 
-	// Aggregate RMS over 3000ms (30 chunks) for stability
-	auto aggregateRMS = [](const RingBufferSimple& rmsBuffer, size_t chunksPerBlock) {
-		std::vector<double> aggregatedRMS;
-		size_t numBlocks = rmsBuffer.size() / chunksPerBlock;
-		if (numBlocks == 0) return aggregatedRMS;
-
-		for (size_t i = 0; i < numBlocks; ++i) {
-			double sumSquares = 0.0;
-			for (size_t j = 0; j < chunksPerBlock; ++j) {
-				size_t idx = i * chunksPerBlock + j;
-				double rms = rmsBuffer[idx];
-				sumSquares += rms * rms;
-			}
-			aggregatedRMS.push_back(std::sqrt(sumSquares / chunksPerBlock));
+		for (size_t ch = 0; ch < channels; ++ch) {
+			const double sample = frame[ch];
+			rtData.drBlockSumSquares[ch] += sample * sample;
+			rtData.drBlockPeak[ch] = std::max(rtData.drBlockPeak[ch], std::abs(sample));
 		}
 
-		return aggregatedRMS;
-	};
-
-	// Compute DR over the aggregated RMS and peaks
-	auto calculateDR = [&chkData](const std::vector<double>& rmsAggregated, const RingBufferSimple& peakBuffer) {
-		const size_t numBlocks = rmsAggregated.size();
-		if (numBlocks < 2) return 0.0;
+		if (++rtData.drBlockFrames < rtData.drBlockSize) continue;
 
-		// Second-largest peak over the window
-		double max1 = 0.0;
-		double max2 = 0.0;
-		for (size_t i = 0; i < peakBuffer.size(); ++i) {
-			const double p = peakBuffer[i];
-			if (p > max1) {
-				max2 = max1;
-				max1 = p;
-			}
-			else if (p > max2) max2 = p;
+		// Block complete, feed the RMS histograms
+		for (size_t ch = 0; ch < channels; ++ch) {
+			const double blockRMS = std::sqrt(rtData.drBlockSumSquares[ch] / static_cast<double>(rtData.drBlockFrames));
+			rtData.drChannels[ch].addBlock(blockRMS, rtData.drBlockPeak[ch]);
+			rtData.drBlockSumSquares[ch] = 0.0;
+			rtData.drBlockPeak[ch] = 0.0;
 		}
-		const double secondLargestPeakLinear = std::max(max2, MIN_RMS_LINEAR);
-
-		// Top 20% RMS
-		const auto top20 = static_cast<size_t>(std::ceil(TOP_RMS_FRACTION * numBlocks));
-		if (top20 == 0) return 0.0;
+		rtData.drBlockFrames = 0;
+	}
 
-		std::vector<double> rmsSorted = rmsAggregated;
-		std::partial_sort(rmsSorted.begin(), rmsSorted.begin() + top20, rmsSorted.end(), std::greater<double>());
+	// O(1) query, cached per block: second-highest block peak against the loudest 20% block RMS
+	auto calculateDR = [](const AWHAudioDynamics::DynamicRangeChannel& drChannel) {
+		if (drChannel.blockCount() < 2) return 0.0;
 
-		double sumSquares = 0.0;
-		for (size_t i = 0; i < top20; ++i) {
-			sumSquares += rmsSorted[i] * rmsSorted[i];
-		}
+		const double secondLargestPeakLinear = std::max(drChannel.peakSecondHighest, MIN_RMS_LINEAR);
 
 		// From DRMeter manual (DRMeter_UM.pdf, p. 19, RMS Meters):
 		// "The RMS value is corrected by + 3dB so that sine waves have the same peak and RMS value,
@@ -1669,36 +1729,18 @@ double AudioWizardAnalysisRealTime::GetDynamicRange(const ChunkData& chkData, Re
 		// Standard RMS = peak / sqrt(2) ≈ peak / 1.4142135623730951, so corrected RMS = sqrt(2) * standardRMS.
 		// In dB: 20 * log10(sqrt(2)) ≈ 3.0103.
 		constexpr double DR14_RMS_CORRECTION = 3.0103;
-		double overallRMSLinear = std::max(std::sqrt(sumSquares / top20), MIN_RMS_LINEAR);
+		double overallRMSLinear = std::max(drChannel.topRMSLinear(), MIN_RMS_LINEAR);
 		double overallRMSdB = AWHAudio::LinearToDb(overallRMSLinear) + DR14_RMS_CORRECTION;
 
 		return AWHAudio::LinearToDb(secondLargestPeakLinear) - overallRMSdB;
 	};
 
-	// Smoothing with faster response
-	auto smoothDR = [](double drNew, double const& drPrevious, double smoothingFactor = 0.2) {
-		return smoothingFactor * drPrevious + (1.0 - smoothingFactor) * drNew;
-	};
-
-	constexpr size_t CHUNKS_PER_BLOCK = 30; // 3000ms (30 * 100ms)
-	double dr;
-
-	if (chkData.channels >= 2) {
-		calculateChunkMetrics(0, rtData.drRMSBufferLeft, rtData.drPeakBufferLeft);
-		calculateChunkMetrics(1, rtData.drRMSBufferRight, rtData.drPeakBufferRight);
-		auto rmsLeftAggregated = aggregateRMS(rtData.drRMSBufferLeft, CHUNKS_PER_BLOCK);
-		auto rmsRightAggregated = aggregateRMS(rtData.drRMSBufferRight, CHUNKS_PER_BLOCK);
-		double drLeft = calculateDR(rmsLeftAggregated, rtData.drPeakBufferLeft);
-		double drRight = calculateDR(rmsRightAggregated, rtData.drPeakBufferRight);
-		dr = (drLeft + drRight) / 2.0;
-	}
-	else {
-		calculateChunkMetrics(0, rtData.drRMSBuffer, rtData.drPeakBuffer);
-		auto rmsAggregated = aggregateRMS(rtData.drRMSBuffer, CHUNKS_PER_BLOCK);
-		dr = calculateDR(rmsAggregated, rtData.drPeakBuffer);
+	double dr = 0.0;
+	for (size_t ch = 0; ch < channels; ++ch) {
+		dr += calculateDR(rtData.drChannels[ch]);
 	}
 
-	return smoothDR(std::max(0.0, dr), rtData.drPrevious);
+	return std::max(0.0, dr / static_cast<double>(channels));
 }
 
 double AudioWizardAnalysisRealTime::GetPureDynamics(const ChunkData& chkData, RealTimeData& rtData) {
@@ -1706,6 +1748,12 @@ double AudioWizardAnalysisRealTime::GetPureDynamics(const ChunkData& chkData, Re
 		return rtData.pureDynamicsEMA;
 	}
 
+	// The pipeline only changes when a 100ms block completes, otherwise return the cached value
+	if (rtData.pureDynamicsPendingBlocks == 0) {
+		return rtData.pureDynamicsEMA;
+	}
+	rtData.pureDynamicsPendingBlocks = 0;
+
 	// Pipeline order:
 	// Correction > Adaptation > Binaural > Transient Detection > Cognitive > Transient Application > Spread mirrors auditory processing:
 	// Peripheral > Spatial > Temporal > Cognitive > Integrative
@@ -1796,11 +1844,12 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsInitialization(RealTimeDataDyna
 	dynamics.blockDurationMs = dynamics.rtData.blockDurationMs;
 	dynamics.integratedLUFS = dynamics.rtData.integratedLUFS;
 
-	// Compute block loudness from the last 1.5s of K-weighted buffer
-	const size_t blockSize = dynamics.rtData.blockSize;
-	const auto maxSamples = static_cast<size_t>(1.5 * dynamics.chkData.sampleRate);
-	const size_t start = dynamics.rtData.kWeightedBuffer.size() > maxSamples ? dynamics.rtData.kWeightedBuffer.size() - maxSamples : 0;
-	dynamics.blockLoudness = AWHAudioDSP::ComputeBlockLoudness(dynamics.rtData.kWeightedBuffer, start, blockSize);
+	// Block loudness of the last 1.5s, maintained incrementally by ProcessPureDynamicsBlock
+	const RingBufferSimple& window = dynamics.rtData.pureDynamicsBlockLoudness;
+	dynamics.blockLoudness.clear();
+	for (double lufs : window) {
+		dynamics.blockLoudness.push_back(lufs);
+	}
 	dynamics.blockCount = dynamics.blockLoudness.size();
 	if (dynamics.blockCount == 0) return;
 
@@ -1809,8 +1858,17 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsInitialization(RealTimeDataDyna
 	dynamics.adaptedLoudness.reserve(dynamics.blockCount);
 	dynamics.transientBoosts.reserve(dynamics.blockCount);
 
-	// Retrieve precomputed spectral features from rtData
-	dynamics.bandPowers = dynamics.rtData.bandPowers;
+	// Retrieve precomputed spectral features from rtData, band power rows are assigned in place to keep their storage
+	const auto& sourceBandPowers = dynamics.rtData.bandPowers;
+	dynamics.bandPowers.resize(dynamics.blockCount);
+	for (size_t i = 0; i < dynamics.blockCount; ++i) {
+		if (i < sourceBandPowers.size()) {
+			dynamics.bandPowers[i].assign(sourceBandPowers[i].begin(), sourceBandPowers[i].end());
+		}
+		else {
+			dynamics.bandPowers[i].assign(AWHAudioFFT::BARK_BAND_NUMBER, AWHAudioFFT::EPSILON);
+		}
+	}
 	dynamics.frequencyPowers = dynamics.rtData.frequencyPowers;
 	dynamics.harmonicComplexityFactor = dynamics.rtData.harmonicComplexityFactor;
 	dynamics.maskingFactor = dynamics.rtData.maskingFactor;
@@ -1819,8 +1877,7 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsInitialization(RealTimeDataDyna
 	dynamics.spectralFlux = dynamics.rtData.spectralFlux;
 
 	// Ensure vectors match block count, filling with defaults if FFT was skipped
-	if (dynamics.bandPowers.size() != dynamics.blockCount) {
-		dynamics.bandPowers.resize(dynamics.blockCount, std::vector<double>(AWHAudioFFT::BARK_BAND_NUMBER, AWHAudioFFT::EPSILON));
+	if (sourceBandPowers.size() != dynamics.blockCount) {
 		dynamics.frequencyPowers.resize(dynamics.blockCount, AWHAudioFFT::EPSILON);
 		dynamics.harmonicComplexityFactor.resize(dynamics.blockCount, 0.0);
 		dynamics.maskingFactor.resize(dynamics.blockCount, 1.0);
@@ -1829,8 +1886,10 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsInitialization(RealTimeDataDyna
 		dynamics.spectralFlux.resize(dynamics.blockCount, 0.0);
 	}
 
-	// Compute variance and scale for perceptual adjustments
-	dynamics.variance = AWHMath::CalculateVarianceOnline(dynamics.blockLoudness);
+	// Variance from the running window sums, O(1)
+	const double count = static_cast<double>(dynamics.rtData.pureDynamicsLoudnessCount);
+	dynamics.variance = count > 1.0 ? std::max(0.0, (dynamics.rtData.pureDynamicsLoudnessSumSquares
+		- dynamics.rtData.pureDynamicsLoudnessSum * dynamics.rtData.pureDynamicsLoudnessSum / count) / (count - 1.0)) : 0.0;
 	double varianceDenom = 30.0 + 40.0 * dynamics.rtData.genreFactor + 0.2 * dynamics.variance;
 	dynamics.varianceScale = std::tanh(std::max(1.0, dynamics.variance / varianceDenom));
 
@@ -1849,7 +1908,7 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsInitialization(RealTimeDataDyna
 
 void AudioWizardAnalysisRealTime::ProcessDynamicsLoudnessCorrection(RealTimeDataDynamics& dynamics) {
 	// Compute Fastl adjustments for perceptual correction
-	std::vector<double> fastlAdjustments(dynamics.blockCount, 0.0);
+	std::vector<double>& fastlAdjustments = dynamics.rtData.dynamicsScratch.fastlAdjustments;
 	AWHAudioDynamics::ComputeFastlPrinciples(true, fastlAdjustments,
 		dynamics.bandPowers, dynamics.blockLoudness, dynamics.rtData.blockSize, dynamics.chkData.sampleRate,
 		dynamics.variance, dynamics.varianceScale, &dynamics.rtData.bandPowersHistory
@@ -1933,8 +1992,9 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsCognitiveLoudness(RealTimeDataD
 		if (dynamics.rtData.loudnessHistory10s.size() > window10s) dynamics.rtData.loudnessHistory10s.trim(window10s);
 
 		// Use 25-band bark powers for cognitive loudness
-		std::vector<double> bandPower = (i < dynamics.bandPowers.size() && !dynamics.bandPowers[i].empty()) ?
-			dynamics.bandPowers[i] : std::vector<double>(AWHAudioFFT::BARK_BAND_NUMBER, AWHAudioFFT::EPSILON);
+		static const std::vector<double> defaultBandPower(AWHAudioFFT::BARK_BAND_NUMBER, AWHAudioFFT::EPSILON);
+		const std::vector<double>& bandPower = (i < dynamics.bandPowers.size() && !dynamics.bandPowers[i].empty()) ?
+			dynamics.bandPowers[i] : defaultBandPower;
 
 		// Use computed spectral features instead of defaults
 		double cogFactor = AWHAudioDynamics::ComputeCognitiveLoudness(true,
@@ -1947,14 +2007,13 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsCognitiveLoudness(RealTimeDataD
 }
 
 void AudioWizardAnalysisRealTime::ProcessDynamicsTransientBoostsDetection(RealTimeDataDynamics& dynamics) {
-	std::vector<double> loudnessNormalized = AWHAudioDSP::NormalizeLoudness(
-		dynamics.adaptedLoudness, dynamics.blockDurationMs, 3000.0
-	);
+	std::vector<double>& loudnessNormalized = dynamics.rtData.dynamicsScratch.loudnessNormalized;
+	AWHAudioDSP::NormalizeLoudness(dynamics.adaptedLoudness, dynamics.blockDurationMs, 3000.0, loudnessNormalized);
 
-	dynamics.transientBoosts = AWHAudioDynamics::DetectTransients(
+	AWHAudioDynamics::DetectTransients(
 		loudnessNormalized, dynamics.blockDurationMs, dynamics.harmonicComplexityFactor,
 		dynamics.maskingFactor,	dynamics.spectralFlux, dynamics.spectralCentroid,
-		dynamics.spectralFlatness, dynamics.rtData.genreFactor,	dynamics.varianceScale
+		dynamics.spectralFlatness, dynamics.rtData.genreFactor,	dynamics.varianceScale, dynamics.transientBoosts
 	);
 }
 
@@ -1970,13 +2029,13 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsTransientBoostsAdjustment(RealT
 
 void AudioWizardAnalysisRealTime::ProcessDynamicsSpread(RealTimeDataDynamics& dynamics) {
 	// 1. Normalize loudness with 3000ms time constant
-	const std::vector<double> loudnessNormalized = AWHAudioDSP::NormalizeLoudness(
-		dynamics.adaptedLoudness, dynamics.blockDurationMs, 3000.0
-	);
+	RealTimeDynamicsScratch& scratch = dynamics.rtData.dynamicsScratch;
+	std::vector<double>& loudnessNormalized = scratch.loudnessNormalized;
+	AWHAudioDSP::NormalizeLoudness(dynamics.adaptedLoudness, dynamics.blockDurationMs, 3000.0, loudnessNormalized);
 
 	// 2. Filter loudness values above perceptual threshold (-80 dB)
-	std::vector<double> validLoudness;
-	validLoudness.reserve(dynamics.blockCount);
+	std::vector<double>& validLoudness = scratch.validLoudness;
+	validLoudness.clear();
 	for (size_t i = 0; i < dynamics.blockCount; ++i) {
 		if (loudnessNormalized[i] > -80.0) {
 			validLoudness.push_back(loudnessNormalized[i]);
@@ -1997,8 +2056,9 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsSpread(RealTimeDataDynamics& dy
 	const double dynamicThreshold = std::max(dynamics.integratedLUFS - 22.0 + 4.0 * dynamics.rtData.genreFactor, -80.0);
 	const double preMaskingMs = 20.0 + 30.0 * dynamics.varianceScale; // 20–50 ms
 	const double postMaskingMs = 100.0 + 140.0 * dynamics.varianceScale; // 100–240 ms
-	const std::vector<double> temporalWeights = AWHAudioDynamics::ComputeTemporalWeights(
-		loudnessNormalized, dynamics.blockDurationMs, preMaskingMs, postMaskingMs, dynamics.variance
+	std::vector<double>& temporalWeights = scratch.temporalWeights;
+	AWHAudioDynamics::ComputeTemporalWeights(
+		loudnessNormalized, dynamics.blockDurationMs, preMaskingMs, postMaskingMs, dynamics.variance, temporalWeights
 	);
 
 	// 6. Define window parameters for real-time processing
@@ -2010,14 +2070,14 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsSpread(RealTimeDataDynamics& dy
 		? dynamics.rtData.kWeightedBuffer.size() - static_cast<size_t>(1.5 * dynamics.chkData.sampleRate) : 0;
 
 	// 7. Compute dynamic spreads over short windows
-	std::vector<double> shortSpreads;
-	std::vector<double> weights;
-	shortSpreads.reserve(4); // Approximate max windows in 1.5s
-	weights.reserve(4);
+	std::vector<double>& shortSpreads = scratch.shortSpreads;
+	std::vector<double>& weights = scratch.spreadWeights;
+	std::vector<double>& windowLoudness = scratch.windowLoudness;
+	shortSpreads.clear();
+	weights.clear();
 
 	for (size_t windowStart = start; windowStart + shortWindowBlocks <= dynamics.rtData.kWeightedBuffer.size(); windowStart += windowStep) {
-		std::vector<double> windowLoudness;
-		windowLoudness.reserve(shortWindowBlocks);
+		windowLoudness.clear();
 		size_t numBlocks = 0;
 		for (size_t blockIdx = windowStart; blockIdx + dynamics.rtData.blockSize <= dynamics.rtData.kWeightedBuffer.size() && numBlocks < shortWindowBlocks; blockIdx += dynamics.rtData.blockSize) {
 			const size_t loudnessIdx = (blockIdx - start) / dynamics.rtData.blockSize;
@@ -2045,7 +2105,7 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsSpread(RealTimeDataDynamics& dy
 
 	// 8. Aggregate spreads
 	const double weightedAverage = AWHMath::CalculateWeightedAverage(shortSpreads, weights);
-	const double median = AWHMath::CalculateMedian(shortSpreads);
+	const double median = AWHMath::CalculateMedianInPlace(shortSpreads);
 	const double baseSpread = rangeFocusFactor * median + (1.0 - rangeFocusFactor) * weightedAverage;
 
 	// 9. Apply adjustments
@@ -2063,27 +2123,35 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsFactors(const ChunkData& chkDat
 	constexpr double MIN_ENERGY = 1e-12;
 	constexpr double SPECTRAL_FLUX_THRESHOLD = 0.05;
 
-	// Preallocate rtData members
+	// Reset rtData members in place, keeping their capacity from previous chunks
 	size_t blockCount = chkData.frames / rtData.blockSize;
-	rtData.bandPowers = std::vector<std::vector<double>>(blockCount, std::vector<double>(AWHAudioFFT::BARK_BAND_NUMBER, AWHAudioFFT::EPSILON));
-	rtData.frequencyPowers = std::vector<double>(blockCount, AWHAudioFFT::EPSILON);
-	rtData.harmonicComplexityFactor = std::vector<double>(blockCount, 0.0);
-	rtData.maskingFactor = std::vector<double>(blockCount, 1.0);
-	rtData.spectralCentroid = std::vector<double>(blockCount, 0.0);
-	rtData.spectralFlatness = std::vector<double>(blockCount, 1.0);
-	rtData.spectralFlux = std::vector<double>(blockCount, 0.0);
-
-	// Preallocate buffers for FFT and spectral processing
-	std::vector<double> blockSamples(rtData.fftSize, 0.0);
-	std::vector<std::complex<double>> fftOutput(rtData.fftSize);
-	std::vector<double> powerSpectrum(rtData.fftSize / 2 + 1);
+	rtData.bandPowers.resize(blockCount);
+	for (auto& bands : rtData.bandPowers) {
+		bands.assign(AWHAudioFFT::BARK_BAND_NUMBER, AWHAudioFFT::EPSILON);
+	}
+	rtData.frequencyPowers.assign(blockCount, AWHAudioFFT::EPSILON);
+	rtData.harmonicComplexityFactor.assign(blockCount, 0.0);
+	rtData.maskingFactor.assign(blockCount, 1.0);
+	rtData.spectralCentroid.assign(blockCount, 0.0);
+	rtData.spectralFlatness.assign(blockCount, 1.0);
+	rtData.spectralFlux.assign(blockCount, 0.0);
+
+	// FFT and spectral scratch buffers, pre-sized in InitRealTimeState
+	std::vector<double>& blockSamples = rtData.fftBlockSamples;
+	std::vector<std::complex<double>>& fftOutput = rtData.fftOutput;
+	std::vector<double>& powerSpectrum = rtData.powerSpectrum;
 
 	// Determine if FFT is needed
 	bool computeFFT = (rtData.blocksTotal % 3 == 0);
 	double lastFlux = rtData.spectralFluxSum / (rtData.blocksTotal > 0 ? rtData.blocksTotal : 1);
 	if (lastFlux > SPECTRAL_FLUX_THRESHOLD) computeFFT = true;
+	if (rtData.qualityTier >= AWHPerf::QualityGovernor::TIER_REDUCED_FFT && (rtData.fftCadenceCounter++ & 1)) computeFFT = false;
+	bool hasLastBlockSpectrum = false;
 
 	if (computeFFT) {
+		AW_STAGE_TIMER(timer, rtData.profile);
+		AW_STAGE_COUNT(rtData.profile, blocks, blockCount);
+
 		for (size_t i = 0; i < blockCount; ++i) {
 			size_t startSample = i * rtData.blockSize * chkData.channels;
 			if (startSample + rtData.blockSize * chkData.channels > chkData.frames * chkData.channels) break;
@@ -2098,14 +2166,18 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsFactors(const ChunkData& chkDat
 			// Compute FFT and power spectrum
 			AWHAudioFFT::ComputeFFTPower2(blockSamples, fftOutput);
 			AWHAudioFFT::ComputePowerSpectrum(fftOutput.data(), rtData.fftSize, rtData.blockSize, powerSpectrum);
+			AW_STAGE_LAP(timer, STAGE_FFT);
 
 			// Map to bark bands and compute spectral features
 			AWHAudioFFT::MapPowerSpectrumToBarkBands(powerSpectrum, rtData.fftSize, chkData.sampleRate, rtData.bandPowers[i]);
+			AW_STAGE_LAP(timer, STAGE_BARK_MAPPING);
+			hasLastBlockSpectrum = (i + 1 == blockCount);
 			double freqPower = AWHAudioFFT::ComputePerceptualFrequencyPower(rtData.bandPowers[i], rtData.barkWeights);
 			rtData.frequencyPowers[i] = (freqPower != -INFINITY ? freqPower : AWHAudioFFT::EPSILON);
 
 			rtData.harmonicComplexityFactor[i] = AWHAudioFFT::ComputeHarmonicComplexity(rtData.bandPowers[i]);
 			rtData.maskingFactor[i] = AWHAudioFFT::ComputeFrequencyMaskingFromPowerSpectrum(powerSpectrum, rtData.fftSize, chkData.sampleRate, rtData.bandPowers[i]);
+			AW_STAGE_LAP(timer, STAGE_PSYCHOACOUSTIC);
 
 			rtData.spectralCentroid[i] = AWHAudioFFT::ComputeSpectralCentroid(rtData.bandPowers[i], chkData.sampleRate);
 			rtData.spectralFlatness[i] = AWHAudioFFT::ComputeSpectralFlatness(rtData.bandPowers[i], AWHAudioFFT::BARK_BAND_NUMBER);
@@ -2121,6 +2193,7 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsFactors(const ChunkData& chkDat
 			rtData.spectralFlatnessSum += rtData.spectralFlatness[i];
 			rtData.spectralFluxSum += rtData.spectralFlux[i];
 			rtData.blocksTotal++;
+			AW_STAGE_LAP(timer, STAGE_SPECTRAL);
 		}
 
 		// Update band powers history
@@ -2150,6 +2223,46 @@ void AudioWizardAnalysisRealTime::ProcessDynamicsFactors(const ChunkData& chkDat
 		rtData.spectralFluxSum = 0.0;
 		rtData.blocksTotal = 0;
 	}
+
+	ProcessSpectrum(chkData, rtData, hasLastBlockSpectrum);
+}
+
+void AudioWizardAnalysisRealTime::ProcessSpectrum(const ChunkData& chkData, RealTimeData& rtData, bool hasLastBlockSpectrum) {
+	if (!rtData.spectrumActive || chkData.channels == 0 || rtData.blockSize == 0) return;
+
+	// Slide the newest 100ms of interleaved audio into the window, chunks may be shorter than a block
+	const size_t windowSamples = rtData.blockSize * chkData.channels;
+	const size_t chunkSamples = chkData.frames * chkData.channels;
+	auto& window = rtData.spectrumInput;
+
+	if (window.size() != windowSamples) {
+		window.assign(windowSamples, 0);
+	}
+
+	if (chunkSamples >= windowSamples) {
+		std::copy(chkData.data + (chunkSamples - windowSamples), chkData.data + chunkSamples, window.begin());
+	}
+	else {
+		std::move(window.begin() + chunkSamples, window.end(), window.begin());
+		std::copy(chkData.data, chkData.data + chunkSamples, window.end() - chunkSamples);
+	}
+
+	rtData.spectrumBarkPowers.resize(AWHAudioFFT::BARK_BAND_NUMBER);
+
+	// Share the metrics FFT when it already covered the last block of this chunk
+	if (hasLastBlockSpectrum) {
+		rtData.spectrumPower = rtData.powerSpectrum;
+		std::copy(rtData.bandPowers.back().begin(), rtData.bandPowers.back().end(), rtData.spectrumBarkPowers.begin());
+		rtData.spectrumFresh = true;
+		return;
+	}
+
+	double energy;
+	AWHAudioDSP::ComputeBlockSamplesAndEnergy(window.data(), 0, rtData.blockSize, chkData.channels, rtData.fftBlockSamples, energy, &rtData.hannWindow);
+	AWHAudioFFT::ComputeFFTPower2(rtData.fftBlockSamples, rtData.fftOutput);
+	AWHAudioFFT::ComputePowerSpectrum(rtData.fftOutput.data(), rtData.fftSize, rtData.blockSize, rtData.spectrumPower);
+	AWHAudioFFT::MapPowerSpectrumToBarkBands(rtData.spectrumPower, rtData.fftSize, chkData.sampleRate, rtData.spectrumBarkPowers);
+	rtData.spectrumFresh = true;
 }
 #pragma endregion
 
@@ -2176,63 +2289,101 @@ double AudioWizardAnalysisRealTime::ProcessLUFS(const RingBufferSimple& buffer,
 
 void AudioWizardAnalysisRealTime::ProcessIntegratedLUFS(const std::vector<double>& tempBuffer, RealTimeData& rtData) {
 	constexpr double ABSOLUTE_GATE = -70.0; // EBU R128 absolute gate
-	constexpr double RELATIVE_GATE = -10.0; // EBU R128 relative gate
 
 	for (double framePower : tempBuffer) {
 		rtData.currentBlockSum += framePower;
 		rtData.currentBlockFrames++;
 
-		if (rtData.currentBlockFrames == rtData.blockSize) {
-			double block_power = rtData.currentBlockSum;
-			rtData.integratedLUFSBuffer.pushBack(block_power);
-			rtData.currentBlockSum = 0.0;
-			rtData.currentBlockFrames = 0;
+		if (rtData.currentBlockFrames < rtData.blockSize) continue;
+
+		rtData.integratedLUFSBuffer.pushBack(rtData.currentBlockSum);
+		ProcessPureDynamicsBlock(rtData.currentBlockSum, rtData);
+		rtData.currentBlockSum = 0.0;
+		rtData.currentBlockFrames = 0;
+
+		if (rtData.integratedLUFSBuffer.size() < 4) continue; // Wait for the first full 400ms window (4 blocks)
+
+		double sum = 0.0;
+		for (double blockSum : rtData.integratedLUFSBuffer) { // Sliding 400ms window with 75% overlap
+			sum += blockSum;
 		}
+
+		const double meanPower = sum / static_cast<double>(4 * rtData.blockSize);
+		const double lkfs = -0.691 + AWHAudio::PowerToDb(meanPower);
+		if (lkfs <= ABSOLUTE_GATE) continue;
+
+		const int maxBin = static_cast<int>(rtData.integratedHistogramCounts.size() - 1);
+		const int binKey = std::clamp(static_cast<int>(std::round(lkfs * 10.0)) + 700, 0, maxBin);
+		rtData.integratedHistogramCounts[binKey]++;
+		rtData.integratedHistogramPowers[binKey] += meanPower;
+		rtData.integratedBlockCount++;
+		rtData.integratedPowerSum += meanPower;
 	}
 
-	// Compute integrated LUFS with two-stage gating
-	if (rtData.integratedLUFSBuffer.size() > 0) {
-		// Stage 1: Absolute gate at -70 LUFS
-		double sum_power = 0.0;
-		size_t count = 0;
-		for (size_t i = 0; i < rtData.integratedLUFSBuffer.size(); ++i) {
-			double block_power = rtData.integratedLUFSBuffer[i];
-			double block_loudness = -0.691 + AWHAudio::PowerToDb(block_power / rtData.blockSize);
-			if (block_loudness > ABSOLUTE_GATE) {
-				sum_power += block_power;
-				count++;
-			}
-		}
+	ProcessIntegratedLUFSGating(rtData);
+}
 
-		// Stage 2: Relative gate at -10 LUFS
-		rtData.gatedPowerSum = 0.0;
-		rtData.gatedBlockCount = 0;
-		if (count > 0) {
-			double mean_power = sum_power / static_cast<double>(count * rtData.blockSize);
-			double integrated_lufs = -0.691 + AWHAudio::PowerToDb(mean_power);
-			double relative_threshold = integrated_lufs + RELATIVE_GATE;
-
-			for (size_t i = 0; i < rtData.integratedLUFSBuffer.size(); ++i) {
-				double block_power = rtData.integratedLUFSBuffer[i];
-				double block_loudness = -0.691 + AWHAudio::PowerToDb(block_power / rtData.blockSize);
-				if (block_loudness > relative_threshold) {
-					rtData.gatedPowerSum += block_power;
-					rtData.gatedBlockCount++;
-				}
-			}
-		}
+void AudioWizardAnalysisRealTime::ProcessPureDynamicsBlock(double blockSum, RealTimeData& rtData) {
+	RingBufferSimple& window = rtData.pureDynamicsBlockLoudness;
 
-		// Update PLR
-		if (rtData.gatedBlockCount > 0) {
-			double mean_power = rtData.gatedPowerSum / static_cast<double>(rtData.gatedBlockCount * rtData.blockSize);
-			rtData.integratedLUFS = -0.691 + AWHAudio::PowerToDb(mean_power);
-			rtData.PLR = AWHMath::RoundTo(GetPLR(rtData.truePeak, rtData.integratedLUFS), 1);
-		}
-		else {
-			rtData.integratedLUFS = -INFINITY;
-			rtData.PLR = -INFINITY;
+	auto addStats = [&rtData](double lufs, double sign) {
+		if (!std::isfinite(lufs)) return;
+		rtData.pureDynamicsLoudnessSum += sign * lufs;
+		rtData.pureDynamicsLoudnessSumSquares += sign * lufs * lufs;
+		rtData.pureDynamicsLoudnessCount = sign > 0.0 ? rtData.pureDynamicsLoudnessCount + 1 : rtData.pureDynamicsLoudnessCount - 1;
+	};
+
+	const double meanPower = blockSum / static_cast<double>(rtData.blockSize);
+	const double blockLUFS = meanPower > 1e-12 ? -0.691 + AWHAudio::PowerToDb(meanPower) : -INFINITY;
+
+	if (window.size() == window.getCapacity()) addStats(window[0], -1.0); // Oldest block slides out
+	window.pushBack(blockLUFS);
+	addStats(blockLUFS, 1.0);
+
+	// Resync the running sums once per window length to bound floating-point drift
+	if (++rtData.pureDynamicsBlocksSinceResync >= window.getCapacity()) {
+		rtData.pureDynamicsLoudnessSum = 0.0;
+		rtData.pureDynamicsLoudnessSumSquares = 0.0;
+		rtData.pureDynamicsLoudnessCount = 0;
+		rtData.pureDynamicsBlocksSinceResync = 0;
+		for (double lufs : window) addStats(lufs, 1.0);
+	}
+
+	rtData.pureDynamicsPendingBlocks++;
+}
+
+void AudioWizardAnalysisRealTime::ProcessIntegratedLUFSGating(RealTimeData& rtData) {
+	constexpr double RELATIVE_GATE = -10.0; // EBU R128 relative gate
+	constexpr int OFFSET = 700; // -70.0 * 10 = -700 -> index 0
+
+	rtData.gatedPowerSum = 0.0;
+	rtData.gatedBlockCount = 0;
+
+	if (rtData.integratedBlockCount > 0) {
+		// Stage 1: Running sums already hold every block above the absolute gate
+		const double ungatedPower = rtData.integratedPowerSum / static_cast<double>(rtData.integratedBlockCount);
+		const double relativeThreshold = -0.691 + AWHAudio::PowerToDb(ungatedPower) + RELATIVE_GATE;
+
+		// Stage 2: Relative gate, O(bins) over the per-bin power sums
+		const auto thresholdBin = static_cast<int>(std::round(relativeThreshold * 10.0)) + OFFSET;
+		const size_t startBin = std::max(0, thresholdBin);
+
+		for (size_t bin = startBin; bin < rtData.integratedHistogramCounts.size(); ++bin) {
+			rtData.gatedPowerSum += rtData.integratedHistogramPowers[bin];
+			rtData.gatedBlockCount += rtData.integratedHistogramCounts[bin];
 		}
 	}
+
+	// Update PLR
+	if (rtData.gatedBlockCount > 0) {
+		const double meanPower = rtData.gatedPowerSum / static_cast<double>(rtData.gatedBlockCount);
+		rtData.integratedLUFS = -0.691 + AWHAudio::PowerToDb(meanPower);
+		rtData.PLR = AWHMath::RoundTo(GetPLR(rtData.truePeak, rtData.integratedLUFS), 1);
+	}
+	else {
+		rtData.integratedLUFS = -INFINITY;
+		rtData.PLR = -INFINITY;
+	}
 }
 
 std::pair<double, double> AudioWizardAnalysisRealTime::ProcessFrameRMS(const ChunkData& chkData) {
@@ -2258,19 +2409,6 @@ std::pair<double, double> AudioWizardAnalysisRealTime::ProcessFrameRMS(const Chu
 	};
 }
 
-double AudioWizardAnalysisRealTime::ProcessFramePeak(const ChunkData& chkData) {
-	double framePeak = 0.0;
-
-	for (size_t i = 0; i < chkData.frames; ++i) {
-		for (size_t ch = 0; ch < chkData.channels; ++ch) {
-			double sample = chkData.data[i * chkData.channels + ch];
-			framePeak = std::max(framePeak, std::abs(sample));
-		}
-	}
-
-	return framePeak;
-}
-
 std::pair<double, double> AudioWizardAnalysisRealTime::ProcessFramePeaks(const ChunkData& chkData) {
 	double framePeakLeft = 0.0;
 	double framePeakRight = 0.0;
@@ -2289,6 +2427,72 @@ std::pair<double, double> AudioWizardAnalysisRealTime::ProcessFramePeaks(const C
 		framePeakRight > 0.0 ? AWHAudio::LinearToDb(framePeakRight) : -INFINITY
 	};
 }
+
+void AudioWizardAnalysisRealTime::ProcessChannelLevels(const ChunkData& chkData, RealTimeData& rtData) {
+	const size_t channels = chkData.channels;
+
+	rtData.channelSumSquares.assign(channels, 0.0);
+	rtData.channelPeaksLinear.assign(channels, 0.0);
+	rtData.channelRMS.resize(channels);
+	rtData.channelSamplePeaks.resize(channels);
+
+	if (chkData.frames == 0 || chkData.data == nullptr) {
+		std::fill(rtData.channelRMS.begin(), rtData.channelRMS.end(), -INFINITY);
+		std::fill(rtData.channelSamplePeaks.begin(), rtData.channelSamplePeaks.end(), -INFINITY);
+		return;
+	}
+
+	double* sumSquares = rtData.channelSumSquares.data();
+	double* peaks = rtData.channelPeaksLinear.data();
+
+	// Common layouts get a fixed channel count so the per-frame loop is unrolled and vectorized across channels
+	switch (channels) {
+		case 1: ProcessChannelLevelsKernel<1>(chkData, sumSquares, peaks); break;
+		case 2: ProcessChannelLevelsKernel<2>(chkData, sumSquares, peaks); break;
+		case 6: ProcessChannelLevelsKernel<6>(chkData, sumSquares, peaks); break;
+		case 8: ProcessChannelLevelsKernel<8>(chkData, sumSquares, peaks); break;
+		default: ProcessChannelLevelsKernel<0>(chkData, sumSquares, peaks); break;
+	}
+
+	const auto samples = static_cast<double>(chkData.frames);
+
+	for (size_t ch = 0; ch < channels; ++ch) {
+		const double rmsLinear = std::sqrt(sumSquares[ch] / samples);
+		rtData.channelRMS[ch] = rmsLinear > 0.0 ? AWHMath::RoundTo(AWHAudio::LinearToDb(rmsLinear), 1) : -INFINITY;
+		rtData.channelSamplePeaks[ch] = peaks[ch] > 0.0 ? AWHMath::RoundTo(AWHAudio::LinearToDb(peaks[ch]), 1) : -INFINITY;
+	}
+}
+
+template <size_t CHANNELS>
+void AudioWizardAnalysisRealTime::ProcessChannelLevelsKernel(const ChunkData& chkData, double* sumSquares, double* peaks) {
+	const size_t channels = CHANNELS > 0 ? CHANNELS : chkData.channels;
+	const audioType* samples = chkData.data;
+
+	if constexpr (CHANNELS > 0) {
+		std::array<double, CHANNELS> sums{};
+		std::array<double, CHANNELS> maxima{};
+
+		for (size_t i = 0; i < chkData.frames; ++i, samples += CHANNELS) {
+			for (size_t ch = 0; ch < CHANNELS; ++ch) {
+				const double sample = samples[ch];
+				sums[ch] += sample * sample;
+				maxima[ch] = std::max(maxima[ch], std::abs(sample));
+			}
+		}
+
+		std::copy(sums.begin(), sums.end(), sumSquares);
+		std::copy(maxima.begin(), maxima.end(), peaks);
+	}
+	else {
+		for (size_t i = 0; i < chkData.frames; ++i, samples += channels) {
+			for (size_t ch = 0; ch < channels; ++ch) {
+				const double sample = samples[ch];
+				sumSquares[ch] += sample * sample;
+				peaks[ch] = std::max(peaks[ch], std::abs(sample));
+			}
+		}
+	}
+}
 #pragma endregion
 
 
@@ -2312,17 +2516,14 @@ void AudioWizardAnalysisRealTime::InitRealTimeState(const ChunkData& chkData, Re
 	rtData.loudnessHistory10s.reset(std::min(blocks10s, BufferSettings::BUFFER_CAPACITY_HISTORY_MID));
 	rtData.kWeightedBuffer.reset(static_cast<size_t>(3.0 * chkData.sampleRate)); // 3s for K-weighting
 	rtData.shortTermLUFSBuffer.reset(static_cast<size_t>(30.0 * chkData.sampleRate / rtData.blockSize)); // 30s
-	rtData.integratedLUFSBuffer.reset(static_cast<size_t>(30.0 * chkData.sampleRate / rtData.blockSize)); // 30s
-
-	// DR buffers
-	auto chunksPer3Seconds = static_cast<size_t>(3.0 * chkData.sampleRate / chkData.frames); // 3s window (30 chunks at 100ms)
-	rtData.drRMSBuffer.reset(chunksPer3Seconds);
-	rtData.drPeakBuffer.reset(chunksPer3Seconds);
-	rtData.drRMSBufferLeft.reset(chunksPer3Seconds);
-	rtData.drRMSBufferRight.reset(chunksPer3Seconds);
-	rtData.drPeakBufferLeft.reset(chunksPer3Seconds);
-	rtData.drPeakBufferRight.reset(chunksPer3Seconds);
-	rtData.drPrevious = 0.0;
+	rtData.integratedLUFSBuffer.reset(4); // 400ms gating window (4 blocks)
+	rtData.pureDynamicsBlockLoudness.reset(static_cast<size_t>(1500.0 / rtData.blockDurationMs)); // 1.5s
+	rtData.integratedHistogramCounts.assign(801, 0); // -70 to +10 LUFS in 0.1 LU bins
+	rtData.integratedHistogramPowers.assign(801, 0.0);
+
+	// DR blocks
+	rtData.drBlockSize = static_cast<size_t>(3.0 * chkData.sampleRate); // 3s blocks per DR14
+	ResetDynamicRange(rtData);
 
 	// Dynamics
 	double targetBinWidth = chkData.sampleRate / rtData.blockSize; // Frequency resolution based on blockSize
@@ -2331,43 +2532,107 @@ void AudioWizardAnalysisRealTime::InitRealTimeState(const ChunkData& chkData, Re
 	rtData.barkWeights = AWHAudioFFT::ComputeBarkWeights(chkData.sampleRate);
 	rtData.bandPowersHistory.reset(10 * AWHAudioFFT::BARK_BAND_NUMBER);
 
-	AudioWizardAnalysisFilter::InitInterpolation(chkData, rtData.filterData);
+	// Scratch arena, sized once so the steady-state chunk path does not allocate
+	rtData.kWeightedScratch.reserve(static_cast<size_t>(chkData.sampleRate)); // 1s, covers any catch-up slice
+	rtData.fftBlockSamples.assign(rtData.fftSize, 0.0);
+	rtData.fftOutput.resize(rtData.fftSize);
+	rtData.powerSpectrum.resize(rtData.fftSize / 2 + 1);
+
+	AudioWizardAnalysisFilter::InitInterpolation(chkData, rtData.filterData, true);
+}
+
+void AudioWizardAnalysisRealTime::ResetIntegratedLUFS(RealTimeData& rtData) {
+	rtData.currentBlockSum = 0.0;
+	rtData.currentBlockFrames = 0;
+	rtData.integratedLUFSBuffer.clear();
+	std::fill(rtData.integratedHistogramCounts.begin(), rtData.integratedHistogramCounts.end(), 0);
+	std::fill(rtData.integratedHistogramPowers.begin(), rtData.integratedHistogramPowers.end(), 0.0);
+	rtData.integratedBlockCount = 0;
+	rtData.integratedPowerSum = 0.0;
+	rtData.gatedBlockCount = 0;
+	rtData.gatedPowerSum = 0.0;
+	rtData.integratedLUFS = -INFINITY;
+	rtData.PLR = -INFINITY;
+}
+
+void AudioWizardAnalysisRealTime::ResetDynamicRange(RealTimeData& rtData) {
+	for (auto& drChannel : rtData.drChannels) {
+		drChannel.clear();
+	}
+	rtData.drBlockSumSquares.fill(0.0);
+	rtData.drBlockPeak.fill(0.0);
+	rtData.drBlockFrames = 0;
+	rtData.dynamicRange = -INFINITY;
+}
+
+void AudioWizardAnalysisRealTime::ResetTrackState(RealTimeData& rtData) {
+	ResetIntegratedLUFS(rtData);
+	ResetDynamicRange(rtData);
 }
 
 void AudioWizardAnalysisRealTime::ProcessRealtimeChunk(const ChunkData& chkData, RealTimeData& rtData) {
 	InitRealTimeState(chkData, rtData);
 
+	AW_STAGE_TIMER(timer, rtData.profile);
+	AW_STAGE_COUNT(rtData.profile, chunks, 1);
+	AW_STAGE_COUNT(rtData.profile, frames, chkData.frames);
+
+	// Switch the true peak interpolator when the governor tier changes its oversampling limit, both are built on init
+	const unsigned int maxOversampling = rtData.qualityTier >= AWHPerf::QualityGovernor::TIER_LOW_OVERSAMPLING ? 2 : 4;
+	if (rtData.filterData.maxOversampling != maxOversampling) {
+		AudioWizardAnalysisFilter::SelectInterpolation(rtData.filterData, maxOversampling);
+	}
+
 	// Process K-weighted chunk
-	std::vector<double> tempBuffer;
+	std::vector<double>& tempBuffer = rtData.kWeightedScratch;
+	tempBuffer.clear();
 	AudioWizardAnalysisFilter::ProcessKWeightedChunk(chkData, rtData.filterData, tempBuffer);
 	rtData.kWeightedBuffer.append(tempBuffer);
+	AW_STAGE_LAP(timer, STAGE_K_WEIGHTING);
 
 	// Compute and store Short-Term LUFS
-	rtData.shortTermLUFS = AWHMath::RoundTo(GetShortTermLUFS(chkData, rtData), 1);
+	const double shortTermLUFS = GetShortTermLUFS(chkData, rtData);
+	rtData.shortTermLUFS = AWHMath::RoundTo(shortTermLUFS, 1);
 	rtData.shortTermLUFSBuffer.pushBack(rtData.shortTermLUFS);
 
 	// Process integrated LUFS
 	ProcessIntegratedLUFS(tempBuffer, rtData);
+	AW_STAGE_LAP(timer, STAGE_LOUDNESS);
 
-	// Process Dynamics
+	// Process Dynamics, the spectral stages are charged inside ProcessDynamicsFactors
 	ProcessDynamicsFactors(chkData, rtData);
+	AW_STAGE_SKIP(timer);
 
-	// Compute other metrics
-	auto [leftFrameRMS, rightFrameRMS] = ProcessFrameRMS(chkData);
-	auto [leftFramePeak, rightFramePeak] = ProcessFramePeaks(chkData);
-	rtData.leftRMS = AWHMath::RoundTo(leftFrameRMS, 1);
-	rtData.rightRMS = AWHMath::RoundTo(rightFrameRMS, 1);
-	rtData.leftSamplePeak = AWHMath::RoundTo(leftFramePeak, 1);
-	rtData.rightSamplePeak = AWHMath::RoundTo(rightFramePeak, 1);
+	// Per-channel RMS and sample peaks in a single pass, left/right follow channels 0/1 (or mono)
+	ProcessChannelLevels(chkData, rtData);
+	if (!rtData.channelRMS.empty()) {
+		const size_t right = std::min<size_t>(1, rtData.channelRMS.size() - 1);
+		rtData.leftRMS = rtData.channelRMS[0];
+		rtData.rightRMS = rtData.channelRMS[right];
+		rtData.leftSamplePeak = rtData.channelSamplePeaks[0];
+		rtData.rightSamplePeak = rtData.channelSamplePeaks[right];
+	}
+	AW_STAGE_LAP(timer, STAGE_CHANNEL_LEVELS);
 
+	// Compute other metrics
 	rtData.momentaryLUFS = AWHMath::RoundTo(GetMomentaryLUFS(chkData, rtData), 1);
-	rtData.truePeak = AWHMath::RoundTo(GetTruePeak(chkData, rtData), 1);
-	rtData.RMS = AWHMath::RoundTo(GetRMS(chkData), 1);
-	rtData.PSR = AWHMath::RoundTo(GetPSR(chkData, rtData), 1);
-	rtData.crestFactor = AWHMath::RoundTo(GetCrestFactor(chkData), 1);
+	AW_STAGE_LAP(timer, STAGE_LOUDNESS);
+	const double truePeak = GetTruePeak(chkData, rtData); // Advances the interpolator state, compute once per chunk
+	rtData.truePeak = AWHMath::RoundTo(truePeak, 1);
+	AW_STAGE_LAP(timer, STAGE_TRUE_PEAK);
+	rtData.RMS = AWHMath::RoundTo(GetRMS(chkData, rtData), 1);
+	rtData.PSR = AWHMath::RoundTo(GetPSR(truePeak, shortTermLUFS), 1);
+	rtData.crestFactor = AWHMath::RoundTo(GetCrestFactor(chkData, rtData), 1);
+	AW_STAGE_LAP(timer, STAGE_CHANNEL_LEVELS);
 	rtData.dynamicRange = AWHMath::RoundTo(GetDynamicRange(chkData, rtData), 1);
 	rtData.pureDynamics = AWHMath::RoundTo(GetPureDynamics(chkData, rtData), 1);
-	rtData.phaseCorrelation = AWHMath::RoundTo(GetPhaseCorrelation(chkData), 1);
-	rtData.stereoWidth = AWHMath::RoundTo(GetStereoWidth(chkData), 1);
+	AW_STAGE_LAP(timer, STAGE_DYNAMIC_RANGE);
+
+	// Spatial metrics hold their last value while the governor sheds load
+	if (rtData.qualityTier < AWHPerf::QualityGovernor::TIER_NO_SPATIAL) {
+		rtData.phaseCorrelation = AWHMath::RoundTo(GetPhaseCorrelation(chkData), 1);
+		rtData.stereoWidth = AWHMath::RoundTo(GetStereoWidth(chkData), 1);
+		AW_STAGE_LAP(timer, STAGE_SPATIAL);
+	}
 }
 #pragma endregion
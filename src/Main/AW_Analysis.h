@@ -26,9 +26,14 @@ public:
 	AudioWizardAnalysisInterpolator(WindowType window, unsigned int taps, unsigned int factor, unsigned int channels);
 
 	size_t ProcessInterpolation(size_t frames, const audioType* in, audioType* out);
-	static double CalculateTruePeakLinear(const ChunkData& chkData, AudioWizardAnalysisInterpolator* interp);
+	void ResetInterpolation();
+	static double CalculateTruePeakLinear(const ChunkData& chkData, AudioWizardAnalysisInterpolator* interp,
+		std::vector<double>* channelPeaks = nullptr
+	);
 
 private:
+	static constexpr size_t BLOCK_SIZE = 4096; // Frames interpolated per pass
+
 	struct Filter {
 		std::vector<double> coeff;
 		std::vector<unsigned int> index;
@@ -44,6 +49,9 @@ private:
 		std::vector<std::vector<double>> z;
 	}; InterpolationParams interpolation;
 
+	// Interpolated output scratch, reserved for BLOCK_SIZE frames on construction and reused across chunks
+	std::vector<audioType> block;
+
 	void SetInterpolatorWindow(WindowType window);
 };
 #pragma endregion
@@ -77,6 +85,8 @@ public:
 
 	struct FilterData {
 		std::unique_ptr<AudioWizardAnalysisInterpolator> interp;
+		std::unique_ptr<AudioWizardAnalysisInterpolator> interpReduced; // At most 2x, only built for the governed real-time analysis
+		AudioWizardAnalysisInterpolator* activeInterp = nullptr;         // interp or interpReduced, switched without allocating
 		double sampleRate = 0.0;
 		std::vector<double> channelWeights;
 		std::vector<std::vector<FilterCoeffs>> lowPassFilterCoeffs;
@@ -85,6 +95,7 @@ public:
 		std::vector<FilterState> preFilterStates;
 		std::vector<FilterCoeffs> rlbFilterCoeffs;
 		std::vector<FilterState> rlbFilterStates;
+		unsigned int maxOversampling = 0;
 	};
 
 	// Precomputed K-Weighted Pre-Filter coefficients generated by GNU Octave 10.2.0
@@ -120,7 +131,8 @@ public:
 	static void DesignKWeightedRLBFilter(FilterCoeffs& coeffs, double sampleRate);
 	static void ProcessKWeightedChunk(const ChunkData& chkData, FilterData& ftData, std::vector<double>& buffer);
 	static double GetChannelWeight(size_t index, size_t channels);
-	static void InitInterpolation(const ChunkData& chkData, FilterData& ftData);
+	static void InitInterpolation(const ChunkData& chkData, FilterData& ftData, bool withReducedOversampling = false);
+	static void SelectInterpolation(FilterData& ftData, unsigned int maxOversampling);
 };
 #pragma endregion
 
@@ -197,6 +209,13 @@ public:
 		double kWeightedSumSquares = 0.0;
 		audioType samplePeakMaxLinear = 0.0;
 		audioType truePeakMaxLinear = 0.0;
+
+		// Per-stage timings and counters of this track
+		AWHPerf::StageProfile profile;
+
+		// Memory accounting, refreshed by ProcessFullTrackMemory
+		AWHPerf::MemoryCharge bufferMemory{ AWHPerf::MemoryAccounting::CATEGORY_FULL_TRACK_BUFFERS };
+		AWHPerf::MemoryCharge blockMemory{ AWHPerf::MemoryAccounting::CATEGORY_FULL_TRACK_BLOCKS };
 	};
 
 	struct FullTrackDataDynamics {
@@ -314,6 +333,7 @@ public:
 	static void TestSyntheticInput(const FullTrackData& ftData);
 	static void ResetFullTrackData(FullTrackData& ftData);
 	static void ProcessFullTrackChunk(const ChunkData& chkData, FullTrackData& ftData);
+	static void ProcessFullTrackMemory(FullTrackData& ftData);
 	static void ProcessFullTrackResults(metadb_handle_ptr track, const FullTrackData& ftData, FullTrackResults& ftResult);
 };
 #pragma endregion
@@ -330,6 +350,30 @@ public:
 	using BufferSettings = AWHAudioBuffer::BufferSettings;
 	using RingBufferSimple = AWHAudioBuffer::RingBufferSimple;
 
+	struct RealTimeDynamicsScratch { // Pure Dynamics pipeline buffers, kept in RealTimeData and reused every block
+		std::vector<double> blockLoudness;
+		std::vector<double> correctedLoudness;
+		std::vector<double> adaptedLoudness;
+		std::vector<double> transientBoosts;
+		std::vector<double> fastlAdjustments;
+		std::vector<double> loudnessNormalized;
+		std::vector<double> validLoudness;
+		std::vector<double> temporalWeights;
+		std::vector<double> windowLoudness;
+		std::vector<double> shortSpreads;
+		std::vector<double> spreadWeights;
+		std::vector<std::vector<double>> bandPowers;
+		std::vector<double> frequencyPowers;
+		std::vector<double> spectralCentroid;
+		std::vector<double> spectralFlatness;
+		std::vector<double> spectralFlux;
+		std::vector<double> harmonicComplexityFactor;
+		std::vector<double> maskingFactor;
+		std::vector<double> stereoBuffer;
+		std::vector<double> leftChannel;
+		std::vector<double> rightChannel;
+	};
+
 	struct RealTimeData {
 		// Configuration and Metadata
 		size_t blockSize = 0;
@@ -343,12 +387,6 @@ public:
 		RingBufferSimple kWeightedBuffer{ 1 };
 		RingBufferSimple shortTermLUFSBuffer{ 1 };
 		RingBufferSimple integratedLUFSBuffer{ 1 };
-		RingBufferSimple drRMSBuffer{ 1 };
-		RingBufferSimple drPeakBuffer{ 1 };
-		RingBufferSimple drRMSBufferLeft{ 1 };
-		RingBufferSimple drRMSBufferRight{ 1 };
-		RingBufferSimple drPeakBufferLeft{ 1 };
-		RingBufferSimple drPeakBufferRight{ 1 };
 		RingBufferSimple loudnessHistory100ms{ 1 };
 		RingBufferSimple loudnessHistory1s{ 1 };
 		RingBufferSimple loudnessHistory10s{ 1 };
@@ -360,9 +398,29 @@ public:
 		size_t gatedBlockCount = 0;
 		double gatedPowerSum = 0.0;
 		double gatingLoudnessEMA = 0.0;
-		double drPrevious = 0.0;
 		double pureDynamicsEMA = 0.0;
 
+		// Pure Dynamics block loudness window (1.5s of 100ms blocks), fed as each block completes
+		RingBufferSimple pureDynamicsBlockLoudness{ 1 };
+		double pureDynamicsLoudnessSum = 0.0;
+		double pureDynamicsLoudnessSumSquares = 0.0;
+		size_t pureDynamicsLoudnessCount = 0;
+		size_t pureDynamicsBlocksSinceResync = 0;
+		size_t pureDynamicsPendingBlocks = 0;
+
+		// Integrated loudness histogram of 400ms gating blocks, 0.1 LU bins, index = (lkfs * 10) + 700
+		std::vector<size_t> integratedHistogramCounts;
+		std::vector<double> integratedHistogramPowers;
+		size_t integratedBlockCount = 0;
+		double integratedPowerSum = 0.0;
+
+		// Dynamic range (DR14), per-channel 3s blocks for left/right or mono
+		std::array<AWHAudioDynamics::DynamicRangeChannel, 2> drChannels;
+		std::array<double, 2> drBlockSumSquares{};
+		std::array<double, 2> drBlockPeak{};
+		size_t drBlockFrames = 0;
+		size_t drBlockSize = 0;
+
 		// Dynamics
 		size_t fftSize = 0;
 		std::array<double, AWHAudioFFT::BARK_BAND_NUMBER> barkWeights;
@@ -379,6 +437,37 @@ public:
 		double spectralFlatnessSum;
 		double spectralFluxSum;
 		double genreFactor;
+		size_t fftCadenceCounter = 0;
+
+		// Quality tier set by the real-time governor (AWHPerf::QualityGovernor::Tier)
+		int qualityTier = 0;
+
+		// Per-stage timings and counters since monitoring started
+		AWHPerf::StageProfile profile;
+
+		// Scratch arena, pre-sized in InitRealTimeState and reused every chunk
+		std::vector<double> kWeightedScratch;
+		std::vector<double> fftBlockSamples;
+		std::vector<std::complex<double>> fftOutput;
+		std::vector<double> powerSpectrum;
+		RealTimeDynamicsScratch dynamicsScratch;
+
+		// Display spectrum of the latest 100ms window, only maintained while spectrumActive is set
+		bool spectrumActive = false;
+		bool spectrumFresh = false;
+		std::vector<audioType> spectrumInput;
+		std::vector<double> spectrumPower;
+		std::vector<double> spectrumBarkPowers;
+
+		// Per-channel linear accumulators of the current chunk, in source channel order
+		std::vector<double> channelSumSquares;
+		std::vector<double> channelPeaksLinear;
+		std::vector<double> channelTruePeaksLinear;
+
+		// Per-channel Metrics (dB), in source channel order
+		std::vector<double> channelRMS;
+		std::vector<double> channelSamplePeaks;
+		std::vector<double> channelTruePeaks;
 
 		// Metrics
 		double momentaryLUFS = -INFINITY;
@@ -415,26 +504,26 @@ public:
 		double integratedLUFS = -INFINITY;
 		double prevLufs = -INFINITY;
 		double stableDuration = 0.0;
-		std::vector<double> blockLoudness;
-		std::vector<double> correctedLoudness;
-		std::vector<double> adaptedLoudness;
-		std::vector<double> transientBoosts;
+		std::vector<double>& blockLoudness = rtData.dynamicsScratch.blockLoudness;
+		std::vector<double>& correctedLoudness = rtData.dynamicsScratch.correctedLoudness;
+		std::vector<double>& adaptedLoudness = rtData.dynamicsScratch.adaptedLoudness;
+		std::vector<double>& transientBoosts = rtData.dynamicsScratch.transientBoosts;
 
 		// Spectral Features
-		std::vector<std::vector<double>> bandPowers;
-		std::vector<double> frequencyPowers;
-		std::vector<double> spectralCentroid;
-		std::vector<double> spectralFlatness;
-		std::vector<double> spectralFlux;
+		std::vector<std::vector<double>>& bandPowers = rtData.dynamicsScratch.bandPowers;
+		std::vector<double>& frequencyPowers = rtData.dynamicsScratch.frequencyPowers;
+		std::vector<double>& spectralCentroid = rtData.dynamicsScratch.spectralCentroid;
+		std::vector<double>& spectralFlatness = rtData.dynamicsScratch.spectralFlatness;
+		std::vector<double>& spectralFlux = rtData.dynamicsScratch.spectralFlux;
 
 		// Psychoacoustic Factors
-		std::vector<double> harmonicComplexityFactor;
-		std::vector<double> maskingFactor;
+		std::vector<double>& harmonicComplexityFactor = rtData.dynamicsScratch.harmonicComplexityFactor;
+		std::vector<double>& maskingFactor = rtData.dynamicsScratch.maskingFactor;
 
 		// Binaural Processing
-		std::vector<double> stereoBuffer;
-		std::vector<double> leftChannel;
-		std::vector<double> rightChannel;
+		std::vector<double>& stereoBuffer = rtData.dynamicsScratch.stereoBuffer;
+		std::vector<double>& leftChannel = rtData.dynamicsScratch.leftChannel;
+		std::vector<double>& rightChannel = rtData.dynamicsScratch.rightChannel;
 
 		// Dynamics Metrics
 		double variance = 0.0;
@@ -444,11 +533,11 @@ public:
 	// * METRICS * //
 	static double GetMomentaryLUFS(const ChunkData& chkData, const RealTimeData& rtData);
 	static double GetShortTermLUFS(const ChunkData& chkData, const RealTimeData& rtData);
-	static double GetRMS(const ChunkData& chkData);
+	static double GetRMS(const ChunkData& chkData, const RealTimeData& rtData);
 	static double GetTruePeak(const ChunkData& chkData, RealTimeData& rtData);
-	static double GetPSR(const ChunkData& chkData, RealTimeData& rtData);
+	static double GetPSR(double truePeak, double shortTermLUFS);
 	static double GetPLR(double truePeak, double integratedLUFS);
-	static double GetCrestFactor(const ChunkData& chkData);
+	static double GetCrestFactor(const ChunkData& chkData, const RealTimeData& rtData);
 	static double GetDynamicRange(const ChunkData& chkData, RealTimeData& rtData);
 	static double GetPureDynamics(const ChunkData& chkData, RealTimeData& rtData);
 	static double GetPhaseCorrelation(const ChunkData& chkData);
@@ -464,16 +553,24 @@ public:
 	static void ProcessDynamicsTransientBoostsAdjustment(RealTimeDataDynamics& dynamics);
 	static void ProcessDynamicsSpread(RealTimeDataDynamics& dynamics);
 	static void ProcessDynamicsFactors(const ChunkData& chkData, RealTimeData& rtData);
+	static void ProcessSpectrum(const ChunkData& chkData, RealTimeData& rtData, bool hasLastBlockSpectrum);
 
 	// * GENERAL PROCESSING * //
 	static double ProcessLUFS(const RingBufferSimple& buffer, size_t maxSamples);
 	static void ProcessIntegratedLUFS(const std::vector<double>& tempBuffer, RealTimeData& rtData);
+	static void ProcessIntegratedLUFSGating(RealTimeData& rtData);
+	static void ProcessPureDynamicsBlock(double blockSum, RealTimeData& rtData);
 	static std::pair<double, double> ProcessFrameRMS(const ChunkData& chkData);
-	static double ProcessFramePeak(const ChunkData& chkData);
 	static std::pair<double, double> ProcessFramePeaks(const ChunkData& chkData);
+	static void ProcessChannelLevels(const ChunkData& chkData, RealTimeData& rtData);
+	template <size_t CHANNELS>
+	static void ProcessChannelLevelsKernel(const ChunkData& chkData, double* sumSquares, double* peaks);
 
 	// * MAIN PROCESSING * //
 	static void InitRealTimeState(const ChunkData& chkData, RealTimeData& rtData);
+	static void ResetIntegratedLUFS(RealTimeData& rtData);
+	static void ResetDynamicRange(RealTimeData& rtData);
+	static void ResetTrackState(RealTimeData& rtData);
 	static void ProcessRealtimeChunk(const ChunkData& chkData, RealTimeData& rtData);
 };
 #pragma endregion
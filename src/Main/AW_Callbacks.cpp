@@ -47,6 +47,7 @@ void AudioWizardCallbacks::on_playback_edited(metadb_handle_ptr p_track) noexcep
 
 void AudioWizardCallbacks::on_playback_new_track(metadb_handle_ptr p_track) noexcept {
 	ApplyFadeIn();
+	AudioWizard::Main()->mainRealTime->ResetTrackMetrics();
 }
 
 void AudioWizardCallbacks::on_playback_pause(bool b_state) noexcept {
@@ -48,7 +48,213 @@ namespace AWHAudio {
 //////////////////////////////
 #pragma region Audio Buffer Helpers
 namespace AWHAudioBuffer {
-	// At the moment not used here but in the header
+	SharedAudioRing::~SharedAudioRing() {
+		Close();
+	}
+
+	bool SharedAudioRing::Create(const std::string& name, uint32_t capacityFrames) {
+		Close();
+
+		// Power of two capacity, so a slot is a mask of the position and never a division
+		uint32_t frames = MIN_CAPACITY_FRAMES;
+		while (frames < std::min(capacityFrames, MAX_CAPACITY_FRAMES)) frames <<= 1;
+
+		const size_t bytes = sizeof(Header) + static_cast<size_t>(frames) * MAX_CHANNELS * sizeof(float);
+		if (!MapRegion(name, bytes, true)) return false;
+
+		header->magic = MAGIC;
+		header->version = VERSION;
+		header->headerBytes = sizeof(Header);
+		header->capacityFrames = frames;
+		header->maxChannels = MAX_CHANNELS;
+		header->channels.store(0, std::memory_order_relaxed);
+		header->sampleRate.store(0, std::memory_order_relaxed);
+		header->formatSequence.store(0, std::memory_order_relaxed);
+		header->reservedPosition.store(0, std::memory_order_relaxed);
+		header->writePosition.store(0, std::memory_order_release);
+
+		return true;
+	}
+
+	bool SharedAudioRing::Attach(const std::string& name) {
+		Close();
+
+		if (!MapRegion(name, 0, false)) return false;
+
+		// The sample area is indexed by the header fields, so they must describe a ring that fits the mapping
+		const uint32_t frames = header->capacityFrames;
+		const bool isValidLayout = frames != 0 && (frames & (frames - 1)) == 0 && header->maxChannels != 0 &&
+			header->maxChannels <= MAX_CHANNELS && mappingBytes >= sizeof(Header) + static_cast<size_t>(frames) * header->maxChannels * sizeof(float);
+
+		if (header->magic != MAGIC || header->version != VERSION || header->headerBytes != sizeof(Header) || !isValidLayout) {
+			FB2K_console_formatter() << "Audio Wizard => SharedAudioRing: Incompatible ring " << name.c_str();
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	void SharedAudioRing::Close() {
+#ifdef _WIN32
+		if (header) UnmapViewOfFile(header);
+		if (mapping) CloseHandle(mapping);
+		mapping = nullptr;
+#else
+		if (header) munmap(header, mappingBytes);
+		if (descriptor >= 0) close(descriptor);
+		if (isOwner) shm_unlink(GetPlatformName(mappingName).c_str());
+		descriptor = -1;
+		isOwner = false;
+#endif
+		header = nullptr;
+		samples = nullptr;
+		mappingBytes = 0;
+		mappingName.clear();
+	}
+
+	void SharedAudioRing::Write(const audioType* data, size_t frames, uint32_t channels, uint32_t sampleRate) {
+		if (!header || !data || frames == 0 || channels == 0) return;
+
+		const uint32_t ringChannels = std::min(channels, header->maxChannels);
+		const uint64_t capacity = header->capacityFrames;
+		const uint64_t mask = capacity - 1;
+
+		// Only the newest capacity frames of an oversized block can survive anyway
+		if (frames > capacity) {
+			data += (frames - capacity) * channels;
+			frames = static_cast<size_t>(capacity);
+		}
+
+		if (ringChannels != header->channels.load(std::memory_order_relaxed) ||
+			sampleRate != header->sampleRate.load(std::memory_order_relaxed)) {
+			header->channels.store(ringChannels, std::memory_order_relaxed);
+			header->sampleRate.store(sampleRate, std::memory_order_relaxed);
+			header->formatSequence.fetch_add(1, std::memory_order_release);
+		}
+
+		const uint64_t position = header->writePosition.load(std::memory_order_relaxed);
+		header->reservedPosition.store(position + frames, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release); // Reservation is visible before any slot is overwritten
+
+		for (size_t f = 0; f < frames; ++f) {
+			float* slot = samples + ((position + f) & mask) * header->maxChannels;
+			const audioType* frame = data + f * channels;
+			for (uint32_t ch = 0; ch < ringChannels; ++ch) {
+				slot[ch] = static_cast<float>(frame[ch]);
+			}
+		}
+
+		header->writePosition.store(position + frames, std::memory_order_release);
+	}
+
+	size_t SharedAudioRing::Read(ReaderState& state, float* out, size_t maxFrames, uint32_t& channels, uint32_t& sampleRate) const {
+		if (!header || !out || maxFrames == 0) return 0;
+
+		const uint32_t formatSequence = header->formatSequence.load(std::memory_order_acquire);
+		channels = header->channels.load(std::memory_order_acquire);
+		sampleRate = header->sampleRate.load(std::memory_order_acquire);
+		const uint64_t writePosition = header->writePosition.load(std::memory_order_acquire);
+		const uint64_t capacity = header->capacityFrames;
+		const uint64_t mask = capacity - 1;
+
+		// A new reader or a new format starts at the live edge
+		if (!state.isSynced || state.formatSequence != formatSequence || state.position > writePosition) {
+			state.position = writePosition;
+			state.formatSequence = formatSequence;
+			state.isSynced = true;
+			return 0;
+		}
+
+		// A reader that fell a full ring behind skips to the oldest frame still held
+		if (writePosition - state.position > capacity) {
+			state.position = writePosition - capacity;
+		}
+
+		const size_t frames = static_cast<size_t>(std::min<uint64_t>(writePosition - state.position, maxFrames));
+		for (size_t f = 0; f < frames; ++f) {
+			const float* slot = samples + ((state.position + f) & mask) * header->maxChannels;
+			std::copy_n(slot, channels, out + f * channels);
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const uint64_t reservedPosition = header->reservedPosition.load(std::memory_order_relaxed);
+
+		if (header->formatSequence.load(std::memory_order_relaxed) != formatSequence) {
+			state.isSynced = false;
+			return 0;
+		}
+
+		// Frames the writer overwrote while they were being copied are dropped from the front
+		const uint64_t oldestValid = reservedPosition > capacity ? reservedPosition - capacity : 0;
+		size_t dropped = 0;
+		if (state.position < oldestValid) {
+			dropped = static_cast<size_t>(std::min<uint64_t>(oldestValid - state.position, frames));
+			std::copy(out + dropped * channels, out + frames * channels, out);
+		}
+
+		state.position += frames;
+		return frames - dropped;
+	}
+
+	bool SharedAudioRing::MapRegion(const std::string& name, size_t bytes, bool create) {
+		const std::string platformName = GetPlatformName(name);
+
+#ifdef _WIN32
+		const std::wstring wideName = pfc::stringcvt::string_wide_from_utf8(platformName.c_str()).get_ptr();
+		mapping = create ?
+			CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+				static_cast<DWORD>(static_cast<uint64_t>(bytes) >> 32), static_cast<DWORD>(bytes), wideName.c_str()) :
+			OpenFileMappingW(FILE_MAP_READ, FALSE, wideName.c_str());
+
+		void* view = mapping ? MapViewOfFile(mapping, create ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, bytes) : nullptr;
+
+		if (view && !create) {
+			MEMORY_BASIC_INFORMATION info = {};
+			bytes = VirtualQuery(view, &info, sizeof(info)) ? info.RegionSize : 0;
+		}
+#else
+		descriptor = create ? shm_open(platformName.c_str(), O_CREAT | O_RDWR, 0600) : shm_open(platformName.c_str(), O_RDONLY, 0);
+		isOwner = create && descriptor >= 0;
+
+		if (descriptor >= 0 && create && ftruncate(descriptor, static_cast<off_t>(bytes)) != 0) {
+			bytes = 0;
+		}
+		if (descriptor >= 0 && !create) {
+			const off_t size = lseek(descriptor, 0, SEEK_END);
+			bytes = size > 0 ? static_cast<size_t>(size) : 0;
+		}
+
+		void* view = descriptor >= 0 && bytes >= sizeof(Header) ?
+			mmap(nullptr, bytes, create ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, descriptor, 0) : nullptr;
+		if (view == MAP_FAILED) view = nullptr;
+#endif
+
+		mappingName = name;
+
+		if (!view || bytes < sizeof(Header)) {
+			FB2K_console_formatter() << "Audio Wizard => SharedAudioRing: Failed to map " << platformName.c_str();
+#ifdef _WIN32
+			if (view) UnmapViewOfFile(view);
+#endif
+			Close();
+			return false;
+		}
+
+		header = static_cast<Header*>(view);
+		samples = reinterpret_cast<float*>(static_cast<uint8_t*>(view) + sizeof(Header));
+		mappingBytes = bytes;
+
+		return true;
+	}
+
+	std::string SharedAudioRing::GetPlatformName(const std::string& name) {
+#ifdef _WIN32
+		return "Local\\" + name; // Session namespace, no privilege needed unlike Global
+#else
+		return "/" + name;
+#endif
+	}
 }
 #pragma endregion
 
@@ -362,16 +568,18 @@ namespace AWHAudioDSP {
 			w *= scale;
 		}
 
+		AWHAudioFFT::ProcessCacheMemory();
 		return window;
 	}
 
-	std::vector<double> NormalizeLoudness(const std::vector<double>& loudness, double blockDurationMs, double windowMs) {
+	void NormalizeLoudness(const std::vector<double>& loudness, double blockDurationMs, double windowMs, std::vector<double>& normalizedLoudness) {
 		if (loudness.empty() || blockDurationMs <= 0.0) {
-			return loudness;
+			normalizedLoudness = loudness;
+			return;
 		}
 
 		const size_t blockCount = loudness.size();
-		std::vector<double> normalizedLoudness(blockCount);
+		normalizedLoudness.resize(blockCount);
 		const size_t normWindowBlocks = std::max<size_t>(1, static_cast<size_t>(std::round(windowMs / blockDurationMs)));
 
 		for (size_t i = 0; i < blockCount; ++i) {
@@ -393,8 +601,6 @@ namespace AWHAudioDSP {
 			double avg = count > 0 ? sum / count : 0.0;
 			normalizedLoudness[i] = loudness[i] - avg;
 		}
-
-		return normalizedLoudness;
 	}
 
 	void ResampleToSampleRate(const ChunkData& inputChunk, ChunkData& outputChunk,
@@ -692,7 +898,8 @@ namespace AWHAudioDynamics {
 		}
 
 		double stabilityScore = 1.0 - std::clamp(std::log1p(variance) / std::log1p(35.0), 0.0, 1.0);
-		double entropy = AWHMath::CalculateEntropy({ transientScore, rhythmScore, spectralScore, stabilityScore });
+		const std::array<double, 4> features = { transientScore, rhythmScore, spectralScore, stabilityScore };
+		double entropy = AWHMath::CalculateEntropy(features);
 
 		double genreWeight = spectralWeight * spectralScore + rhythmWeight * rhythmScore + transientWeight * transientScore + stabilityWeight * stabilityScore;
 		genreWeight *= (0.9 + 0.1 * entropy);
@@ -716,18 +923,20 @@ namespace AWHAudioDynamics {
 		if (isRealTime && history && history->size() >= AWHAudioFFT::BARK_BAND_NUMBER) {
 			size_t maxHistoryBlocks = 10;
 			size_t historyBlocks = std::min(maxHistoryBlocks, history->size() / AWHAudioFFT::BARK_BAND_NUMBER);
-			std::vector<std::vector<double>> historyVec;
-			historyVec.reserve(historyBlocks);
+			// Thread-local storage, reused so the real-time thread does not allocate once sized
+			static thread_local std::vector<std::vector<double>> historyVec;
+			historyVec.resize(historyBlocks);
 			for (size_t i = 0; i < historyBlocks; ++i) {
-				std::vector<double> blockPowers(AWHAudioFFT::BARK_BAND_NUMBER);
+				historyVec[i].resize(AWHAudioFFT::BARK_BAND_NUMBER);
 				for (size_t j = 0; j < AWHAudioFFT::BARK_BAND_NUMBER; ++j) {
-					blockPowers[j] = (*history)[i * AWHAudioFFT::BARK_BAND_NUMBER + j];
+					historyVec[i][j] = (*history)[i * AWHAudioFFT::BARK_BAND_NUMBER + j];
 				}
-				historyVec.push_back(blockPowers);
 			}
 			f_mod_shared = AWHAudioFFT::EstimateModulationFrequency(historyVec, historyBlocks - 1, frameTimeMs, 0, 6);
 		}
 
+		static thread_local std::vector<double> f_mod_vec(AWHAudioFFT::BARK_BAND_NUMBER);
+
 		for (size_t i = 0; i < blockCount; ++i) {
 			if (blockLoudness[i] <= -100.0 || i >= bandPowers.size() ||
 				bandPowers[i].size() != AWHAudioFFT::BARK_BAND_NUMBER) {
@@ -761,7 +970,7 @@ namespace AWHAudioDynamics {
 
 			// Psychoacoustic metrics with real-time optimization
 			double fluctuation = ComputeFluctuationStrength(isRealTime, bandPowers[i], f_mod, mod_depth);
-			std::vector<double> f_mod_vec(AWHAudioFFT::BARK_BAND_NUMBER, f_mod);
+			f_mod_vec.assign(AWHAudioFFT::BARK_BAND_NUMBER, f_mod);
 			double roughness = ComputeRoughness(isRealTime, bandPowers[i], f_mod_vec, mod_depth);
 			double sharpness = ComputeSharpness(isRealTime, bandPowers[i]);
 			double tonality = (totalPower > AWHAudioFFT::EPSILON) ? maxPower / totalPower : 0.1;
@@ -844,8 +1053,9 @@ namespace AWHAudioDynamics {
 	}
 
 	double ComputeDynamicSpread(const std::vector<double>& loudness, double threshold, double alpha, double scaleFactor) {
-		std::vector<double> filteredLoudness;
-		filteredLoudness.reserve(loudness.size());
+		// Thread-local storage for the sorted values, reused across calls
+		static thread_local std::vector<double> filteredLoudness;
+		filteredLoudness.clear();
 
 		for (double lufs : loudness) {
 			if (lufs > threshold) filteredLoudness.push_back(lufs);
@@ -1064,19 +1274,28 @@ namespace AWHAudioDynamics {
 		return std::clamp(spatialScore, 0.0, 1.0);
 	}
 
-	std::vector<double> ComputeTemporalWeights(const std::vector<double>& loudness, double blockDurationMs, double preMaskingMs, double postMaskingMs, double variance) {
+	void ComputeTemporalWeights(const std::vector<double>& loudness, double blockDurationMs, double preMaskingMs, double postMaskingMs, double variance, std::vector<double>& weights) {
 		if (blockDurationMs <= 0.0 || preMaskingMs <= 0.0 || postMaskingMs <= 0.0) {
-			return std::vector<double>(loudness.size(), 1.0);
+			weights.assign(loudness.size(), 1.0);
+			return;
 		}
 
 		// Adjust masking durations for high-variance tracks
 		double adjPreMaskingMs = variance > 100.0 ? 50.0 : preMaskingMs;
 		double adjPostMaskingMs = variance > 100.0 ? 250.0 : postMaskingMs;
 
-		std::vector<double> weights(loudness.size(), 1.0);
-		const double peakThreshold = AWHMath::CalculatePercentile(loudness, 0.9);
+		// 90th percentile, selected in the output buffer before it is filled so no copy is needed
+		double peakThreshold = -INFINITY;
+		if (!loudness.empty()) {
+			weights.assign(loudness.begin(), loudness.end());
+			const size_t peakIdx = std::max<size_t>(1, static_cast<size_t>(0.9 * weights.size())) - 1;
+			std::nth_element(weights.begin(), weights.begin() + peakIdx, weights.end());
+			peakThreshold = weights[peakIdx];
+		}
+
+		weights.assign(loudness.size(), 1.0);
 		if (peakThreshold == -INFINITY) {
-			return weights;
+			return;
 		}
 
 		// Precompute inverses for exponential decay
@@ -1106,8 +1325,6 @@ namespace AWHAudioDynamics {
 				}
 			}
 		}
-
-		return weights;
 	}
 
 	double ComputeTransientDensity(const std::vector<double>& transientBoosts, double blockDurationMs) {
@@ -1121,17 +1338,17 @@ namespace AWHAudioDynamics {
 		return (transientCount * 1000.0) / (transientBoosts.size() * blockDurationMs + epsilon);
 	}
 
-	std::vector<double> DetectTransients(
+	void DetectTransients(
 		const std::vector<double>& inputLoudness, double blockDurationMs,
 		const std::vector<double>& harmonicComplexityFactor,
 		const std::vector<double>& maskingFactor,
 		const std::vector<double>& spectralFlux,
 		const std::vector<double>& spectralCentroid,
 		const std::vector<double>& spectralFlatness,
-		double genreFactor, double varianceScale) {
+		double genreFactor, double varianceScale, std::vector<double>& transientBoosts) {
 
 		const size_t blockCount = inputLoudness.size();
-		std::vector<double> transientBoosts(blockCount, 1.0);
+		transientBoosts.assign(blockCount, 1.0);
 
 		if (blockCount < 2 || blockDurationMs <= 0.0 ||
 			blockCount != spectralFlux.size() ||
@@ -1139,7 +1356,7 @@ namespace AWHAudioDynamics {
 			blockCount != spectralFlatness.size() ||
 			blockCount != harmonicComplexityFactor.size() ||
 			blockCount != maskingFactor.size()) {
-			return transientBoosts;
+			return;
 		}
 
 		// Constants
@@ -1213,8 +1430,6 @@ namespace AWHAudioDynamics {
 			emaVar = alpha * std::pow(transientScore - prevEmaMean, 2) + (1.0 - alpha) * emaVar;
 			transientDensityEma = alphaDensity * (transientBoosts[i] > 1.0 ? 1.0 : 0.0) + (1.0 - alphaDensity) * transientDensityEma;
 		}
-
-		return transientBoosts;
 	}
 }
 #pragma endregion
@@ -1235,6 +1450,24 @@ namespace AWHAudioFFT {
 		return edges;
 	}();
 
+	void ProcessCacheMemory() {
+		// Re-measured on every cache miss, the caches only grow and are released with their thread
+		static thread_local AWHPerf::MemoryCharge cacheMemory{ AWHPerf::MemoryAccounting::CATEGORY_FFT_CACHE };
+		size_t bytes = 0;
+
+		for (const auto& [key, weights] : barkWeightCache) {
+			bytes += AWHPerf::GetVectorBytes(weights);
+			for (const auto& bandWeights : weights) bytes += AWHPerf::GetVectorBytes(bandWeights);
+		}
+		for (const auto& [key, values] : centerFreqsCache) bytes += AWHPerf::GetVectorBytes(values);
+		for (const auto& [key, values] : bitReversalCache) bytes += AWHPerf::GetVectorBytes(values);
+		for (const auto& [key, values] : twiddleCache) bytes += AWHPerf::GetVectorBytes(values);
+		for (const auto& [key, values] : twiddleCacheReal) bytes += AWHPerf::GetVectorBytes(values);
+		for (const auto& [key, values] : AWHAudioDSP::hannWindowCache) bytes += AWHPerf::GetVectorBytes(values);
+
+		cacheMemory.Set(bytes);
+	}
+
 	void PrecomputeBitReversal(size_t N) {
 		auto& indices = bitReversalCache[N];
 		indices.resize(N);
@@ -1248,6 +1481,8 @@ namespace AWHAudioFFT {
 			}
 			indices[i] = j;
 		}
+
+		ProcessCacheMemory();
 	}
 
 	void PrecomputeTwiddlesGeneral(size_t N) {
@@ -1293,6 +1528,8 @@ namespace AWHAudioFFT {
 			idx += m2;
 			n1 = n2;
 		}
+
+		ProcessCacheMemory();
 	}
 
 	void PrecomputeTwiddlesPower2(size_t N) {
@@ -1321,6 +1558,8 @@ namespace AWHAudioFFT {
 			}
 			idx += 3 * m4;
 		}
+
+		ProcessCacheMemory();
 	}
 
 	size_t CalculateFFTSize(bool usePower2, double sampleRate, double& targetBinWidth, size_t stepSize, size_t maxFftSize) {
@@ -1835,6 +2074,7 @@ namespace AWHAudioFFT {
 		auto& centerFreqs = centerFreqsCache[sampleRate];
 		if (centerFreqs.empty()) {
 			centerFreqs = ComputeBarkCenterFrequencies(sampleRate);
+			ProcessCacheMemory();
 		}
 
 		std::vector<double> excitation(BARK_BAND_NUMBER, 0.0);
@@ -2234,6 +2474,7 @@ namespace AWHAudioFFT {
 				}
 			}
 			it = barkWeightCache.try_emplace(key, weights).first;
+			ProcessCacheMemory();
 		}
 		const auto& weights = it->second;
 
@@ -2255,6 +2496,7 @@ namespace AWHAudioFFT {
 #pragma endregion
 
 
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 /////////////////////
 // * COM HELPERS * //
 /////////////////////
@@ -2337,6 +2579,25 @@ namespace AWHCOM {
 		}
 	}
 
+	void FireCallback(const VARIANT& callback, const std::vector<CComVariant>& args) {
+		if (callback.vt != VT_DISPATCH || callback.pdispVal == nullptr) return;
+
+		// IDispatch expects the arguments in reverse order
+		fb2k::inMainThread([callback, reversedArgs = std::vector<CComVariant>(args.rbegin(), args.rend())]() mutable {
+			DISPPARAMS params;
+			params.rgvarg = reversedArgs.data();
+			params.rgdispidNamedArgs = nullptr;
+			params.cArgs = static_cast<UINT>(reversedArgs.size());
+			params.cNamedArgs = 0;
+
+			HRESULT hr = callback.pdispVal->Invoke(DISPID_VALUE, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD, &params, nullptr, nullptr, nullptr);
+
+			if (FAILED(hr)) {
+				FB2K_console_formatter() << "Audio Wizard => FireCallback: Callback invocation failed, HRESULT: " << hr;
+			}
+		});
+	}
+
 	metadb_handle_list GetMetadbHandlesFromStringArray(const VARIANT& metadata) {
 		metadb_handle_list tracks;
 
@@ -2455,6 +2716,102 @@ namespace AWHCOM {
 		return S_OK;
 	}
 
+	HRESULT GetOptionalLong(const VARIANT* variant, LONG& output, LONG defaultValue) {
+		const HRESULT hr = GetOptionalLong(variant, output);
+
+		if (SUCCEEDED(hr) && (variant == nullptr || variant->vt == VT_ERROR)) {
+			output = defaultValue;
+		}
+
+		return hr;
+	}
+
+	HRESULT GetOptionalDouble(const VARIANT* variant, double& output) {
+		output = 0.0;
+
+		if (variant != nullptr) {
+			if (variant->vt == VT_R8) {
+				output = variant->dblVal;
+			}
+			else if (variant->vt == VT_R4) {
+				output = variant->fltVal;
+			}
+			else if (variant->vt == VT_I4) {
+				output = variant->lVal;
+			}
+			else if (variant->vt != VT_ERROR || variant->scode != DISP_E_PARAMNOTFOUND) {
+				FB2K_console_formatter() << "Audio Wizard => GetOptionalDouble: Invalid variant type or error code";
+				return E_INVALIDARG;
+			}
+		}
+
+		return S_OK;
+	}
+
+	HRESULT GetOptionalLongArray(const VARIANT* variant, std::vector<LONG>& output) {
+		output.clear();
+
+		if (variant == nullptr || variant->vt == VT_EMPTY || variant->vt == VT_NULL ||
+			(variant->vt == VT_ERROR && variant->scode == DISP_E_PARAMNOTFOUND)) {
+			return S_OK;
+		}
+
+		if (variant->vt == VT_I4) {
+			output.push_back(variant->lVal);
+			return S_OK;
+		}
+
+		const VARTYPE elementType = variant->vt & VT_TYPEMASK;
+		if ((variant->vt & VT_ARRAY) == 0 || !variant->parray ||
+			(elementType != VT_VARIANT && elementType != VT_I4 && elementType != VT_R8)) {
+			FB2K_console_formatter() << "Audio Wizard => GetOptionalLongArray: unexpected VARTYPE 0x" << pfc::format_hex(variant->vt);
+			return E_INVALIDARG;
+		}
+
+		long lbound;
+		long ubound;
+		if (FAILED(SafeArrayGetLBound(variant->parray, 1, &lbound)) ||
+			FAILED(SafeArrayGetUBound(variant->parray, 1, &ubound))) {
+			FB2K_console_formatter() << "Audio Wizard => GetOptionalLongArray: failed to get array bounds";
+			return E_INVALIDARG;
+		}
+
+		void* data = nullptr;
+		HRESULT hr = SafeArrayAccessData(variant->parray, &data);
+		if (FAILED(hr)) {
+			FB2K_console_formatter() << "Audio Wizard => GetOptionalLongArray: SafeArrayAccessData failed: " << hr;
+			return hr;
+		}
+
+		const auto count = static_cast<size_t>(std::max(0L, ubound - lbound + 1));
+		output.reserve(count);
+
+		for (size_t i = 0; i < count && SUCCEEDED(hr); ++i) {
+			if (elementType == VT_I4) {
+				output.push_back(static_cast<const LONG*>(data)[i]);
+			}
+			else if (elementType == VT_R8) {
+				output.push_back(static_cast<LONG>(static_cast<const double*>(data)[i]));
+			}
+			else {
+				VARIANT element;
+				VariantInit(&element);
+				hr = VariantChangeType(&element, &static_cast<VARIANT*>(data)[i], 0, VT_I4);
+				if (SUCCEEDED(hr)) output.push_back(element.lVal);
+			}
+		}
+
+		SafeArrayUnaccessData(variant->parray);
+
+		if (FAILED(hr)) {
+			FB2K_console_formatter() << "Audio Wizard => GetOptionalLongArray: Invalid element at index " << output.size();
+			output.clear();
+			return E_INVALIDARG;
+		}
+
+		return S_OK;
+	}
+
 	SafeArrayAccess::SafeArrayAccess(SAFEARRAY* inputPsa) : psa(inputPsa) {
 		if (!psa) {
 			hr = E_INVALIDARG;
@@ -2889,6 +3246,7 @@ namespace AWHGraphics {
 	}
 }
 #pragma endregion
+#endif
 
 
 //////////////////////
@@ -2901,7 +3259,7 @@ namespace AWHMath {
 		return std::exp(-deltaTime / timeConstant);
 	}
 
-	double CalculateEntropy(const std::vector<double>& features) {
+	double CalculateEntropy(std::span<const double> features) {
 		if (features.empty()) return 0.0;
 
 		const double epsilon = 1e-12;
@@ -3018,6 +3376,11 @@ namespace AWHMath {
 
 	// Compute median of a sorted vector
 	double CalculateMedian(std::vector<double> data) {
+		return CalculateMedianInPlace(data);
+	}
+
+	// Compute median by sorting the caller's vector, no copy
+	double CalculateMedianInPlace(std::vector<double>& data) {
 		if (data.empty()) return -INFINITY;
 
 		std::sort(data.begin(), data.end());
@@ -3152,6 +3515,7 @@ namespace AWHMath {
 #pragma endregion
 
 
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 //////////////////////
 // * META HELPERS * //
 //////////////////////
@@ -3320,6 +3684,7 @@ namespace AWHPath {
 	}
 }
 #pragma endregion
+#endif
 
 
 /////////////////////////////
@@ -3327,6 +3692,7 @@ namespace AWHPath {
 /////////////////////////////
 #pragma region Performance Helpers
 namespace AWHPerf {
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 	template<typename Query, typename Counter>
 	void CleanupPerfData(Query& query, Counter& counter) {
 		if (query) {
@@ -3570,6 +3936,282 @@ namespace AWHPerf {
 
 		return AWRAM::systemCachedMemory;
 	}
+
+#endif
+
+	int64_t QualityGovernor::SteadyClockMicros() {
+		return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()
+		).count();
+	}
+
+	void QualityGovernor::SetBudget(double percent) {
+		budgetPercent.store(std::max(percent, 0.0), std::memory_order_relaxed);
+	}
+
+	void QualityGovernor::AddStageCost(Stage stage, int64_t costMicros) {
+		if (stage < STAGE_COUNT && costMicros > 0) {
+			stageCosts[stage] += costMicros;
+		}
+	}
+
+	int QualityGovernor::Evaluate() {
+		const int64_t now = clock();
+
+		if (windowStart == 0) {
+			windowStart = now;
+			return GetTier();
+		}
+
+		const int64_t elapsed = now - windowStart;
+		if (elapsed < WINDOW_MICROS) return GetTier();
+
+		int64_t cost = 0;
+		for (int64_t& stageCost : stageCosts) {
+			cost += stageCost;
+			stageCost = 0;
+		}
+		windowStart = now;
+
+		const double windowLoad = 100.0 * static_cast<double>(cost) / static_cast<double>(elapsed);
+		const double load = LOAD_SMOOTHING * GetLoad() + (1.0 - LOAD_SMOOTHING) * windowLoad;
+		loadPercent.store(load, std::memory_order_relaxed);
+
+		const double budget = GetBudget();
+		int currentTier = GetTier();
+
+		if (budget <= 0.0) {
+			overBudgetWindows = 0;
+			underBudgetWindows = 0;
+			tier.store(TIER_FULL, std::memory_order_relaxed);
+			return TIER_FULL;
+		}
+
+		if (load > budget) {
+			underBudgetWindows = 0;
+			if (++overBudgetWindows >= DEGRADE_WINDOWS && currentTier < TIER_LOW_OVERSAMPLING) {
+				++currentTier;
+				overBudgetWindows = 0;
+			}
+		}
+		else if (load < budget * RESTORE_HEADROOM) {
+			overBudgetWindows = 0;
+			if (++underBudgetWindows >= RESTORE_WINDOWS && currentTier > TIER_FULL) {
+				--currentTier;
+				underBudgetWindows = 0;
+			}
+		}
+		else {
+			overBudgetWindows = 0;
+			underBudgetWindows = 0;
+		}
+
+		tier.store(currentTier, std::memory_order_relaxed);
+		return currentTier;
+	}
+
+	void QualityGovernor::Reset() {
+		stageCosts.fill(0);
+		windowStart = 0;
+		overBudgetWindows = 0;
+		underBudgetWindows = 0;
+		loadPercent.store(0.0, std::memory_order_relaxed);
+		tier.store(TIER_FULL, std::memory_order_relaxed);
+	}
+
+	void StageProfile::Add(const StageProfile& other) {
+		for (size_t i = 0; i < STAGE_COUNT; ++i) {
+			nanos[i] += other.nanos[i];
+			calls[i] += other.calls[i];
+		}
+		chunks += other.chunks;
+		frames += other.frames;
+		blocks += other.blocks;
+	}
+
+	int64_t StageProfile::GetTotalNanos() const {
+		return std::accumulate(nanos.begin(), nanos.end(), int64_t{ 0 });
+	}
+
+	void StageProfile::WriteJsonFields(std::ostream& os) const {
+		const auto toMs = [](int64_t ns) { return AWHMath::RoundTo(static_cast<double>(ns) / 1e6, 3); };
+
+		os << "\"chunks\":" << chunks
+			<< ",\"frames\":" << frames
+			<< ",\"blocks\":" << blocks
+			<< ",\"totalMs\":" << toMs(GetTotalNanos())
+			<< ",\"ms\":[";
+
+		for (size_t i = 0; i < STAGE_COUNT; ++i) {
+			if (i > 0) os << ",";
+			os << toMs(nanos[i]);
+		}
+
+		os << "],\"calls\":[";
+
+		for (size_t i = 0; i < STAGE_COUNT; ++i) {
+			if (i > 0) os << ",";
+			os << calls[i];
+		}
+
+		os << "]";
+	}
+
+	thread_local uint32_t MemoryAccounting::activeJob = 0;
+	std::array<std::atomic<int64_t>, MemoryAccounting::CATEGORY_COUNT> MemoryAccounting::totalCurrent{};
+	std::array<std::atomic<int64_t>, MemoryAccounting::CATEGORY_COUNT> MemoryAccounting::totalPeak{};
+	std::atomic<int64_t> MemoryAccounting::totalCurrentBytes{ 0 };
+	std::atomic<int64_t> MemoryAccounting::totalPeakBytes{ 0 };
+	std::mutex MemoryAccounting::mutex;
+	std::deque<MemoryAccounting::JobUsage> MemoryAccounting::jobUsage;
+
+	void MemoryAccounting::Usage::Add(Category category, int64_t delta) {
+		current[category] += delta;
+		peak[category] = std::max(peak[category], current[category]);
+		currentTotal += delta;
+		peakTotal = std::max(peakTotal, currentTotal);
+	}
+
+	void MemoryAccounting::SetActiveJob(uint32_t jobId, std::string_view kind) {
+		activeJob = jobId;
+		if (jobId == 0) return;
+
+		std::scoped_lock lock(mutex);
+		const auto it = std::find_if(jobUsage.begin(), jobUsage.end(), [jobId](const JobUsage& job) { return job.jobId == jobId; });
+		if (it != jobUsage.end()) return; // A preempted job resumes its own record
+
+		jobUsage.push_back({ jobId, std::string(kind), {} });
+
+		// Jobs whose memory has been released go first, then the oldest
+		while (jobUsage.size() > MAX_JOBS) {
+			const auto released = std::find_if(jobUsage.begin(), jobUsage.end(), [](const JobUsage& job) {
+				return job.usage.currentTotal <= 0;
+			});
+			jobUsage.erase(released != jobUsage.end() ? released : jobUsage.begin());
+		}
+	}
+
+	void MemoryAccounting::Charge(Category category, uint32_t jobId, int64_t delta) {
+		if (delta == 0 || category >= CATEGORY_COUNT) return;
+
+		// Charges outside analysis jobs, the real-time FFT cache and the dialog's threads, stop at the lock-free totals
+		UpdatePeak(totalPeak[category], totalCurrent[category].fetch_add(delta, std::memory_order_relaxed) + delta);
+		UpdatePeak(totalPeakBytes, totalCurrentBytes.fetch_add(delta, std::memory_order_relaxed) + delta);
+		if (jobId == 0) return;
+
+		std::scoped_lock lock(mutex);
+		for (auto& job : jobUsage) {
+			if (job.jobId == jobId) {
+				job.usage.Add(category, delta);
+				break;
+			}
+		}
+	}
+
+	void MemoryAccounting::GetUsage(Usage& total, std::vector<JobUsage>& jobUsages) {
+		for (size_t i = 0; i < CATEGORY_COUNT; ++i) {
+			total.current[i] = totalCurrent[i].load(std::memory_order_relaxed);
+			total.peak[i] = totalPeak[i].load(std::memory_order_relaxed);
+		}
+		total.currentTotal = totalCurrentBytes.load(std::memory_order_relaxed);
+		total.peakTotal = totalPeakBytes.load(std::memory_order_relaxed);
+
+		std::scoped_lock lock(mutex);
+		jobUsages.assign(jobUsage.begin(), jobUsage.end());
+	}
+
+	bool MemoryAccounting::GetJobUsage(uint32_t jobId, Usage& usage) {
+		std::scoped_lock lock(mutex);
+		for (const auto& job : jobUsage) {
+			if (job.jobId == jobId) {
+				usage = job.usage;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void MemoryAccounting::GetReportJson(std::string& json, uint32_t runningJob, const std::function<std::string_view(uint32_t jobId)>& getJobState) {
+		std::ostringstream oss;
+		Usage total;
+		std::vector<JobUsage> jobUsages;
+		GetUsage(total, jobUsages);
+
+		oss << "{\"memoryDataVersion\":" << MEMORY_DATA_VERSION << ",\"categories\":[";
+		for (size_t i = 0; i < CATEGORY_COUNT; ++i) {
+			oss << (i ? "," : "") << "\"" << CATEGORY_NAMES[i] << "\"";
+		}
+
+		oss << "],\"activeJob\":" << runningJob << ",\"total\":";
+		WriteUsageJson(oss, total);
+		oss << ",\"jobs\":[";
+
+		for (size_t i = 0; i < jobUsages.size(); ++i) {
+			const auto& job = jobUsages[i];
+			oss << (i ? "," : "") << "{\"id\":" << job.jobId << ",\"kind\":\"" << job.kind << "\""
+				<< ",\"state\":\"" << getJobState(job.jobId) << "\""
+				<< ",\"usage\":";
+			WriteUsageJson(oss, job.usage);
+			oss << "}";
+		}
+
+		oss << "]}";
+		json = oss.str();
+	}
+
+	void MemoryAccounting::ResetPeaks() {
+		for (size_t i = 0; i < CATEGORY_COUNT; ++i) {
+			totalPeak[i].store(totalCurrent[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+		totalPeakBytes.store(totalCurrentBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+		std::scoped_lock lock(mutex);
+		for (auto& job : jobUsage) {
+			job.usage.peak = job.usage.current;
+			job.usage.peakTotal = job.usage.currentTotal;
+		}
+	}
+
+	void MemoryAccounting::UpdatePeak(std::atomic<int64_t>& peak, int64_t value) {
+		int64_t previous = peak.load(std::memory_order_relaxed);
+		while (value > previous && !peak.compare_exchange_weak(previous, value, std::memory_order_relaxed)) {}
+	}
+
+	void MemoryAccounting::WriteUsageJson(std::ostream& os, const Usage& usage) {
+		const auto writeBytes = [&os](const auto& bytes) {
+			os << "[";
+			for (size_t i = 0; i < bytes.size(); ++i) {
+				os << (i ? "," : "") << std::max(int64_t{ 0 }, bytes[i]);
+			}
+			os << "]";
+		};
+
+		os << "{\"currentBytes\":";
+		writeBytes(usage.current);
+		os << ",\"peakBytes\":";
+		writeBytes(usage.peak);
+		os << ",\"currentTotalBytes\":" << std::max(int64_t{ 0 }, usage.currentTotal)
+			<< ",\"peakTotalBytes\":" << std::max(int64_t{ 0 }, usage.peakTotal) << "}";
+	}
+
+	MemoryCharge& MemoryCharge::operator=(MemoryCharge&& other) noexcept {
+		if (this != &other) {
+			Set(0);
+			jobId = other.jobId;
+			bytes = std::exchange(other.bytes, 0);
+		}
+		return *this;
+	}
+
+	void MemoryCharge::Set(size_t newBytes) {
+		if (newBytes == bytes) return;
+
+		// A fresh charge belongs to this thread's job, later growth and the release stay with that job
+		if (bytes == 0) jobId = MemoryAccounting::GetActiveJob();
+
+		MemoryAccounting::Charge(category, jobId, static_cast<int64_t>(newBytes) - static_cast<int64_t>(bytes));
+		bytes = newBytes;
+	}
 }
 #pragma endregion
 
@@ -3613,6 +4255,7 @@ namespace AWHString {
 		return out;
 	}
 
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 	std::string FormatDate(std::chrono::system_clock::time_point time, const char* format) {
 		std::time_t time_t = std::chrono::system_clock::to_time_t(time);
 		std::tm tm;
@@ -3623,6 +4266,7 @@ namespace AWHString {
 
 		return oss.str();
 	}
+#endif
 
 	std::wstring FormatSampleRate(const double& sampleRate) {
 		if (std::isnan(sampleRate) || sampleRate < 0) {
@@ -3636,6 +4280,7 @@ namespace AWHString {
 		return ss.str();
 	}
 
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 	CStringA FormatTimestampMs(double ms) {
 		if (ms < 0 || ms > 2'147'483'647'000.0) {
 			return CStringA("00:00:00.000");
@@ -3704,6 +4349,8 @@ namespace AWHString {
 		return result;
 	}
 
+#endif
+
 	pfc::string8 ToFixed(int precision, double value) {
 		std::ostringstream oss;
 		oss << std::fixed << std::setprecision(precision) << value;
@@ -3714,6 +4361,7 @@ namespace AWHString {
 		return ToFixed(precision, static_cast<double>(value));
 	}
 
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 	CStringW ToFixedW(int precision, double value) {
 		std::wostringstream woss;
 		woss << std::fixed << std::setprecision(precision) << value;
@@ -3732,10 +4380,12 @@ namespace AWHString {
 	std::wstring ToWide(const pfc::string8& input) {
 		return std::wstring(pfc::stringcvt::string_wide_from_utf8(input.get_ptr()).get_ptr());
 	}
+#endif
 };
 #pragma endregion
 
 
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 //////////////////////
 // * TEXT HELPERS * //
 //////////////////////
@@ -3819,3 +4469,4 @@ namespace AWHText {
 	}
 };
 #pragma endregion
+#endif
@@ -10,7 +10,9 @@
 
 
 #pragma once
+#ifndef AW_HEADLESS
 #include "AW_Settings.h"
+#endif
 
 
 ///////////////////////
@@ -35,29 +37,29 @@ namespace AWHAudioBuffer {
 	// * BUFFER * //
 	struct BufferSettings {
 		// Low Tier => 6 GB RAM
-		static const size_t BUFFER_CAPACITY_AUDIO_LOW = 2000000;    // ~16 MB (RingBuffer, audio samples)
-		static const size_t BUFFER_CAPACITY_SUMS_LOW = 100000;      // ~800 KB (RingBufferSimple, block sums)
-		static const size_t BUFFER_CAPACITY_HISTORY_LOW = 10000;    // ~80 KB (RingBufferSimple, loudness history)
-		static const size_t BUFFER_CAPACITY_CHUNK_SEC_LOW = 3;      // 3 seconds buffer chunks
+		static constexpr size_t BUFFER_CAPACITY_AUDIO_LOW = 2000000;    // ~16 MB (RingBuffer, audio samples)
+		static constexpr size_t BUFFER_CAPACITY_SUMS_LOW = 100000;      // ~800 KB (RingBufferSimple, block sums)
+		static constexpr size_t BUFFER_CAPACITY_HISTORY_LOW = 10000;    // ~80 KB (RingBufferSimple, loudness history)
+		static constexpr size_t BUFFER_CAPACITY_CHUNK_SEC_LOW = 3;      // 3 seconds buffer chunks
 		// Mid Tier => 16 GB RAM
-		static const size_t BUFFER_CAPACITY_AUDIO_MID = 5000000;    // ~40 MB (RingBuffer, audio samples)
-		static const size_t BUFFER_CAPACITY_SUMS_MID = 250000;      // ~2 MB (RingBufferSimple, block sums)
-		static const size_t BUFFER_CAPACITY_HISTORY_MID = 20000;    // ~160 KB (RingBufferSimple, loudness history)
-		static const size_t BUFFER_CAPACITY_CHUNK_SEC_MID = 6;      // 6 seconds buffer chunks
+		static constexpr size_t BUFFER_CAPACITY_AUDIO_MID = 5000000;    // ~40 MB (RingBuffer, audio samples)
+		static constexpr size_t BUFFER_CAPACITY_SUMS_MID = 250000;      // ~2 MB (RingBufferSimple, block sums)
+		static constexpr size_t BUFFER_CAPACITY_HISTORY_MID = 20000;    // ~160 KB (RingBufferSimple, loudness history)
+		static constexpr size_t BUFFER_CAPACITY_CHUNK_SEC_MID = 6;      // 6 seconds buffer chunks
 		// High Tier => 32 GB RAM
-		static const size_t BUFFER_CAPACITY_AUDIO_HIGH = 10000000;  // ~80 MB (RingBuffer, audio samples)
-		static const size_t BUFFER_CAPACITY_SUMS_HIGH = 500000;     // ~4 MB (RingBufferSimple, block sums)
-		static const size_t BUFFER_CAPACITY_HISTORY_HIGH = 40000;   // ~320 KB (RingBufferSimple, loudness history)
-		static const size_t BUFFER_CAPACITY_CHUNK_SEC_HIGH = 12;    // 12 seconds buffer chunks
+		static constexpr size_t BUFFER_CAPACITY_AUDIO_HIGH = 10000000;  // ~80 MB (RingBuffer, audio samples)
+		static constexpr size_t BUFFER_CAPACITY_SUMS_HIGH = 500000;     // ~4 MB (RingBufferSimple, block sums)
+		static constexpr size_t BUFFER_CAPACITY_HISTORY_HIGH = 40000;   // ~320 KB (RingBufferSimple, loudness history)
+		static constexpr size_t BUFFER_CAPACITY_CHUNK_SEC_HIGH = 12;    // 12 seconds buffer chunks
 	};
 
 	template<typename T>
-	class DoubleBuffer {
+	class TripleBuffer {
 	public:
-		explicit DoubleBuffer(size_t size) : buffers{ std::vector<T>(size), std::vector<T>(size) }, size(size) {
+		explicit TripleBuffer(size_t size) : slots{ Slot(size), Slot(size), Slot(size) }, size(size) {
 			if (size == 0) {
-				FB2K_console_formatter() << "Audio Wizard => DoubleBuffer: Invalid size";
-				throw std::invalid_argument("DoubleBuffer size must be non-zero");
+				FB2K_console_formatter() << "Audio Wizard => TripleBuffer: Invalid size";
+				throw std::invalid_argument("TripleBuffer size must be non-zero");
 			}
 		}
 
@@ -65,46 +67,49 @@ namespace AWHAudioBuffer {
 			return size;
 		}
 
+		// Single producer - fills its private slot, then swaps it with the shared middle slot
 		bool write(const T* data, size_t count) {
 			if (!data || count > size) {
-				FB2K_console_formatter() << "Audio Wizard => DoubleBuffer::write: Invalid data or count exceeds size (" << count << " > " << size << ")";
+				FB2K_console_formatter() << "Audio Wizard => TripleBuffer::write: Invalid data or count exceeds size (" << count << " > " << size << ")";
 				return false;
 			}
-			std::lock_guard<std::mutex> lock(mutex);
-			size_t back = 1 - active.load(std::memory_order_relaxed);
-			std::fill(buffers[back].begin(), buffers[back].end(), T{});
-			memcpy(buffers[back].data(), data, count * sizeof(T));
-			validCount = count;
-			active.store(back, std::memory_order_release);
+			Slot& slot = slots[backIndex];
+			memcpy(slot.data.data(), data, count * sizeof(T));
+			slot.count = count;
+			slot.sequence = ++writeSequence;
+			backIndex = middleIndex.exchange(backIndex | FRESH_BIT, std::memory_order_acq_rel) & INDEX_MASK;
 			return true;
 		}
 
-		bool read(T* data, size_t count, size_t* readCount) {
-			if (!data || !readCount || count > size) {
-				FB2K_console_formatter() << "Audio Wizard => DoubleBuffer::read: Invalid data, readCount, or count exceeds size (" << count << " > " << size << ")";
-				return false;
-			}
-			std::lock_guard<std::mutex> lock(mutex);
-			size_t front = active.load(std::memory_order_acquire);
-			size_t valid = validCount;
-			count = std::min(count, valid);
-			if (count == 0) {
-				*readCount = 0;
-				FB2K_console_formatter() << "Audio Wizard => DoubleBuffer::read: No valid samples (validCount = 0)";
-				return false;
+		// Single consumer - takes the middle slot if a newer one was published, otherwise keeps the current one.
+		// The returned pointer stays valid until the next acquire call.
+		const T* acquire(size_t* count, uint64_t* sequence = nullptr) {
+			if (middleIndex.load(std::memory_order_relaxed) & FRESH_BIT) {
+				frontIndex = middleIndex.exchange(frontIndex, std::memory_order_acq_rel) & INDEX_MASK;
 			}
-			memcpy(data, buffers[front].data(), count * sizeof(T));
-			*readCount = count;
-			FB2K_console_formatter() << "Audio Wizard => DoubleBuffer::read: Read " << count << " samples";
-			return true;
+			const Slot& slot = slots[frontIndex];
+			*count = slot.count;
+			if (sequence) *sequence = slot.sequence;
+			return slot.data.data();
 		}
 
 	private:
-		std::array<std::vector<T>, 2> buffers;
+		struct Slot {
+			std::vector<T> data;
+			size_t count = 0;
+			uint64_t sequence = 0;
+			explicit Slot(size_t size) : data(size) {}
+		};
+
+		static constexpr size_t INDEX_MASK = 0x3;
+		static constexpr size_t FRESH_BIT = 0x4;
+
+		std::array<Slot, 3> slots;
 		const size_t size;
-		std::atomic<size_t> active{ 0 };
-		size_t validCount{ 0 };
-		std::mutex mutex;
+		alignas(64) std::atomic<size_t> middleIndex{ 1 };
+		alignas(64) size_t backIndex = 0; // Producer-owned
+		uint64_t writeSequence = 0;
+		alignas(64) size_t frontIndex = 2; // Consumer-owned
 	};
 
 	template<typename T>
@@ -123,6 +128,8 @@ namespace AWHAudioBuffer {
 			operator delete[](buffer, std::align_val_t{ 64 });
 		}
 
+		size_t getCapacity() const { return capacity; }
+
 		bool write(const T* data, size_t count) {
 			size_t currentWrite = writePos.load(std::memory_order_relaxed);
 			size_t currentRead = readPos.load(std::memory_order_acquire);
@@ -283,6 +290,7 @@ namespace AWHAudioBuffer {
 		}
 
 		size_t size() const { return count; }
+		size_t getCapacity() const { return capacity; }
 
 		double operator[](size_t i) const {
 			return buffer[(start + i) % capacity];
@@ -310,6 +318,71 @@ namespace AWHAudioBuffer {
 		size_t start = 0;
 		size_t count = 0;
 	};
+
+	// Named shared-memory PCM ring for visualizers in other processes - one producer, any number of readers.
+	// Fixed layout: a 64-byte Header followed by capacityFrames * MAX_CHANNELS float32 slots, frames interleaved.
+	// The producer raises reservedPosition, writes the frames, then publishes writePosition. Readers keep their own
+	// position, copy up to writePosition and drop the frames that reservedPosition shows were overwritten meanwhile.
+	class SharedAudioRing {
+	public:
+		static constexpr uint32_t MAGIC = 0x52505741; // "AWPR"
+		static constexpr uint32_t VERSION = 1;
+		static constexpr uint32_t MAX_CHANNELS = 8;
+		static constexpr uint32_t MIN_CAPACITY_FRAMES = 4096;
+		static constexpr uint32_t DEF_CAPACITY_FRAMES = 131072; // ~2.7s at 48 kHz
+		static constexpr uint32_t MAX_CAPACITY_FRAMES = 1048576;
+
+		struct Header {
+			uint32_t magic;
+			uint32_t version;
+			uint32_t headerBytes;
+			uint32_t capacityFrames;                 // Power of two, slot = position & (capacityFrames - 1)
+			uint32_t maxChannels;                    // Floats reserved per frame slot
+			std::atomic<uint32_t> channels;          // Channels of the current format, at most maxChannels
+			std::atomic<uint32_t> sampleRate;
+			std::atomic<uint32_t> formatSequence;    // Bumped on every format change, readers resync on a mismatch
+			std::atomic<uint64_t> reservedPosition;  // End of the block being written
+			std::atomic<uint64_t> writePosition;     // Frames published since the ring was created
+			uint8_t reserved[16];
+		};
+		static_assert(sizeof(Header) == 64, "SharedAudioRing header layout is part of the reader contract");
+		static_assert(std::atomic<uint64_t>::is_always_lock_free, "SharedAudioRing needs address-free atomics");
+
+		struct ReaderState {
+			uint64_t position = 0;
+			uint32_t formatSequence = 0;
+			bool isSynced = false;
+		};
+
+		SharedAudioRing() = default;
+		~SharedAudioRing();
+		SharedAudioRing(const SharedAudioRing&) = delete;
+		SharedAudioRing& operator=(const SharedAudioRing&) = delete;
+
+		bool Create(const std::string& name, uint32_t capacityFrames);
+		bool Attach(const std::string& name);
+		void Close();
+		bool IsOpen() const { return header != nullptr; }
+		const std::string& GetName() const { return mappingName; }
+
+		void Write(const audioType* data, size_t frames, uint32_t channels, uint32_t sampleRate);
+		size_t Read(ReaderState& state, float* out, size_t maxFrames, uint32_t& channels, uint32_t& sampleRate) const;
+
+	private:
+		Header* header = nullptr;
+		float* samples = nullptr;
+		size_t mappingBytes = 0;
+		std::string mappingName;
+#ifdef _WIN32
+		HANDLE mapping = nullptr;
+#else
+		int descriptor = -1;
+		bool isOwner = false;
+#endif
+
+		bool MapRegion(const std::string& name, size_t bytes, bool create);
+		static std::string GetPlatformName(const std::string& name);
+	};
 }
 #pragma endregion
 
@@ -400,7 +473,7 @@ namespace AWHAudioDSP {
 	void ExtractStereoChannels(const audioType* block, size_t stepSize, size_t numChannels, std::vector<double>& leftChannel, std::vector<double>& rightChannel);
 	std::vector<double> GenerateAudioWindow(WindowType windowType, size_t taps, double beta = 5.0);
 	std::vector<double> GenerateHannWindow(size_t windowSize);
-	std::vector<double> NormalizeLoudness(const std::vector<double>& loudness, double blockDurationMs, double windowMs);
+	void NormalizeLoudness(const std::vector<double>& loudness, double blockDurationMs, double windowMs, std::vector<double>& normalizedLoudness);
 	void ResampleToSampleRate(const ChunkData& inputChunk, ChunkData& outputChunk, double targetSampleRate, size_t taps, WindowType windowType = WindowType::KAISER, double beta = 5.0);
 	double SmoothValue(double current, double target, double attackCoeff, double releaseCoeff);
 };
@@ -431,6 +504,77 @@ namespace AWHAudioDynamics {
 		}
 	};
 
+	// Streaming DR14 state for one channel, fed once per completed 3s block.
+	// Splits block RMS values into the loudest 20% and the rest, so the DR query is O(1).
+	struct DynamicRangeChannel {
+		// Block RMS histogram, 0.01 dB bins from -100 dB to +20 dB, index = (dB + 100) * 100.
+		// Sized once on construction so the real-time thread never allocates per block.
+		static constexpr double MIN_RMS_DB = -100.0;
+		static constexpr double MAX_RMS_DB = 20.0;
+		static constexpr double BINS_PER_DB = 100.0;
+		static constexpr size_t BIN_COUNT = static_cast<size_t>((MAX_RMS_DB - MIN_RMS_DB) * BINS_PER_DB) + 1;
+
+		std::vector<size_t> rmsCounts = std::vector<size_t>(BIN_COUNT, 0);
+		std::vector<double> rmsSumSquares = std::vector<double>(BIN_COUNT, 0.0);
+		size_t rmsBlockCount = 0;
+		size_t rmsHighestBin = 0;
+		size_t topRMSCount = 0;
+		double topRMSSumSquares = 0.0;
+		double peakHighest = 0.0;
+		double peakSecondHighest = 0.0;
+
+		void addBlock(double blockRMS, double blockPeak) {
+			const double blockDb = blockRMS > 0.0 ? 20.0 * std::log10(blockRMS) : MIN_RMS_DB;
+			const double binPos = std::round((std::clamp(blockDb, MIN_RMS_DB, MAX_RMS_DB) - MIN_RMS_DB) * BINS_PER_DB);
+			const auto bin = std::min(static_cast<size_t>(binPos), BIN_COUNT - 1);
+
+			rmsCounts[bin]++;
+			rmsSumSquares[bin] += blockRMS * blockRMS;
+			rmsHighestBin = rmsBlockCount++ == 0 ? bin : std::max(rmsHighestBin, bin);
+
+			// Sum the loudest ceil(20%) of all blocks from the top bin down, the boundary bin
+			// contributes its mean square per remaining block. Runs once per 3s block.
+			topRMSCount = (rmsBlockCount + 4) / 5;
+			topRMSSumSquares = 0.0;
+
+			size_t remaining = topRMSCount;
+			for (size_t i = rmsHighestBin + 1; i-- > 0 && remaining > 0;) {
+				if (rmsCounts[i] == 0) continue;
+
+				const size_t taken = std::min(remaining, rmsCounts[i]);
+				topRMSSumSquares += rmsSumSquares[i] * static_cast<double>(taken) / static_cast<double>(rmsCounts[i]);
+				remaining -= taken;
+			}
+
+			if (blockPeak > peakHighest) {
+				peakSecondHighest = peakHighest;
+				peakHighest = blockPeak;
+			}
+			else if (blockPeak > peakSecondHighest) {
+				peakSecondHighest = blockPeak;
+			}
+		}
+
+		size_t blockCount() const {
+			return rmsBlockCount;
+		}
+
+		double topRMSLinear() const {
+			return topRMSCount == 0 ? 0.0 : std::sqrt(std::max(0.0, topRMSSumSquares) / topRMSCount);
+		}
+
+		void clear() {
+			std::fill(rmsCounts.begin(), rmsCounts.end(), 0);
+			std::fill(rmsSumSquares.begin(), rmsSumSquares.end(), 0.0);
+			rmsBlockCount = 0;
+			rmsHighestBin = 0;
+			topRMSCount = 0;
+			topRMSSumSquares = 0.0;
+			peakHighest = 0.0;
+			peakSecondHighest = 0.0;
+		}
+	};
+
 	double ApplyPerceptualLoudnessAdaptation(double blockLufs, double stableDuration, double refLufs, double tau, double adaptStrength);
 	double ApplyPerceptualLoudnessCorrection(bool isRealTime, double fastlAdjustments, double blockLufs, double integratedLUFS, double highFreqPower, double variance, double meanPower);
 	double ApplyTransientBoost(double baseLufs, double transientBoost, double weight);
@@ -460,13 +604,13 @@ namespace AWHAudioDynamics {
 	double ComputePhrasingScore(const std::vector<double>& transientBoosts, double blockDurationMs, size_t currentBlock);
 	double ComputeSpatialScore(const std::vector<double>& leftChannel, const std::vector<double>& rightChannel, size_t blockSize, double sampleRate);
 
-	std::vector<double> ComputeTemporalWeights(const std::vector<double>& loudness, double blockDurationMs, double preMaskingMs, double postMaskingMs, double variance);
+	void ComputeTemporalWeights(const std::vector<double>& loudness, double blockDurationMs, double preMaskingMs, double postMaskingMs, double variance, std::vector<double>& weights);
 	double ComputeTransientDensity(const std::vector<double>& transientBoosts, double blockDurationMs);
 
-	std::vector<double> DetectTransients(const std::vector<double>& inputLoudness, double blockDurationMs,
+	void DetectTransients(const std::vector<double>& inputLoudness, double blockDurationMs,
 		const std::vector<double>& harmonicComplexityFactor, const std::vector<double>& maskingFactor,
 		const std::vector<double>& spectralFlux, const std::vector<double>& spectralCentroid, const std::vector<double>& spectralFlatness,
-		double genreFactor, double varianceScale
+		double genreFactor, double varianceScale, std::vector<double>& transientBoosts
 	);
 };
 #pragma endregion
@@ -516,6 +660,7 @@ namespace AWHAudioFFT {
 		4.596745e-12, 1.133413e-11, 1.701570e-10, 3.386632e-08, 1.000000e-07
 	};
 
+	void ProcessCacheMemory();
 	void PrecomputeBitReversal(size_t N);
 	void PrecomputeTwiddlesGeneral(size_t N);
 	void PrecomputeTwiddlesPower2(size_t N);
@@ -556,6 +701,7 @@ namespace AWHAudioFFT {
 #pragma endregion
 
 
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 /////////////////////
 // * COM HELPERS * //
 /////////////////////
@@ -565,9 +711,13 @@ namespace AWHCOM {
 
 	void CreateCallback(VARIANT& targetCallback, const VARIANT* newCallback, const char* callbackName);
 	void FireCallback(const VARIANT& callback, bool success, const std::function<void()>& postAction = nullptr);
+	void FireCallback(const VARIANT& callback, const std::vector<CComVariant>& args);
 
 	metadb_handle_list GetMetadbHandlesFromStringArray(const VARIANT& metadata);
 	HRESULT GetOptionalLong(const VARIANT* variant, LONG& output);
+	HRESULT GetOptionalLong(const VARIANT* variant, LONG& output, LONG defaultValue);
+	HRESULT GetOptionalDouble(const VARIANT* variant, double& output);
+	HRESULT GetOptionalLongArray(const VARIANT* variant, std::vector<LONG>& output);
 
 	class SafeArrayAccess {
 	public:
@@ -658,6 +808,7 @@ namespace AWHDarkMode {
 	void SetDark(bool dark);
 }
 #pragma endregion
+#endif
 
 
 ///////////////////////
@@ -667,14 +818,19 @@ namespace AWHDarkMode {
 namespace AWHDebug {
 	template<typename... Args>
 	void DebugLog(const Args&... args) {
+#ifdef AW_HEADLESS
+		((void)args, ...); // Headless builds have no settings, debug logging stays off
+#else
 		if (AudioWizardSettings::systemDebugLog) {
 			FB2K_console_print("Audio Wizard => ", args...);
 		}
+#endif
 	}
 }
 #pragma endregion
 
 
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 ////////////////////////
 // * DIALOG HELPERS * //
 ////////////////////////
@@ -795,6 +951,7 @@ namespace AWHGraphics {
 	void DrawTheText(HDC hdc, const RECT& rect, const CStringW& text, COLORREF color, HFONT font, UINT format);
 };
 #pragma endregion
+#endif
 
 
 //////////////////////
@@ -803,11 +960,12 @@ namespace AWHGraphics {
 #pragma region Math Helpers
 namespace AWHMath {
 	double CalculateCoefficient(double deltaTime, double timeConstant);
-	double CalculateEntropy(const std::vector<double>& features);
+	double CalculateEntropy(std::span<const double> features);
 	double CalculateIQR(const std::vector<double>& data);
 	double CalculateKurtosis(const std::vector<double>& data, double mean, double defaultValue, bool biasCorrected = false);
 	double CalculateMean(const std::vector<double>& vec, double invalidValue = -INFINITY);
 	double CalculateMedian(std::vector<double> data);
+	double CalculateMedianInPlace(std::vector<double>& data);
 	double CalculatePercentile(const std::vector<double>& data, double percentile);
 	double CalculateSmoothingFactor(double deltaTime, double timeConstant);
 	double CalculateVariance(const std::vector<double>& data);
@@ -831,11 +989,19 @@ namespace AWHMath {
 //////////////////////
 #pragma region Meta Helpers
 namespace AWHMeta {
+#ifdef AW_HEADLESS // Headless builds have no media library, tracks carry no metadata
+	inline unsigned GetBitDepth(const metadb_handle_ptr&) { return 0; }
+	inline pfc::string8 GetDuration(const metadb_handle_ptr&) { return {}; }
+	inline pfc::string8 GetFileFormat(const metadb_handle_ptr&) { return {}; }
+	inline pfc::string8 GetMetadataField(const metadb_handle_ptr&, const char*) { return {}; }
+	inline pfc::string8 GetTechnicalInfoField(const metadb_handle_ptr&, const char*) { return {}; }
+#else
 	unsigned GetBitDepth(const metadb_handle_ptr& track);
 	pfc::string8 GetDuration(const metadb_handle_ptr& track);
 	pfc::string8 GetFileFormat(const metadb_handle_ptr& track);
 	pfc::string8 GetMetadataField(const metadb_handle_ptr& track, const char* field);
 	pfc::string8 GetTechnicalInfoField(const metadb_handle_ptr& track, const char* field);
+#endif
 }
 #pragma endregion
 
@@ -843,16 +1009,24 @@ namespace AWHMeta {
 //////////////////////
 // * PATH HELPERS * //
 //////////////////////
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 namespace AWHPath {
 	pfc::string8 GetPhysicalFilePath(const char* rawPath);
 }
+#endif
 
 
 /////////////////////////////
 // * PERFORMANCE HELPERS * //
 /////////////////////////////
 #pragma region Performance Helpers
+// Stage profiling is compiled in by default, build with AW_STAGE_PROFILING=0 to remove every timer and counter
+#ifndef AW_STAGE_PROFILING
+#define AW_STAGE_PROFILING 1
+#endif
+
 namespace AWHPerf {
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 	// CPU Metrics
 	struct AWCPU {
 		static inline const int numProcessors = std::max(std::thread::hardware_concurrency(), 1u);
@@ -888,7 +1062,225 @@ namespace AWHPerf {
 	double GetCpuSystemUsage(int refreshRate = 1000);
 	std::pair<double, double> GetMemoryFoobarUsage(int refreshRate = 1000);
 	double GetMemorySystemUsage(int refreshRate = 1000);
+#endif
+
+	// Real-time quality governor - weighs measured per-stage processing cost against a CPU budget
+	// and steps the quality tier down or back up with hysteresis. Time comes from an injectable
+	// microsecond clock and costs are fed in by the caller, so the tier logic can be driven
+	// headlessly by a mocked clock and cost model.
+	class QualityGovernor {
+	public:
+		enum Tier : int {
+			TIER_FULL = 0,            // Full quality
+			TIER_REDUCED_FFT = 1,     // Halved spectral FFT cadence
+			TIER_NO_SPATIAL = 2,      // + phase correlation and stereo width skipped
+			TIER_LOW_OVERSAMPLING = 3 // + true peak oversampling limited to 2x
+		};
+		enum Stage : size_t {
+			STAGE_ANALYSIS,
+			STAGE_PEAKMETER,
+			STAGE_RAW_AUDIO,
+			STAGE_COUNT
+		};
+		using Clock = int64_t(*)();
+
+		static constexpr int64_t WINDOW_MICROS = 500000;   // Load is evaluated over 0.5s windows
+		static constexpr int DEGRADE_WINDOWS = 2;          // Consecutive windows over budget before degrading
+		static constexpr int RESTORE_WINDOWS = 6;          // Consecutive windows with headroom before restoring
+		static constexpr double RESTORE_HEADROOM = 0.6;    // Restore only when load falls below 60% of the budget
+		static constexpr double LOAD_SMOOTHING = 0.5;
+
+		explicit QualityGovernor(Clock clock = &SteadyClockMicros) : clock(clock) {}
+
+		static int64_t SteadyClockMicros();
+		int64_t Now() const { return clock(); }
+
+		void SetBudget(double percent);
+		double GetBudget() const { return budgetPercent.load(std::memory_order_relaxed); }
+		int GetTier() const { return tier.load(std::memory_order_relaxed); }
+		double GetLoad() const { return loadPercent.load(std::memory_order_relaxed); }
+
+		void AddStageCost(Stage stage, int64_t costMicros);
+		int Evaluate();
+		void Reset();
+
+	private:
+		Clock clock;
+		std::atomic<double> budgetPercent{ 0.0 }; // Percent of one core, 0 disables the governor
+		std::atomic<double> loadPercent{ 0.0 };
+		std::atomic<int> tier{ TIER_FULL };
+		std::array<int64_t, STAGE_COUNT> stageCosts{};
+		int64_t windowStart = 0;
+		int overBudgetWindows = 0;
+		int underBudgetWindows = 0;
+	};
+
+	// Per-stage analysis profile - wall time and call counts per analysis stage plus work counters,
+	// accumulated by the engines through the AW_STAGE_* macros below and merged with Add().
+	struct StageProfile {
+		static constexpr int STAGE_TIMING_DATA_VERSION = 1; // NOTE: bump whenever Stage or STAGE_NAMES changes.
+		static constexpr bool ENABLED = AW_STAGE_PROFILING != 0;
+
+		enum Stage : size_t {
+			STAGE_DECODE,           // Full-track decoding or real-time chunk fetching
+			STAGE_K_WEIGHTING,
+			STAGE_LOUDNESS,
+			STAGE_ORIGINAL_SAMPLES,
+			STAGE_SAMPLE_PEAK,
+			STAGE_TRUE_PEAK,
+			STAGE_CHANNEL_LEVELS,
+			STAGE_DYNAMIC_RANGE,
+			STAGE_SPATIAL,
+			STAGE_FFT,              // Block energy, windowing, FFT and power spectrum
+			STAGE_BARK_MAPPING,
+			STAGE_PSYCHOACOUSTIC,   // Critical band, harmonic complexity, masking and perceptual power
+			STAGE_SPECTRAL,         // Spectral centroid, flatness and flux
+			STAGE_FINALIZE,
+			STAGE_COUNT
+		};
+		static constexpr std::array<std::string_view, STAGE_COUNT> STAGE_NAMES = {
+			"decode", "kWeighting", "loudness", "originalSamples", "samplePeak", "truePeak", "channelLevels",
+			"dynamicRange", "spatial", "fft", "barkMapping", "psychoacoustic", "spectral", "finalize"
+		};
+
+		std::array<int64_t, STAGE_COUNT> nanos{};
+		std::array<uint64_t, STAGE_COUNT> calls{};
+		uint64_t chunks = 0;
+		uint64_t frames = 0;
+		uint64_t blocks = 0; // Spectral blocks analyzed
+
+		void Add(const StageProfile& other);
+		int64_t GetTotalNanos() const;
+		void WriteJsonFields(std::ostream& os) const; // "chunks","frames","blocks","totalMs","ms":[],"calls":[] in STAGE_NAMES order
+	};
+
+	// Lap timer for StageProfile - every Lap() charges the time since the previous lap to a stage,
+	// so consecutive stages cost one clock read each. Skip() drops time already charged elsewhere.
+	class StageTimer {
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		explicit StageTimer(StageProfile& profile) : profile(profile), last(Clock::now()) {}
+
+		void Lap(StageProfile::Stage stage) {
+			const auto now = Clock::now();
+			profile.nanos[stage] += std::chrono::duration_cast<std::chrono::nanoseconds>(now - last).count();
+			++profile.calls[stage];
+			last = now;
+		}
+		void Skip() { last = Clock::now(); }
+
+	private:
+		StageProfile& profile;
+		Clock::time_point last;
+	};
+
+	// Memory accounting - current and peak bytes of the large analysis containers by category, in total
+	// and per analysis job. Owners hold a MemoryCharge per category and Set() it to their measured footprint
+	// at checkpoints, charges are attributed to the job the charging thread works for when they were first made.
+	// Totals are lock-free atomics, only charges that belong to a job take the mutex, so the real-time thread never blocks.
+	class MemoryAccounting {
+	public:
+		enum Category : size_t {
+			CATEGORY_FULL_TRACK_BUFFERS, // FullTrackData ring buffers, loudness histories and histograms
+			CATEGORY_FULL_TRACK_BLOCKS,  // FullTrackData per-block vectors, bandPowers and dynamics factors
+			CATEGORY_WAVEFORM,           // Waveform points, pyramid levels and stream copies
+			CATEGORY_FFT_CACHE,          // thread_local FFT, Hann window and Bark caches
+			CATEGORY_COUNT
+		};
+		static constexpr int MEMORY_DATA_VERSION = 1; // NOTE: bump whenever Category or CATEGORY_NAMES changes.
+		static constexpr std::array<std::string_view, CATEGORY_COUNT> CATEGORY_NAMES = {
+			"fullTrackBuffers", "fullTrackBlocks", "waveform", "fftCache"
+		};
+		static constexpr size_t MAX_JOBS = 256; // Jobs kept in the report, released ones dropped first
+
+		struct Usage {
+			std::array<int64_t, CATEGORY_COUNT> current{};
+			std::array<int64_t, CATEGORY_COUNT> peak{};
+			int64_t currentTotal = 0;
+			int64_t peakTotal = 0;
+
+			void Add(Category category, int64_t delta);
+		};
+
+		struct JobUsage {
+			uint32_t jobId = 0;
+			std::string kind;
+			Usage usage;
+		};
+
+		// Charges made on a job's worker threads go to that job, the scope restores the thread's previous job
+		class JobScope {
+		public:
+			explicit JobScope(uint32_t jobId) : previousJob(std::exchange(activeJob, jobId)) {}
+			~JobScope() { activeJob = previousJob; }
+			JobScope(const JobScope&) = delete;
+			JobScope& operator=(const JobScope&) = delete;
+
+		private:
+			uint32_t previousJob;
+		};
+
+		static void SetActiveJob(uint32_t jobId, std::string_view kind = {}); // Registers the job and sets it for the calling thread
+		static uint32_t GetActiveJob() { return activeJob; } // The calling thread's job, 0 outside analysis jobs
+		static void Charge(Category category, uint32_t jobId, int64_t delta);
+		static void GetUsage(Usage& total, std::vector<JobUsage>& jobUsages);
+		static bool GetJobUsage(uint32_t jobId, Usage& usage);
+		static void GetReportJson(std::string& json, uint32_t runningJob, const std::function<std::string_view(uint32_t jobId)>& getJobState);
+		static void ResetPeaks();
+
+	private:
+		static void UpdatePeak(std::atomic<int64_t>& peak, int64_t value);
+		static void WriteUsageJson(std::ostream& os, const Usage& usage);
+
+		static thread_local uint32_t activeJob;
+		static std::array<std::atomic<int64_t>, CATEGORY_COUNT> totalCurrent;
+		static std::array<std::atomic<int64_t>, CATEGORY_COUNT> totalPeak;
+		static std::atomic<int64_t> totalCurrentBytes;
+		static std::atomic<int64_t> totalPeakBytes;
+		static std::mutex mutex;
+		static std::deque<JobUsage> jobUsage; // Guarded by mutex, oldest first
+	};
+
+	// One owner's share of a MemoryAccounting category, released on destruction. Copies start empty
+	// and a copy-assigned charge keeps its own bytes until the next Set(), moves transfer the charge.
+	class MemoryCharge {
+	public:
+		explicit MemoryCharge(MemoryAccounting::Category category) : category(category) {}
+		MemoryCharge(const MemoryCharge& other) : category(other.category) {}
+		MemoryCharge(MemoryCharge&& other) noexcept :
+			category(other.category), jobId(other.jobId), bytes(std::exchange(other.bytes, 0)) {}
+		~MemoryCharge() { Set(0); }
+
+		MemoryCharge& operator=(const MemoryCharge&) { return *this; }
+		MemoryCharge& operator=(MemoryCharge&& other) noexcept;
+
+		void Set(size_t newBytes);
+		size_t Get() const { return bytes; }
+
+	private:
+		MemoryAccounting::Category category;
+		uint32_t jobId = 0;
+		size_t bytes = 0;
+	};
+
+	template<typename T>
+	size_t GetVectorBytes(const std::vector<T>& vector) {
+		return vector.capacity() * sizeof(T);
+	}
 }
+
+#if AW_STAGE_PROFILING
+#define AW_STAGE_TIMER(timer, profile) AWHPerf::StageTimer timer(profile)
+#define AW_STAGE_LAP(timer, stage) timer.Lap(AWHPerf::StageProfile::stage)
+#define AW_STAGE_SKIP(timer) timer.Skip()
+#define AW_STAGE_COUNT(profile, counter, amount) ((profile).counter += (amount))
+#else
+#define AW_STAGE_TIMER(timer, profile) ((void)0)
+#define AW_STAGE_LAP(timer, stage) ((void)0)
+#define AW_STAGE_SKIP(timer) ((void)0)
+#define AW_STAGE_COUNT(profile, counter, amount) ((void)0)
+#endif
 #pragma endregion
 
 
@@ -900,6 +1292,7 @@ namespace AWHString {
 	bool EqualsIgnoreCase(const std::string& input, const char* compareValue);
 	std::string EscapeJsonString(std::string_view input);
 	std::wstring FormatSampleRate(const double& sampleRate);
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 	std::string FormatDate(std::chrono::system_clock::time_point time, const char* format = "%d-%m-%Y");
 	CStringA FormatTimestampMs(double ms);
 	double GetElapsedTime(const std::chrono::steady_clock::time_point& startTime);
@@ -907,16 +1300,20 @@ namespace AWHString {
 	std::wstring GetProcessingSpeed(double totalDuration, const std::chrono::steady_clock::time_point& startTime, int precision = 2);
 	CStringW GetWindowTextCStringW(HWND hWnd);
 	std::vector<CStringW> SplitString(const CStringW& input, const wchar_t* delimiter);
+#endif
 	pfc::string8 ToFixed(int precision, int value);
 	pfc::string8 ToFixed(int precision, double value);
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 	CStringW ToFixedW(int precision, double value);
 	pfc::string8 ToLowerCase(const std::string& input);
 	pfc::string8 ToNarrow(const std::wstring& input);
 	std::wstring ToWide(const pfc::string8& input);
+#endif
 };
 #pragma endregion
 
 
+#ifndef AW_HEADLESS // Win32 and foobar2000 SDK only, left out of the headless build
 //////////////////////
 // * TEXT HELPERS * //
 //////////////////////
@@ -932,3 +1329,4 @@ namespace AWHText {
 	CStringA WriteFancyHeader(const CStringA& titlePrefix, const CStringA& date = "");
 };
 #pragma endregion
+#endif
@@ -0,0 +1,357 @@
+/////////////////////////////////////////////////////////////////////////////////
+// * FB2K Component: Audio Wizard                                            * //
+// * Description:  Audio Wizard Jobs Source File                * //
+// * Author:     TT                           * //
+// * Website:    https://github.com/The-Wizardium/Audio-Wizard        * //
+// * Version:    0.6.0                            * //
+// * Dev. started:  19-10-2026                       * //
+// * Last change:  19-10-2026                       * //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#include "AW_Jobs.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+
+//////////////////////////////////
+// * CONSTRUCTOR & DESTRUCTOR * //
+//////////////////////////////////
+#pragma region Constructor & Destructor
+AudioWizardJobs::AudioWizardJobs(JobObserver observer) : observer(std::move(observer)) {
+	worker = std::thread(&AudioWizardJobs::JobWorker, this);
+}
+
+AudioWizardJobs::~AudioWizardJobs() {
+	{
+		std::scoped_lock lock(mutex);
+		isStopping = true;
+
+		for (const auto& job : queue) {
+			job->isCanceled.store(true, std::memory_order_release);
+		}
+		if (runningJob) {
+			InterruptJob(*runningJob, false);
+		}
+	}
+
+	jobQueued.notify_all();
+	if (worker.joinable()) worker.join();
+}
+#pragma endregion
+
+
+/////////////////////
+// * JOB CONTEXT * //
+/////////////////////
+#pragma region Job Context
+uint32_t AudioWizardJobs::JobContext::GetJobId() const {
+	return job.id;
+}
+
+bool AudioWizardJobs::JobContext::IsCanceled() const {
+	return job.isCanceled.load(std::memory_order_acquire) || job.isPreempted.load(std::memory_order_acquire);
+}
+
+bool AudioWizardJobs::JobContext::IsPreempted() const {
+	// A cancel wins over a preemption, the job worker drops such a job instead of queuing it again
+	return job.isPreempted.load(std::memory_order_acquire) && !job.isCanceled.load(std::memory_order_acquire);
+}
+
+void AudioWizardJobs::JobContext::SetProgress(double progress) const {
+	job.progress.store(std::clamp(progress, 0.0, 1.0), std::memory_order_relaxed);
+}
+
+void AudioWizardJobs::JobContext::SetCancelHandler(std::function<void()> handler) const {
+	std::scoped_lock lock(job.handlerMutex);
+	job.cancelHandler = std::move(handler);
+
+	// A cancel that arrived before the handler was set is delivered right away
+	if (job.cancelHandler && IsCanceled()) job.cancelHandler();
+}
+
+void AudioWizardJobs::JobContext::SetResultJson(std::string json) const {
+	std::scoped_lock lock(job.resultMutex);
+	job.resultJson = std::move(json);
+}
+#pragma endregion
+
+
+////////////////////////////
+// * PUBLIC JOB CONTROL * //
+////////////////////////////
+#pragma region Public Job Control
+uint32_t AudioWizardJobs::SubmitJob(std::string_view kind, int priority, JobWork work, bool supersede) {
+	auto job = std::make_shared<Job>();
+	job->kind = kind;
+	job->priority = std::clamp(priority, Config::MIN_PRIORITY, Config::MAX_PRIORITY);
+	job->work = std::move(work);
+
+	{
+		std::scoped_lock lock(mutex);
+		if (isStopping) return 0;
+
+		job->id = nextId++;
+		job->sequence = nextSequence++;
+
+		// A superseding job replaces the pending and running jobs of the same kind and priority
+		if (supersede) {
+			for (auto it = queue.begin(); it != queue.end(); ) {
+				if ((*it)->kind == kind && (*it)->priority == job->priority) {
+					(*it)->isCanceled.store(true, std::memory_order_release);
+					FinishJob(*it, JobState::Canceled);
+					it = queue.erase(it);
+				}
+				else {
+					++it;
+				}
+			}
+			if (runningJob && runningJob->kind == kind && runningJob->priority == job->priority) {
+				InterruptJob(*runningJob, false);
+			}
+		}
+
+		// A higher priority job preempts the running one, which goes back to the queue and runs again later
+		if (runningJob && job->priority > runningJob->priority && !runningJob->isCanceled.load(std::memory_order_acquire)) {
+			InterruptJob(*runningJob, true);
+		}
+
+		queue.push_back(job);
+	}
+
+	jobQueued.notify_one();
+	return job->id;
+}
+
+bool AudioWizardJobs::CancelJob(uint32_t id) {
+	std::scoped_lock lock(mutex);
+
+	for (auto it = queue.begin(); it != queue.end(); ++it) {
+		if ((*it)->id == id) {
+			(*it)->isCanceled.store(true, std::memory_order_release);
+			FinishJob(*it, JobState::Canceled);
+			queue.erase(it);
+			return true;
+		}
+	}
+
+	if (runningJob && runningJob->id == id) {
+		InterruptJob(*runningJob, false);
+		return true;
+	}
+
+	return false;
+}
+
+void AudioWizardJobs::CancelJobs(std::initializer_list<std::string_view> kinds, bool wait) {
+	auto isMatch = [&kinds](const Job& job) {
+		return std::find(kinds.begin(), kinds.end(), job.kind) != kinds.end();
+	};
+
+	std::unique_lock lock(mutex);
+
+	for (auto it = queue.begin(); it != queue.end(); ) {
+		if (isMatch(**it)) {
+			(*it)->isCanceled.store(true, std::memory_order_release);
+			FinishJob(*it, JobState::Canceled);
+			it = queue.erase(it);
+		}
+		else {
+			++it;
+		}
+	}
+
+	if (!runningJob || !isMatch(*runningJob)) return;
+
+	const std::shared_ptr<Job> job = runningJob;
+	InterruptJob(*job, false);
+
+	// A job canceling its own kind must not wait for itself
+	if (wait && std::this_thread::get_id() != worker.get_id()) {
+		jobFinished.wait(lock, [this, &job] { return runningJob != job; });
+	}
+}
+
+bool AudioWizardJobs::GetJobInfo(uint32_t id, JobInfo& info) const {
+	std::scoped_lock lock(mutex);
+
+	if (runningJob && runningJob->id == id) {
+		FillJobInfo(*runningJob, info);
+		return true;
+	}
+
+	for (const auto& job : queue) {
+		if (job->id == id) {
+			FillJobInfo(*job, info);
+			return true;
+		}
+	}
+
+	for (const auto& job : finishedJobs) {
+		if (job->id == id) {
+			FillJobInfo(*job, info);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void AudioWizardJobs::GetJobInfoJson(uint32_t id, std::string& json) const {
+	std::ostringstream oss;
+	JobInfo info;
+
+	oss << "{\"id\":" << id;
+
+	if (GetJobInfo(id, info)) {
+		oss << ",\"kind\":\"" << info.kind << "\""
+			<< ",\"state\":\"" << Config::JOB_STATE_NAMES[static_cast<size_t>(info.state)] << "\""
+			<< ",\"priority\":" << info.priority
+			<< ",\"progress\":" << std::fixed << std::setprecision(4) << info.progress
+			<< ",\"preemptions\":" << info.preemptions;
+
+		if (!info.error.empty()) {
+			oss << ",\"error\":\"";
+			for (char c : info.error) {
+				if (c == '"' || c == '\\') oss << '\\';
+				if (static_cast<unsigned char>(c) >= 0x20) oss << c;
+			}
+			oss << "\"";
+		}
+
+		if (!info.resultJson.empty()) {
+			oss << ",\"result\":" << info.resultJson;
+		}
+	}
+	else {
+		oss << ",\"state\":\"unknown\"";
+	}
+
+	oss << "}";
+	json = oss.str();
+}
+
+std::string_view AudioWizardJobs::GetJobStateName(uint32_t id) const {
+	JobInfo info;
+	return GetJobInfo(id, info) ? Config::JOB_STATE_NAMES[static_cast<size_t>(info.state)] : "unknown";
+}
+
+uint32_t AudioWizardJobs::GetRunningJobId() const {
+	std::scoped_lock lock(mutex);
+	return runningJob ? runningJob->id : 0;
+}
+
+bool AudioWizardJobs::IsJobThread() const {
+	return std::this_thread::get_id() == worker.get_id();
+}
+#pragma endregion
+
+
+////////////////////////////////
+// * PRIVATE JOB PROCESSING * //
+////////////////////////////////
+#pragma region Private Job Processing
+void AudioWizardJobs::JobWorker() {
+	std::unique_lock lock(mutex);
+
+	while (true) {
+		jobQueued.wait(lock, [this] { return isStopping || !queue.empty(); });
+		if (isStopping) break;
+
+		// Highest priority first, oldest first among equals
+		auto next = std::max_element(queue.begin(), queue.end(), [](const auto& a, const auto& b) {
+			return a->priority != b->priority ? a->priority < b->priority : a->sequence > b->sequence;
+		});
+		const std::shared_ptr<Job> job = *next;
+		queue.erase(next);
+
+		// A preempted job keeps its progress, it resumes where it stopped instead of starting over
+		job->state = JobState::Running;
+		job->isPreempted.store(false, std::memory_order_release);
+		runningJob = job;
+		lock.unlock();
+
+		bool success = false;
+		std::string error;
+
+		// Lets the component tie what the job does on this thread, memory charges included, to the job
+		if (observer) observer(job->id, job->kind);
+		try {
+			success = job->work(JobContext(*job));
+		}
+		catch (const std::exception& e) {
+			error = e.what();
+		}
+		catch (...) {
+			error = "unknown exception";
+		}
+		if (observer) observer(0, {});
+
+		{
+			std::scoped_lock handlerLock(job->handlerMutex);
+			job->cancelHandler = nullptr;
+		}
+
+		lock.lock();
+		runningJob.reset();
+
+		// A job that finished its work counts as completed even when it was preempted at the very end
+		if (job->isCanceled.load(std::memory_order_acquire)) {
+			FinishJob(job, JobState::Canceled);
+		}
+		else if (success) {
+			job->progress.store(1.0, std::memory_order_relaxed);
+			FinishJob(job, JobState::Completed);
+		}
+		else if (job->isPreempted.load(std::memory_order_acquire) && !isStopping) {
+			job->state = JobState::Queued;
+			++job->preemptions;
+			queue.push_back(job);
+		}
+		else {
+			job->error = error.empty() ? "job reported failure" : error;
+			FinishJob(job, JobState::Failed);
+		}
+
+		jobFinished.notify_all();
+	}
+
+	// Jobs still queued at shutdown never ran
+	for (const auto& job : queue) {
+		FinishJob(job, JobState::Canceled);
+	}
+	queue.clear();
+}
+
+void AudioWizardJobs::FinishJob(const std::shared_ptr<Job>& job, JobState state) {
+	job->state = state;
+	job->work = nullptr; // Releases whatever the job captured, track lists included
+
+	finishedJobs.push_back(job);
+	if (finishedJobs.size() > Config::MAX_FINISHED_JOBS) {
+		finishedJobs.pop_front();
+	}
+}
+
+void AudioWizardJobs::InterruptJob(Job& job, bool preempt) {
+	(preempt ? job.isPreempted : job.isCanceled).store(true, std::memory_order_release);
+
+	std::scoped_lock lock(job.handlerMutex);
+	if (job.cancelHandler) job.cancelHandler();
+}
+
+void AudioWizardJobs::FillJobInfo(const Job& job, JobInfo& info) {
+	info.id = job.id;
+	info.kind = job.kind;
+	info.error = job.error;
+	{
+		std::scoped_lock lock(job.resultMutex);
+		info.resultJson = job.resultJson;
+	}
+	info.priority = job.priority;
+	info.state = job.state;
+	info.progress = job.progress.load(std::memory_order_relaxed);
+	info.preemptions = job.preemptions;
+}
+#pragma endregion
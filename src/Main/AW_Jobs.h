@@ -0,0 +1,131 @@
+/////////////////////////////////////////////////////////////////////////////////
+// * FB2K Component: Audio Wizard                                            * //
+// * Description:  Audio Wizard Jobs Header File                * //
+// * Author:     TT                           * //
+// * Website:    https://github.com/The-Wizardium/Audio-Wizard        * //
+// * Version:    0.6.0                            * //
+// * Dev. started:  19-10-2026                       * //
+// * Last change:  19-10-2026                       * //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+// The scheduler only uses the standard library and is built without AW_PCH.h, see aw_jobs in CMakeLists.txt
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+
+//////////////
+// * JOBS * //
+//////////////
+#pragma region Jobs
+class AudioWizardJobs {
+public:
+	enum class JobState {
+		Queued, Running, Completed, Failed, Canceled
+	};
+
+	struct Config {
+		static constexpr int MIN_PRIORITY = 0;
+		static constexpr int DEF_PRIORITY = 50;
+		static constexpr int MAX_PRIORITY = 100;
+		static constexpr size_t MAX_FINISHED_JOBS = 256; // Finished jobs kept for status queries, oldest dropped first
+		static constexpr std::array<std::string_view, 5> JOB_STATE_NAMES = {
+			"queued", "running", "completed", "failed", "canceled"
+		};
+	};
+
+	// * JOB CONTEXT * //
+	struct Job;
+	class JobContext { // Handed to a running job, the only way a job talks back to the scheduler
+	public:
+		explicit JobContext(Job& job) : job(job) {}
+		uint32_t GetJobId() const;
+		bool IsCanceled() const;
+		bool IsPreempted() const; // Interrupted only to make room, the job is queued again and runs later
+		void SetProgress(double progress) const;
+		void SetCancelHandler(std::function<void()> handler) const;
+		void SetResultJson(std::string json) const;
+
+	private:
+		Job& job;
+	};
+
+	using JobWork = std::function<bool(const JobContext&)>; // Returns false when the job failed
+	using JobObserver = std::function<void(uint32_t jobId, std::string_view kind)>; // On the job thread, id 0 when the job returns
+
+	// * JOB STATE * //
+	struct Job {
+		uint32_t id = 0;
+		uint64_t sequence = 0; // Submission order, keeps jobs of equal priority first-in first-out
+		std::string kind;
+		int priority = Config::DEF_PRIORITY;
+		JobWork work;
+		JobState state = JobState::Queued; // Guarded by the scheduler mutex
+		std::string error;                 // Guarded by the scheduler mutex
+		uint32_t preemptions = 0;          // Guarded by the scheduler mutex
+		std::atomic<double> progress = 0.0;
+		std::atomic<bool> isCanceled = false;  // Canceled by the caller, the job is dropped
+		std::atomic<bool> isPreempted = false; // Interrupted by a higher priority job, the job is queued again
+		std::mutex handlerMutex;
+		std::function<void()> cancelHandler;   // Guarded by handlerMutex
+		mutable std::mutex resultMutex;
+		std::string resultJson;                // Guarded by resultMutex, a JSON value reported with the job status
+	};
+
+	struct JobInfo {
+		uint32_t id = 0;
+		std::string kind;
+		std::string error;
+		std::string resultJson;
+		int priority = 0;
+		JobState state = JobState::Queued;
+		double progress = 0.0;
+		uint32_t preemptions = 0;
+	};
+
+	// * CONSTRUCTOR & DESTRUCTOR * //
+	explicit AudioWizardJobs(JobObserver observer = nullptr);
+	~AudioWizardJobs();
+
+	// * PUBLIC JOB CONTROL * //
+	uint32_t SubmitJob(std::string_view kind, int priority, JobWork work, bool supersede = false);
+	bool CancelJob(uint32_t id);
+	void CancelJobs(std::initializer_list<std::string_view> kinds, bool wait);
+	bool GetJobInfo(uint32_t id, JobInfo& info) const;
+	void GetJobInfoJson(uint32_t id, std::string& json) const;
+	std::string_view GetJobStateName(uint32_t id) const;
+	uint32_t GetRunningJobId() const;
+	bool IsJobThread() const;
+
+private:
+	const JobObserver observer;
+	mutable std::mutex mutex;
+	std::condition_variable jobQueued;
+	std::condition_variable jobFinished;
+	std::vector<std::shared_ptr<Job>> queue;
+	std::shared_ptr<Job> runningJob;
+	std::deque<std::shared_ptr<Job>> finishedJobs;
+	uint32_t nextId = 1;
+	uint64_t nextSequence = 0;
+	bool isStopping = false;
+	std::thread worker;
+
+	// * PRIVATE JOB PROCESSING * //
+	void JobWorker();
+	void FinishJob(const std::shared_ptr<Job>& job, JobState state);
+	static void InterruptJob(Job& job, bool preempt);
+	static void FillJobInfo(const Job& job, JobInfo& info);
+};
+#pragma endregion
@@ -58,6 +58,19 @@ void AudioWizardMain::SetFullTrackAnalysisCallback(const VARIANT* callback) {
 void AudioWizardMain::SetFullTrackWaveformCallback(const VARIANT* callback) {
 	AWHCOM::CreateCallback(callbacks.fullTrackWaveformCallback, callback, "FullTrackWaveform");
 }
+
+void AudioWizardMain::SetFullTrackCombinedCallback(const VARIANT* callback) {
+	AWHCOM::CreateCallback(callbacks.fullTrackCombinedCallback, callback, "FullTrackCombined");
+}
+
+void AudioWizardMain::SetWaveformProgressCallback(const VARIANT* callback) {
+	AWHCOM::CreateCallback(callbacks.waveformProgressCallback, callback, "WaveformProgress");
+}
+
+void AudioWizardMain::SetFullTrackResultCallback(const VARIANT* callback, bool releaseResults) {
+	AWHCOM::CreateCallback(callbacks.fullTrackResultCallback, callback, "FullTrackResult");
+	mainFullTrack->monitor.isReleasingDeliveredResults.store(releaseResults, std::memory_order_release);
+}
 #pragma endregion
 
 
@@ -65,34 +78,45 @@ void AudioWizardMain::SetFullTrackWaveformCallback(const VARIANT* callback) {
 // * PUBLIC API - FULL-TRACK ANALYSIS CONTROL * //
 //////////////////////////////////////////////////
 #pragma region Public API - Full-Track Analysis Control
-void AudioWizardMain::StartFullTrackAnalysis(const metadb_handle_list& metadata, int chunkDurationMs) {
+uint32_t AudioWizardMain::StartFullTrackAnalysis(const metadb_handle_list& metadata, int chunkDurationMs, int priority) {
 	if (metadata.get_count() == 0) {
 		FB2K_console_formatter() << "Audio Wizard => StartFullTrackAnalysis: No tracks selected, cannot start analysis.";
 		AWHCOM::FireCallback(callbacks.fullTrackAnalysisCallback, false);
-		return;
+		return 0;
 	}
 
-	mainFullTrack->StartFullTrackAnalysis(metadata, chunkDurationMs);
+	return mainFullTrack->StartFullTrackAnalysis(metadata, chunkDurationMs, priority);
 }
 
 void AudioWizardMain::StopFullTrackAnalysis() {
 	mainFullTrack->StopFullTrackAnalysis();
 }
 
-void AudioWizardMain::StartFullTrackWaveform(const metadb_handle_list& metadata, int chunkDurationMs) {
+uint32_t AudioWizardMain::StartFullTrackWaveform(const metadb_handle_list& metadata, const WaveformPreparation& prepareWaveform, int priority) {
 	if (metadata.get_count() == 0) {
 		FB2K_console_formatter() << "Audio Wizard => StartFullTrackWaveform: No track provided, cannot start analysis.";
 		AWHCOM::FireCallback(callbacks.fullTrackWaveformCallback, false);
-		return;
+		return 0;
 	}
 
-	mainFullTrack->StartFullTrackWaveform(metadata, chunkDurationMs);
+	return mainFullTrack->StartFullTrackWaveform(metadata, prepareWaveform, priority);
 }
 
 void AudioWizardMain::StopFullTrackWaveform() {
 	mainFullTrack->StopFullTrackWaveform();
 }
 
+uint32_t AudioWizardMain::StartFullTrackCombined(const metadb_handle_list& metadata, int chunkDurationMs,
+	const WaveformPreparation& prepareWaveform, int priority) {
+	if (metadata.get_count() == 0) {
+		FB2K_console_formatter() << "Audio Wizard => StartFullTrackCombined: No tracks provided, cannot start analysis.";
+		AWHCOM::FireCallback(callbacks.fullTrackCombinedCallback, false);
+		return 0;
+	}
+
+	return mainFullTrack->StartFullTrackCombined(metadata, chunkDurationMs, prepareWaveform, priority);
+}
+
 void AudioWizardMain::StopFullTrackAudioProcessor() {
 	mainFullTrack->StopFullTrackAnalysis();
 	mainFullTrack->StopFullTrackWaveform();
@@ -118,115 +142,119 @@ void AudioWizardMain::GetFullTrackMetrics(SAFEARRAY** fullTrackMetrics) const {
 	mainFullTrack->GetFullTrackMetrics(fullTrackMetrics);
 }
 
+void AudioWizardMain::GetFullTrackMetricsBatch(const std::vector<LONG>& trackIndices, ULONG metricMask, SAFEARRAY** fullTrackMetrics) const {
+	mainFullTrack->GetFullTrackMetricsBatch(trackIndices, metricMask, fullTrackMetrics);
+}
+
 void AudioWizardMain::GetFullTrackMetricsDataInfo(pfc::string8& json) const {
 	mainFullTrack->GetFullTrackMetricsDataInfo(json);
 }
 
+void AudioWizardMain::GetFullTrackStageTimings(pfc::string8& json) const {
+	mainFullTrack->GetFullTrackStageTimings(json);
+}
+
 double AudioWizardMain::GetMomentaryLUFSFull(LONG trackIndex) const {
 	metadb_handle_ptr track;
-	if (!ValidateTrackAndAnalysis(track, trackIndex)) return -INFINITY;
+	AudioWizardMainFullTrack::FullTrackTablePtr table;
+	if (!ValidateTrackAndAnalysis(track, table, trackIndex)) return -INFINITY;
 
-	int readIndex = mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire);
-	return AudioWizardAnalysisFullTrack::GetMomentaryLUFSFull(*mainFullTrack->analysis.fullTrackData[readIndex][trackIndex]);
+	return AudioWizardAnalysisFullTrack::GetMomentaryLUFSFull(*table->trackData[trackIndex]);
 }
 
 double AudioWizardMain::GetShortTermLUFSFull(LONG trackIndex) const {
 	metadb_handle_ptr track;
-	if (!ValidateTrackAndAnalysis(track, trackIndex)) return -INFINITY;
+	AudioWizardMainFullTrack::FullTrackTablePtr table;
+	if (!ValidateTrackAndAnalysis(track, table, trackIndex)) return -INFINITY;
 
-	int readIndex = mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire);
-	return AudioWizardAnalysisFullTrack::GetShortTermLUFSFull(*mainFullTrack->analysis.fullTrackData[readIndex][trackIndex]);
+	return AudioWizardAnalysisFullTrack::GetShortTermLUFSFull(*table->trackData[trackIndex]);
 }
 
 double AudioWizardMain::GetIntegratedLUFSFull(LONG trackIndex) const {
 	metadb_handle_ptr track;
-	if (!ValidateTrackAndAnalysis(track, trackIndex)) return -INFINITY;
+	AudioWizardMainFullTrack::FullTrackTablePtr table;
+	if (!ValidateTrackAndAnalysis(track, table, trackIndex)) return -INFINITY;
 
-	int readIndex = mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire);
-	return AudioWizardAnalysisFullTrack::GetIntegratedLUFSFull(*mainFullTrack->analysis.fullTrackData[readIndex][trackIndex]);
+	return AudioWizardAnalysisFullTrack::GetIntegratedLUFSFull(*table->trackData[trackIndex]);
 }
 
 double AudioWizardMain::GetRMSFull(LONG trackIndex) const {
 	metadb_handle_ptr track;
-	if (!ValidateTrackAndAnalysis(track, trackIndex)) return -INFINITY;
+	AudioWizardMainFullTrack::FullTrackTablePtr table;
+	if (!ValidateTrackAndAnalysis(track, table, trackIndex)) return -INFINITY;
 
-	int readIndex = mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire);
-	return AudioWizardAnalysisFullTrack::GetRMSFull(*mainFullTrack->analysis.fullTrackData[readIndex][trackIndex]);
+	return AudioWizardAnalysisFullTrack::GetRMSFull(*table->trackData[trackIndex]);
 }
 
 double AudioWizardMain::GetSamplePeakFull(LONG trackIndex) const {
 	metadb_handle_ptr track;
-	if (!ValidateTrackAndAnalysis(track, trackIndex)) return -INFINITY;
+	AudioWizardMainFullTrack::FullTrackTablePtr table;
+	if (!ValidateTrackAndAnalysis(track, table, trackIndex)) return -INFINITY;
 
-	int readIndex = mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire);
-	return AudioWizardAnalysisFullTrack::GetSamplePeakFull(*mainFullTrack->analysis.fullTrackData[readIndex][trackIndex]);
+	return AudioWizardAnalysisFullTrack::GetSamplePeakFull(*table->trackData[trackIndex]);
 }
 
 double AudioWizardMain::GetTruePeakFull(LONG trackIndex) const {
 	metadb_handle_ptr track;
-	if (!ValidateTrackAndAnalysis(track, trackIndex)) return -INFINITY;
+	AudioWizardMainFullTrack::FullTrackTablePtr table;
+	if (!ValidateTrackAndAnalysis(track, table, trackIndex)) return -INFINITY;
 
-	int readIndex = mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire);
-	return AudioWizardAnalysisFullTrack::GetTruePeakFull(*mainFullTrack->analysis.fullTrackData[readIndex][trackIndex]);
+	return AudioWizardAnalysisFullTrack::GetTruePeakFull(*table->trackData[trackIndex]);
 }
 
 double AudioWizardMain::GetPSRFull(LONG trackIndex) const {
 	metadb_handle_ptr track;
-	if (!ValidateTrackAndAnalysis(track, trackIndex)) return -INFINITY;
+	AudioWizardMainFullTrack::FullTrackTablePtr table;
+	if (!ValidateTrackAndAnalysis(track, table, trackIndex)) return -INFINITY;
 
-	int readIndex = mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire);
-	return AudioWizardAnalysisFullTrack::GetPSRFull(*mainFullTrack->analysis.fullTrackData[readIndex][trackIndex]);
+	return AudioWizardAnalysisFullTrack::GetPSRFull(*table->trackData[trackIndex]);
 }
 
 double AudioWizardMain::GetPLRFull(LONG trackIndex) const {
 	metadb_handle_ptr track;
-	if (!ValidateTrackAndAnalysis(track, trackIndex)) return -INFINITY;
+	AudioWizardMainFullTrack::FullTrackTablePtr table;
+	if (!ValidateTrackAndAnalysis(track, table, trackIndex)) return -INFINITY;
 
-	int readIndex = mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire);
-	return AudioWizardAnalysisFullTrack::GetPLRFull(*mainFullTrack->analysis.fullTrackData[readIndex][trackIndex]);
+	return AudioWizardAnalysisFullTrack::GetPLRFull(*table->trackData[trackIndex]);
 }
 
 double AudioWizardMain::GetCrestFactorFull(LONG trackIndex) const {
 	metadb_handle_ptr track;
-	if (!ValidateTrackAndAnalysis(track, trackIndex)) return -INFINITY;
+	AudioWizardMainFullTrack::FullTrackTablePtr table;
+	if (!ValidateTrackAndAnalysis(track, table, trackIndex)) return -INFINITY;
 
-	int readIndex = mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire);
-	return AudioWizardAnalysisFullTrack::GetCrestFactorFull(*mainFullTrack->analysis.fullTrackData[readIndex][trackIndex]);
+	return AudioWizardAnalysisFullTrack::GetCrestFactorFull(*table->trackData[trackIndex]);
 }
 
 double AudioWizardMain::GetLoudnessRangeFull(LONG trackIndex) const {
 	metadb_handle_ptr track;
-	if (!ValidateTrackAndAnalysis(track, trackIndex)) return -INFINITY;
+	AudioWizardMainFullTrack::FullTrackTablePtr table;
+	if (!ValidateTrackAndAnalysis(track, table, trackIndex)) return -INFINITY;
 
-	int readIndex = mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire);
-	return AudioWizardAnalysisFullTrack::GetLoudnessRangeFull(*mainFullTrack->analysis.fullTrackData[readIndex][trackIndex]);
+	return AudioWizardAnalysisFullTrack::GetLoudnessRangeFull(*table->trackData[trackIndex]);
 }
 
 double AudioWizardMain::GetDynamicRangeFull(LONG trackIndex) const {
 	metadb_handle_ptr track;
-	if (!ValidateTrackAndAnalysis(track, trackIndex)) return -INFINITY;
+	AudioWizardMainFullTrack::FullTrackTablePtr table;
+	if (!ValidateTrackAndAnalysis(track, table, trackIndex)) return -INFINITY;
 
-	int readIndex = mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire);
-	return AudioWizardAnalysisFullTrack::GetDynamicRangeFull(*mainFullTrack->analysis.fullTrackData[readIndex][trackIndex]);
+	return AudioWizardAnalysisFullTrack::GetDynamicRangeFull(*table->trackData[trackIndex]);
 }
 
 double AudioWizardMain::GetPureDynamicsFull(LONG trackIndex) const {
 	metadb_handle_ptr track;
-	if (!ValidateTrackAndAnalysis(track, trackIndex)) return -INFINITY;
+	AudioWizardMainFullTrack::FullTrackTablePtr table;
+	if (!ValidateTrackAndAnalysis(track, table, trackIndex)) return -INFINITY;
 
-	int readIndex = mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire);
-	return AudioWizardAnalysisFullTrack::GetPureDynamicsFull(*mainFullTrack->analysis.fullTrackData[readIndex][trackIndex]);
+	return AudioWizardAnalysisFullTrack::GetPureDynamicsFull(*table->trackData[trackIndex]);
 }
 
 std::map<std::wstring, double> AudioWizardMain::GetAlbumMetricFull(
 	const std::function<double(const AudioWizardAnalysisFullTrack::FullTrackResults&)>& metricAccessor) const {
 
-	auto index = static_cast<size_t>(mainFullTrack->analysis.fullTrackIndex.load(std::memory_order_acquire));
-	if (index >= mainFullTrack->analysis.fullTrackData.size()) {
-		return {};
-	}
-
-	const auto& tracks = mainFullTrack->analysis.fullTrackData[index];
+	const auto table = mainFullTrack->GetFullTrackTable();
+	const auto& tracks = table->trackData;
 	if (tracks.empty()) {
 		return {};
 	}
@@ -275,10 +303,32 @@ void AudioWizardMain::StopRawAudioMonitoring() {
 	mainRealTime->StopRawAudioMonitoring();
 }
 
+bool AudioWizardMain::StartSharedAudioRing(const std::string& name, uint32_t capacityFrames, int refreshRateMs, int chunkDurationMs) {
+	return mainRealTime->StartSharedAudioRing(name, capacityFrames, refreshRateMs, chunkDurationMs);
+}
+
+void AudioWizardMain::StopSharedAudioRing() {
+	mainRealTime->StopSharedAudioRing();
+}
+
+void AudioWizardMain::StartSpectrumMonitoring(int bins, bool logBinning, double smoothing, double peakDecay) {
+	mainRealTime->StartSpectrumMonitoring(bins, logBinning, smoothing, peakDecay);
+}
+
+void AudioWizardMain::StopSpectrumMonitoring() {
+	mainRealTime->StopSpectrumMonitoring();
+}
+
+void AudioWizardMain::SetRealTimeCpuBudget(double percent) {
+	mainRealTime->SetCpuBudget(percent);
+}
+
 void AudioWizardMain::StopRealTimeAudioProcessor() {
 	mainRealTime->StopPeakmeterMonitoring();
 	mainRealTime->StopRealTimeMonitoring();
 	mainRealTime->StopRawAudioMonitoring();
+	mainRealTime->StopSharedAudioRing();
+	mainRealTime->StopSpectrumMonitoring();
 }
 #pragma endregion
 
@@ -291,6 +341,46 @@ void AudioWizardMain::GetRawAudioData(SAFEARRAY** data) const {
 	mainRealTime->GetRawAudioData(data);
 }
 
+void AudioWizardMain::GetRealTimeMetricsSnapshot(SAFEARRAY** snapshot) const {
+	mainRealTime->GetRealTimeMetricsSnapshot(snapshot);
+}
+
+void AudioWizardMain::GetRealTimeMetricsDataInfo(pfc::string8& json) const {
+	mainRealTime->GetRealTimeMetricsDataInfo(json);
+}
+
+void AudioWizardMain::GetRealTimeStageTimings(pfc::string8& json) const {
+	mainRealTime->GetRealTimeStageTimings(json);
+}
+
+void AudioWizardMain::GetRealTimeHistory(uint64_t since, int resolutionMs, SAFEARRAY** history) const {
+	mainRealTime->GetRealTimeHistory(since, resolutionMs, history);
+}
+
+void AudioWizardMain::GetSpectrumData(SAFEARRAY** data) const {
+	mainRealTime->GetSpectrumData(data);
+}
+
+void AudioWizardMain::GetSpectrumDataInfo(pfc::string8& json) const {
+	mainRealTime->GetSpectrumDataInfo(json);
+}
+
+int AudioWizardMain::GetRealTimeQualityTier() const {
+	return mainRealTime->GetQualityTier();
+}
+
+void AudioWizardMain::GetChannelRMS(SAFEARRAY** data) const {
+	mainRealTime->GetChannelRMS(data);
+}
+
+void AudioWizardMain::GetChannelSamplePeaks(SAFEARRAY** data) const {
+	mainRealTime->GetChannelSamplePeaks(data);
+}
+
+void AudioWizardMain::GetChannelTruePeaks(SAFEARRAY** data) const {
+	mainRealTime->GetChannelTruePeaks(data);
+}
+
 void AudioWizardMain::GetMomentaryLUFS(double* value) const {
 	*value = mainRealTime->metrics.momentaryLUFS.load();
 }
@@ -299,6 +389,10 @@ void AudioWizardMain::GetShortTermLUFS(double* value) const {
 	*value = mainRealTime->metrics.shortTermLUFS.load();
 }
 
+void AudioWizardMain::GetIntegratedLUFS(double* value) const {
+	*value = mainRealTime->metrics.integratedLUFS.load();
+}
+
 void AudioWizardMain::GetLeftRMS(double* value) const {
 	*value = mainRealTime->metrics.leftRMS.load();
 }
@@ -373,7 +467,8 @@ bool AudioWizardMain::IsFullTrackSelected(metadb_handle_ptr& track) const {
 	return true;
 }
 
-bool AudioWizardMain::ValidateTrackAndAnalysis(metadb_handle_ptr& track, LONG trackIndex) const {
+bool AudioWizardMain::ValidateTrackAndAnalysis(metadb_handle_ptr& track, AudioWizardMainFullTrack::FullTrackTablePtr& table,
+	LONG trackIndex) const {
 	metadb_handle_list tracks;
 	static_api_ptr_t<playlist_manager> playlistManager;
 	const t_size playlistIndex = playlistManager->get_active_playlist();
@@ -389,6 +484,15 @@ bool AudioWizardMain::ValidateTrackAndAnalysis(metadb_handle_ptr& track, LONG tr
 		return false;
 	}
 
+	// The caller reads the row from this table, a job that completes meanwhile cannot swap it out.
+	// Tracks delivered with releaseResults no longer hold their analysis data.
+	table = mainFullTrack->GetFullTrackTable();
+	const auto& trackData = table->trackData;
+	if (static_cast<size_t>(trackIndex) >= trackData.size() || !trackData[trackIndex]) {
+		FB2K_console_formatter() << "Audio Wizard => ValidateTrackAndAnalysis: No analysis data for track index " << trackIndex;
+		return false;
+	}
+
 	track = tracks[trackIndex];
 	return true;
 }
@@ -20,18 +20,30 @@
 #pragma region Audio Wizard Main
 class AudioWizardMain {
 public:
+	// * TYPE ALIASES * //
+	using WaveformPreparation = AudioWizardMainFullTrack::WaveformPreparation;
+
 	// * PUBLIC API - FULL-TRACK ANALYSIS CALLBACKS SETUP * //
 	struct Callbacks {
 		VARIANT fullTrackAnalysisCallback;
 		VARIANT fullTrackWaveformCallback;
+		VARIANT fullTrackCombinedCallback;
+		VARIANT waveformProgressCallback;
+		VARIANT fullTrackResultCallback;
 
 		Callbacks() {
 			VariantInit(&fullTrackAnalysisCallback);
 			VariantInit(&fullTrackWaveformCallback);
+			VariantInit(&fullTrackCombinedCallback);
+			VariantInit(&waveformProgressCallback);
+			VariantInit(&fullTrackResultCallback);
 		}
 		~Callbacks() {
 			VariantClear(&fullTrackAnalysisCallback);
 			VariantClear(&fullTrackWaveformCallback);
+			VariantClear(&fullTrackCombinedCallback);
+			VariantClear(&waveformProgressCallback);
+			VariantClear(&fullTrackResultCallback);
 		}
 	}; Callbacks callbacks;
 
@@ -51,18 +63,26 @@ public:
 	// * PUBLIC API - FULL-TRACK ANALYSIS CALLBACKS * //
 	void SetFullTrackAnalysisCallback(const VARIANT* callback);
 	void SetFullTrackWaveformCallback(const VARIANT* callback);
+	void SetFullTrackCombinedCallback(const VARIANT* callback);
+	void SetWaveformProgressCallback(const VARIANT* callback);
+	void SetFullTrackResultCallback(const VARIANT* callback, bool releaseResults);
 
 	// * PUBLIC API - FULL-TRACK ANALYSIS CONTROL * //
-	void StartFullTrackAnalysis(const metadb_handle_list& metadata, int chunkDurationMs);
+	uint32_t StartFullTrackAnalysis(const metadb_handle_list& metadata, int chunkDurationMs, int priority);
 	void StopFullTrackAnalysis();
-	void StartFullTrackWaveform(const metadb_handle_list& metadata, int chunkDurationMs);
+	uint32_t StartFullTrackWaveform(const metadb_handle_list& metadata, const WaveformPreparation& prepareWaveform, int priority);
 	void StopFullTrackWaveform();
+	uint32_t StartFullTrackCombined(const metadb_handle_list& metadata, int chunkDurationMs, const WaveformPreparation& prepareWaveform,
+		int priority
+	);
 	void StopFullTrackAudioProcessor();
 
 	// * PUBLIC API - FULL-TRACK DATA ACCESS * //
 	bool GetFullTrackAnalysis() const;
 	void GetFullTrackMetrics(SAFEARRAY** fullTrackMetrics) const;
+	void GetFullTrackMetricsBatch(const std::vector<LONG>& trackIndices, ULONG metricMask, SAFEARRAY** fullTrackMetrics) const;
 	void GetFullTrackMetricsDataInfo(pfc::string8& json) const;
+	void GetFullTrackStageTimings(pfc::string8& json) const;
 	double GetMomentaryLUFSFull(LONG trackIndex = 0) const;
 	double GetShortTermLUFSFull(LONG trackIndex = 0) const;
 	double GetIntegratedLUFSFull(LONG trackIndex = 0) const;
@@ -86,12 +106,28 @@ public:
 	void StopPeakmeterMonitoring();
 	void StartRawAudioMonitoring(int refreshRateMs, int chunkDurationMs);
 	void StopRawAudioMonitoring();
+	bool StartSharedAudioRing(const std::string& name, uint32_t capacityFrames, int refreshRateMs, int chunkDurationMs);
+	void StopSharedAudioRing();
+	void StartSpectrumMonitoring(int bins, bool logBinning, double smoothing, double peakDecay);
+	void StopSpectrumMonitoring();
+	void SetRealTimeCpuBudget(double percent);
 	void StopRealTimeAudioProcessor();
 
 	// * PUBLIC API - REAL-TIME DATA ACCESS * //
 	void GetRawAudioData(SAFEARRAY** data) const;
+	void GetRealTimeMetricsSnapshot(SAFEARRAY** snapshot) const;
+	void GetRealTimeMetricsDataInfo(pfc::string8& json) const;
+	void GetRealTimeStageTimings(pfc::string8& json) const;
+	void GetRealTimeHistory(uint64_t since, int resolutionMs, SAFEARRAY** history) const;
+	void GetSpectrumData(SAFEARRAY** data) const;
+	void GetSpectrumDataInfo(pfc::string8& json) const;
+	int GetRealTimeQualityTier() const;
+	void GetChannelRMS(SAFEARRAY** data) const;
+	void GetChannelSamplePeaks(SAFEARRAY** data) const;
+	void GetChannelTruePeaks(SAFEARRAY** data) const;
 	void GetMomentaryLUFS(double* value) const;
 	void GetShortTermLUFS(double* value) const;
+	void GetIntegratedLUFS(double* value) const;
 	void GetRMS(double* value) const;
 	void GetLeftRMS(double* value) const;
 	void GetRightRMS(double* value) const;
@@ -108,6 +144,6 @@ public:
 
 private:
 	bool IsFullTrackSelected(metadb_handle_ptr& track) const;
-	bool ValidateTrackAndAnalysis(metadb_handle_ptr& track, LONG trackIndex = 0) const;
+	bool ValidateTrackAndAnalysis(metadb_handle_ptr& track, AudioWizardMainFullTrack::FullTrackTablePtr& table, LONG trackIndex = 0) const;
 };
 #pragma endregion
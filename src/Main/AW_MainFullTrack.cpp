@@ -83,14 +83,19 @@ bool AudioWizardMainFullTrack::GetFullTrackAnalysisForDialog(const metadb_handle
 	return !isCanceled && anyResults;
 }
 
+AudioWizardMainFullTrack::FullTrackTablePtr AudioWizardMainFullTrack::GetFullTrackTable() const {
+	std::scoped_lock lock(analysis.tableMutex);
+	return analysis.table;
+}
+
 void AudioWizardMainFullTrack::GetFullTrackMetrics(SAFEARRAY** fullTrackMetrics) const {
 	if (!fullTrackMetrics) {
 		FB2K_console_formatter() << "Audio Wizard => GetFullTrackMetrics: Invalid metrics pointer";
 		return;
 	}
 
-	const auto& tracks = analysis.lastAnalyzedTracks;
-	const size_t numTracks = tracks.get_count();
+	const FullTrackTablePtr table = GetFullTrackTable();
+	const size_t numTracks = table->tracks.get_count();
 	std::vector<float> allMetrics(numTracks * Config::FULL_METRICS_PER_TRACK, -INFINITY);
 
 	if (numTracks == 0) {
@@ -105,15 +110,10 @@ void AudioWizardMainFullTrack::GetFullTrackMetrics(SAFEARRAY** fullTrackMetrics)
 		return;
 	}
 
-	int readIndex = analysis.fullTrackIndex.load(std::memory_order_acquire);
-	if (numTracks != analysis.fullTrackData[readIndex].size()) {
-		FB2K_console_formatter() << "Audio Wizard => GetFullTrackMetrics: Mismatch between analyzed tracks count and data size";
-		*fullTrackMetrics = AWHCOM::CreateSafeArrayFromData(allMetrics.begin(), allMetrics.end(), "GetFullTrackMetrics");
-		return;
-	}
-
 	for (t_size i = 0; i < numTracks; ++i) {
-		const auto& data = *analysis.fullTrackData[readIndex][i];
+		if (!table->trackData[i]) continue; // Released after delivery
+
+		const auto& data = *table->trackData[i];
 		const size_t offset = i * Config::FULL_METRICS_PER_TRACK;
 
 		for (size_t m = 0; m < Config::FULL_METRICS_PER_TRACK; ++m) {
@@ -124,6 +124,70 @@ void AudioWizardMainFullTrack::GetFullTrackMetrics(SAFEARRAY** fullTrackMetrics)
 	*fullTrackMetrics = AWHCOM::CreateSafeArrayFromData(allMetrics.begin(), allMetrics.end(), "GetFullTrackMetrics");
 }
 
+void AudioWizardMainFullTrack::GetFullTrackMetricsBatch(const std::vector<LONG>& trackIndices, ULONG metricMask, SAFEARRAY** fullTrackMetrics) const {
+	if (!fullTrackMetrics) {
+		FB2K_console_formatter() << "Audio Wizard => GetFullTrackMetricsBatch: Invalid metrics pointer";
+		return;
+	}
+
+	// Selected accessors in schema order, an empty mask selects every metric
+	std::array<double (*)(const FullTrackData&), Config::FULL_METRICS_PER_TRACK> accessors = {};
+	size_t numMetrics = 0;
+	for (size_t m = 0; m < Config::FULL_METRICS_PER_TRACK; ++m) {
+		if (metricMask == 0 || (metricMask & (1UL << m)) != 0) {
+			accessors[numMetrics++] = Config::FULL_METRICS[m].accessor;
+		}
+	}
+
+	const FullTrackTablePtr table = GetFullTrackTable();
+	const auto& trackData = table->trackData;
+	const size_t analyzedTracks = table->tracks.get_count();
+	const bool isReady = monitor.isFullTrackMetricsComplete.load(std::memory_order_acquire);
+	const size_t numTracks = trackIndices.empty() ? analyzedTracks : trackIndices.size();
+	const size_t count = numTracks * numMetrics;
+
+	if (!isReady) {
+		FB2K_console_formatter() << "Audio Wizard => GetFullTrackMetricsBatch: Analysis not complete";
+	}
+
+	if (count > std::numeric_limits<ULONG>::max()) {
+		FB2K_console_formatter() << "Audio Wizard => GetFullTrackMetricsBatch: Invalid size (" << count << ")";
+		return;
+	}
+
+	SAFEARRAY* psa = SafeArrayCreateVector(VT_R4, 0, static_cast<ULONG>(count));
+	if (!psa) {
+		FB2K_console_formatter() << "Audio Wizard => GetFullTrackMetricsBatch: Failed to create SAFEARRAY";
+		return;
+	}
+
+	size_t invalidTracks = 0;
+	{
+		// Rows are written straight into the array, one row of numMetrics values per requested track
+		AWHCOM::SafeArrayAccess access(psa);
+		float* out = access.getData();
+
+		for (size_t t = 0; out && t < numTracks; ++t, out += numMetrics) {
+			const LONG index = trackIndices.empty() ? static_cast<LONG>(t) : trackIndices[t];
+
+			if (!isReady || index < 0 || static_cast<size_t>(index) >= trackData.size() || !trackData[index]) {
+				std::fill_n(out, numMetrics, -INFINITY);
+				++invalidTracks;
+				continue;
+			}
+
+			const auto& data = *trackData[index];
+			for (size_t m = 0; m < numMetrics; ++m) {
+				out[m] = static_cast<float>(accessors[m](data));
+			}
+		}
+	}
+
+	*fullTrackMetrics = psa;
+
+	AWHDebug::DebugLog("GetFullTrackMetricsBatch: ", numTracks, " tracks x ", numMetrics, " metrics, ", invalidTracks, " unavailable");
+}
+
 void AudioWizardMainFullTrack::GetFullTrackMetricsDataInfo(pfc::string8& json) const {
 	std::ostringstream oss;
 
@@ -146,171 +210,331 @@ void AudioWizardMainFullTrack::GetFullTrackMetricsDataInfo(pfc::string8& json) c
 	AWHDebug::DebugLog("GetFullTrackMetricsDataInfo: component info, ", json.get_length(), " bytes");
 }
 
+void AudioWizardMainFullTrack::GetFullTrackStageTimings(pfc::string8& json) const {
+	using StageProfile = AWHPerf::StageProfile;
+
+	const FullTrackTablePtr table = GetFullTrackTable();
+	const auto& trackData = table->trackData;
+	const bool isReady = monitor.isFullTrackMetricsComplete.load(std::memory_order_acquire);
+
+	std::ostringstream oss;
+	oss << "{"
+		<< R"("componentVersion":")" << ::AW_COMPONENT_VERSION << "\","
+		<< "\"stageTimingDataVersion\":" << StageProfile::STAGE_TIMING_DATA_VERSION
+		<< ",\"enabled\":" << (StageProfile::ENABLED ? "true" : "false")
+		<< ",\"ready\":" << (isReady ? "true" : "false") << ","
+		<< "\"stages\":[";
+
+	for (size_t i = 0; i < StageProfile::STAGE_NAMES.size(); ++i) {
+		if (i > 0) oss << ",";
+		oss << "\"" << StageProfile::STAGE_NAMES[i] << "\"";
+	}
+
+	oss << "],\"tracks\":[";
+
+	// Per-track breakdowns in analysis order, summed into the batch total
+	StageProfile total;
+	double totalDuration = 0.0;
+	size_t listedTracks = 0;
+
+	for (size_t t = 0; isReady && t < trackData.size(); ++t) {
+		if (!trackData[t]) continue;
+
+		const auto& data = *trackData[t];
+		const double duration = data.sampleRate > 0.0 ? static_cast<double>(data.profile.frames) / data.sampleRate : 0.0;
+		total.Add(data.profile);
+		totalDuration += duration;
+
+		if (listedTracks++ > 0) oss << ",";
+		oss << "{\"index\":" << t << ",\"durationSec\":" << AWHMath::RoundTo(duration, 3) << ",";
+		data.profile.WriteJsonFields(oss);
+		oss << "}";
+	}
+
+	oss << "],\"total\":{\"durationSec\":" << AWHMath::RoundTo(totalDuration, 3) << ",";
+	total.WriteJsonFields(oss);
+	oss << "}}";
+
+	json = oss.str().c_str();
+
+	AWHDebug::DebugLog("GetFullTrackStageTimings: ", listedTracks, " tracks, ", json.get_length(), " bytes");
+}
+
 void AudioWizardMainFullTrack::SetFullTrackChunkDuration(int chunkDurationMs) {
 	int clampedDuration = std::clamp(chunkDurationMs, Config::MIN_CHUNK_DURATION_MS, Config::MAX_CHUNK_DURATION_MS);
 	monitor.monitorChunkDurationMs.store(clampedDuration, std::memory_order_release);
 	AWHDebug::DebugLog("SetFullTrackChunkDuration: ", clampedDuration, "ms");
 }
 
-void AudioWizardMainFullTrack::StartFullTrackAnalysis(const metadb_handle_list& tracks, int chunkDurationMs) {
-	if (fetcher.isFullTrackFetching.load(std::memory_order_acquire)) {
-		AWHDebug::DebugLog("StartFullTrackAnalysis: Analysis already in progress, skipping.");
-		return;
+uint32_t AudioWizardMainFullTrack::StartFullTrackAnalysis(const metadb_handle_list& tracks, int chunkDurationMs, int priority) {
+	AWHDebug::DebugLog("StartFullTrackAnalysis: Queuing ", tracks.get_count(), " tracks at priority ", priority);
+
+	// The job owns its results, a preempted run resumes where it stopped and only a completed one is published
+	auto table = std::make_shared<FullTrackTable>(tracks);
+	return AudioWizard::Jobs()->SubmitJob(Config::JOB_METRICS, priority, [this, table, chunkDurationMs](const JobContext& job) {
+		return RunFullTrackAnalysisJob(*table, chunkDurationMs, job);
+	}, true);
+}
+
+void AudioWizardMainFullTrack::StopFullTrackAnalysis() {
+	AudioWizard::Jobs()->CancelJobs({ Config::JOB_METRICS, Config::JOB_COMBINED }, true);
+}
+
+uint32_t AudioWizardMainFullTrack::StartFullTrackWaveform(const metadb_handle_list& tracks, const WaveformPreparation& prepareWaveform,
+	int priority) {
+	if (tracks.get_count() == 0) {
+		FB2K_console_formatter() << "Audio Wizard => StartFullTrackWaveform: No tracks provided";
+		AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackWaveformCallback, false);
+		return 0;
 	}
 
-	if (monitor.isFullTrackMetricsActive.load()) {
-		AWHDebug::DebugLog("StartFullTrackAnalysis: Analysis active, stopping and restarting.");
-		StopFullTrackAnalysis();
+	AWHDebug::DebugLog("StartFullTrackWaveform: Queuing ", tracks.get_count(), " tracks at priority ", priority);
+
+	auto table = std::make_shared<FullTrackTable>(tracks);
+	return AudioWizard::Jobs()->SubmitJob(Config::JOB_WAVEFORM, priority, [this, table, prepareWaveform](const JobContext& job) {
+		return RunFullTrackWaveformJob(*table, prepareWaveform, job);
+	}, true);
+}
+
+void AudioWizardMainFullTrack::StopFullTrackWaveform() {
+	AudioWizard::Jobs()->CancelJobs({ Config::JOB_WAVEFORM, Config::JOB_COMBINED }, true);
+}
+
+uint32_t AudioWizardMainFullTrack::StartFullTrackCombined(const metadb_handle_list& tracks, int chunkDurationMs,
+	const WaveformPreparation& prepareWaveform, int priority) {
+	if (tracks.get_count() == 0) {
+		FB2K_console_formatter() << "Audio Wizard => StartFullTrackCombined: No tracks provided";
+		AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackCombinedCallback, false);
+		return 0;
 	}
 
+	AWHDebug::DebugLog("StartFullTrackCombined: Queuing ", tracks.get_count(), " tracks at priority ", priority);
+
+	auto table = std::make_shared<FullTrackTable>(tracks);
+	return AudioWizard::Jobs()->SubmitJob(Config::JOB_COMBINED, priority,
+		[this, table, chunkDurationMs, prepareWaveform](const JobContext& job) {
+			return RunFullTrackCombinedJob(*table, chunkDurationMs, prepareWaveform, job);
+		}, true
+	);
+}
+#pragma endregion
+
+
+/////////////////////////////////
+// * PRIVATE FULL-TRACK JOBS * //
+/////////////////////////////////
+#pragma region Private Full-Track Jobs
+bool AudioWizardMainFullTrack::RunFullTrackAnalysisJob(FullTrackTable& table, int chunkDurationMs, const JobContext& job) {
+	const auto abort = CreateJobAbort(job);
+	const t_size totalTracks = table.tracks.get_count();
+
 	fetcher.isFullTrackFetching.store(true, std::memory_order_release);
 	monitor.isFullTrackMetricsActive.store(true, std::memory_order_release);
+	SetFullTrackChunkDuration(chunkDurationMs);
+	PrepareFullTrackTable(table, true);
 
-	int writeIndex = (analysis.fullTrackIndex.load(std::memory_order_acquire) + 1) % 2;
-	analysis.fullTrackData[writeIndex].clear();
-	analysis.fullTrackData[writeIndex].reserve(tracks.get_count());
-	for (t_size i = 0; i < tracks.get_count(); ++i) {
-		analysis.fullTrackData[writeIndex].emplace_back(std::make_unique<FullTrackData>());
+	// A preempted job resumes at its first undelivered track, tracks run in order so all later ones are undelivered too
+	t_size firstTrack = 0;
+	while (firstTrack < totalTracks && table.IsFinished(firstTrack)) ++firstTrack;
+	if (firstTrack > 0) {
+		AWHDebug::DebugLog("RunFullTrackAnalysisJob: Resuming at track ", firstTrack, " of ", totalTracks);
 	}
-	analysis.fullTrackIndex.store(writeIndex, std::memory_order_release);
-	SetFullTrackChunkDuration(chunkDurationMs);
 
-	fetcher.fullTrackFetcherFuture = std::async(std::launch::async, [this, tracks, writeIndex] {
-		bool success = true;
-		try {
-			abort_callback_impl abort;
-			bool fullTrackMetricsActive = monitor.isFullTrackMetricsActive.load();
+	bool success = true;
+	try {
+		for (t_size i = firstTrack; i < totalTracks; ++i) {
+			FullTrackAudioDecoder(table.tracks[i], *table.trackData[i], nullptr, *abort, true, false);
+			abort->check();
+			DeliverFullTrackResult(table, i, job.GetJobId());
+			job.SetProgress(static_cast<double>(i + 1) / static_cast<double>(totalTracks));
+		}
 
-			for (t_size i = 0; i < tracks.get_count(); ++i) {
-				FullTrackAudioDecoder(tracks[i], *analysis.fullTrackData[writeIndex][i], nullptr, abort, fullTrackMetricsActive, false);
-				abort.check();
-			}
+		PublishFullTrackTable(table);
+		AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackAnalysisCallback, true);
+	}
+	catch (const foobar2000_io::exception_aborted&) {
+		// A preempted job runs again and reports then, a canceled or superseded one reports its failure now
+		const bool isPreempted = job.IsPreempted();
+		AWHDebug::DebugLog("RunFullTrackAnalysisJob: ", isPreempted ? "Preempted, queued again" : "Canceled");
+		if (!isPreempted) AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackAnalysisCallback, false);
+		success = false;
+	}
+	catch (const std::exception& e) {
+		FB2K_console_formatter() << "Audio Wizard => Full-track multi-track analysis failed: " << e.what();
+		AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackAnalysisCallback, false);
+		success = false;
+	}
+	catch (...) {
+		FB2K_console_formatter() << "Audio Wizard => Full-track multi-track analysis failed: unknown exception";
+		AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackAnalysisCallback, false);
+		success = false;
+	}
 
-			if (fullTrackMetricsActive) {
-				analysis.lastAnalyzedTracks = tracks;
-				monitor.isFullTrackMetricsComplete.store(true, std::memory_order_release);
-				AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackAnalysisCallback, true);
-				monitor.isFullTrackMetricsActive.store(false, std::memory_order_release);
-			}
-		}
-		catch (const std::exception& e) {
-			FB2K_console_formatter() << "Audio Wizard => Full-track multi-track analysis failed: " << e.what();
-			monitor.isFullTrackMetricsComplete.store(false, std::memory_order_release);
-			success = false;
-		}
-		catch (...) {
-			FB2K_console_formatter() << "Audio Wizard => Full-track multi-track analysis failed: unknown exception";
-			monitor.isFullTrackMetricsComplete.store(false, std::memory_order_release);
-			success = false;
-		}
-		fetcher.isFullTrackFetching.store(false, std::memory_order_release);
+	monitor.isFullTrackMetricsActive.store(false, std::memory_order_release);
+	fetcher.isFullTrackFetching.store(false, std::memory_order_release);
 
-		if (!success) { // Fire failure for relevant callbacks
-			AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackAnalysisCallback, false);
-		}
-	});
+	return success;
 }
 
-void AudioWizardMainFullTrack::StopFullTrackAnalysis() {
-	if (!monitor.isFullTrackMetricsActive.load()) return;
+bool AudioWizardMainFullTrack::RunFullTrackWaveformJob(FullTrackTable& table, const WaveformPreparation& prepareWaveform,
+	const JobContext& job) {
+	const auto abort = CreateJobAbort(job);
 
-	monitor.isFullTrackMetricsActive.store(false, std::memory_order_release);
+	// The waveform state is reset only now, a queued job never disturbs the results of the one before it
+	const int chunkDurationMs = prepareWaveform(PrepareFullTrackTable(table, false));
 
-	if (fetcher.fullTrackFetcherFuture.valid()) {
-		fetcher.fullTrackFetcherFuture.wait();
-	}
-}
+	fetcher.isFullTrackFetching.store(true, std::memory_order_release);
+	monitor.isFullTrackWaveformActive.store(true, std::memory_order_release);
+	monitor.waveformChunkDurationMs.store(chunkDurationMs, std::memory_order_release);
 
-void AudioWizardMainFullTrack::StartFullTrackWaveform(const metadb_handle_list& tracks, int chunkDurationMs) {
-	if (tracks.get_count() == 0) {
-		FB2K_console_formatter() << "Audio Wizard => StartFullTrackWaveform: No tracks provided";
+	AWHDebug::DebugLog("RunFullTrackWaveformJob: Processing ", table.tracks.get_count(), " tracks at ", chunkDurationMs, "ms chunks");
+
+	bool success = true;
+	try {
+		ProcessFullTrackBatch(table, false, *abort, job);
+		abort->check();
+
+		AudioWizard::Waveform()->CompleteWaveformAnalysis();
+		AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackWaveformCallback, true);
+	}
+	catch (const foobar2000_io::exception_aborted&) {
+		const bool isPreempted = job.IsPreempted();
+		AWHDebug::DebugLog("RunFullTrackWaveformJob: ", isPreempted ? "Preempted, queued again" : "Canceled");
+		AudioWizard::Waveform()->CompleteWaveformAnalysis();
+		if (!isPreempted) AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackWaveformCallback, false);
+		success = false;
+	}
+	catch (const std::exception& e) {
+		FB2K_console_formatter() << "Audio Wizard => Waveform batch failed: " << e.what();
+		AudioWizard::Waveform()->CompleteWaveformAnalysis();
 		AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackWaveformCallback, false);
-		return;
+		success = false;
 	}
-
-	if (monitor.isFullTrackWaveformActive.load()) {
-		AWHDebug::DebugLog("StartFullTrackWaveform: Waveform active, stopping and restarting");
-		StopFullTrackWaveform();
+	catch (...) {
+		FB2K_console_formatter() << "Audio Wizard => Waveform batch failed: unknown exception";
+		AudioWizard::Waveform()->CompleteWaveformAnalysis();
+		AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackWaveformCallback, false);
+		success = false;
 	}
 
-	if (fetcher.isFullTrackFetching.load(std::memory_order_acquire)) {
-		AWHDebug::DebugLog("StartFullTrackWaveform: Fetching already in progress, skipping");
-		return;
-	}
+	monitor.isFullTrackWaveformActive.store(false, std::memory_order_release);
+	fetcher.isFullTrackFetching.store(false, std::memory_order_release);
+
+	return success;
+}
+
+bool AudioWizardMainFullTrack::RunFullTrackCombinedJob(FullTrackTable& table, int chunkDurationMs,
+	const WaveformPreparation& prepareWaveform, const JobContext& job) {
+	const auto abort = CreateJobAbort(job);
+	const int waveformChunkDurationMs = prepareWaveform(PrepareFullTrackTable(table, true));
 
 	fetcher.isFullTrackFetching.store(true, std::memory_order_release);
+	monitor.isFullTrackMetricsActive.store(true, std::memory_order_release);
 	monitor.isFullTrackWaveformActive.store(true, std::memory_order_release);
-	monitor.waveformChunkDurationMs.store(chunkDurationMs, std::memory_order_release);
+	monitor.waveformChunkDurationMs.store(waveformChunkDurationMs, std::memory_order_release);
+	SetFullTrackChunkDuration(chunkDurationMs);
 
-	AWHDebug::DebugLog("StartFullTrackWaveform: Processing ", tracks.get_count(),
-		" tracks at ", chunkDurationMs, "ms chunks");
+	AWHDebug::DebugLog("RunFullTrackCombinedJob: Processing ", table.tracks.get_count(), " tracks for metrics and waveform");
 
-	// Prepare dummy data structures
-	int writeIndex = (analysis.fullTrackIndex.load(std::memory_order_acquire) + 1) % 2;
-	analysis.fullTrackData[writeIndex].clear();
-	analysis.fullTrackData[writeIndex].reserve(tracks.get_count());
-	for (t_size i = 0; i < tracks.get_count(); ++i) {
-		analysis.fullTrackData[writeIndex].emplace_back(std::make_unique<FullTrackData>());
+	bool success = true;
+	try {
+		ProcessFullTrackBatch(table, true, *abort, job);
+		abort->check();
+
+		// Both results are complete before the single callback fires
+		PublishFullTrackTable(table);
+		AudioWizard::Waveform()->CompleteWaveformAnalysis();
+		AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackCombinedCallback, true);
+	}
+	catch (const foobar2000_io::exception_aborted&) {
+		const bool isPreempted = job.IsPreempted();
+		AWHDebug::DebugLog("RunFullTrackCombinedJob: ", isPreempted ? "Preempted, queued again" : "Canceled");
+		AudioWizard::Waveform()->CompleteWaveformAnalysis();
+		if (!isPreempted) AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackCombinedCallback, false);
+		success = false;
+	}
+	catch (const std::exception& e) {
+		FB2K_console_formatter() << "Audio Wizard => Combined batch failed: " << e.what();
+		AudioWizard::Waveform()->CompleteWaveformAnalysis();
+		AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackCombinedCallback, false);
+		success = false;
+	}
+	catch (...) {
+		FB2K_console_formatter() << "Audio Wizard => Combined batch failed: unknown exception";
+		AudioWizard::Waveform()->CompleteWaveformAnalysis();
+		AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackCombinedCallback, false);
+		success = false;
 	}
-	analysis.fullTrackIndex.store(writeIndex, std::memory_order_release);
-	analysis.lastAnalyzedTracks = tracks;
 
-	fetcher.fullTrackFetcherFuture = std::async(std::launch::async, [this, tracks, writeIndex] {
-		bool success = true;
-		try {
-			abort_callback_impl abort;
-			auto* waveform = AudioWizard::Waveform();
-
-			// Process each track sequentially
-			for (t_size i = 0; i < tracks.get_count(); ++i) {
-				if (!monitor.isFullTrackWaveformActive.load(std::memory_order_acquire)) {
-					AWHDebug::DebugLog("StartFullTrackWaveform: Aborted at track ", i);
-					break;
-				}
+	monitor.isFullTrackMetricsActive.store(false, std::memory_order_release);
+	monitor.isFullTrackWaveformActive.store(false, std::memory_order_release);
+	fetcher.isFullTrackFetching.store(false, std::memory_order_release);
 
-				waveform->state.currentTrackIndex.store(i, std::memory_order_release);
+	return success;
+}
 
-				AWHDebug::DebugLog("StartFullTrackWaveform: Processing track ", i, " - ", tracks[i]->get_path());
+bool AudioWizardMainFullTrack::PrepareFullTrackTable(FullTrackTable& table, bool processMetrics) {
+	const bool isResumed = std::exchange(table.isStarted, true);
 
-				// Decode and process this track
-				FullTrackAudioDecoder(tracks[i], *analysis.fullTrackData[writeIndex][i], nullptr, abort, false, true);
-				abort.check();
-			}
+	// Finished tracks keep their results, a track the preempted run left half analyzed starts over
+	for (t_size i = 0; processMetrics && i < table.tracks.get_count(); ++i) {
+		if (table.IsFinished(i)) continue;
 
-			if (monitor.isFullTrackWaveformActive.load(std::memory_order_acquire)) {
-				monitor.isFullTrackMetricsComplete.store(true, std::memory_order_release);
-				AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackWaveformCallback, true, [] {
-					AudioWizard::Waveform()->StopWaveformAnalysis();
-				});
-				monitor.isFullTrackWaveformActive.store(false, std::memory_order_release);
-			}
-		}
-		catch (const std::exception& e) {
-			FB2K_console_formatter() << "Audio Wizard => Waveform batch failed: " << e.what();
-			success = false;
-		}
-		catch (...) {
-			FB2K_console_formatter() << "Audio Wizard => Waveform batch failed: unknown exception";
-			success = false;
-		}
-		fetcher.isFullTrackFetching.store(false, std::memory_order_release);
+		// Ring buffers are allocated up front, so every track is charged before it is decoded
+		table.trackData[i] = std::make_unique<FullTrackData>();
+		AudioWizardAnalysisFullTrack::ProcessFullTrackMemory(*table.trackData[i]);
+	}
 
-		if (!success) {
-			AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackWaveformCallback, false, [] {
-					AudioWizard::Waveform()->StopWaveformAnalysis();
-				});
-			}
-		});
+	return isResumed;
 }
 
-void AudioWizardMainFullTrack::StopFullTrackWaveform() {
-	if (!monitor.isFullTrackWaveformActive.load()) return;
+void AudioWizardMainFullTrack::PublishFullTrackTable(FullTrackTable& table) {
+	// Only a completed job replaces the results the getters read, its workers are done and the rows move into a table
+	// of their own that is never written again. Readers keep the table they took, the replaced one is freed outside the lock.
+	auto published = std::make_shared<FullTrackTable>(table.tracks);
+	published->trackData = std::move(table.trackData);
+	{
+		std::scoped_lock lock(analysis.tableMutex);
+		std::swap(analysis.table, published);
+	}
+	monitor.isFullTrackMetricsComplete.store(true, std::memory_order_release);
+}
 
-	monitor.isFullTrackWaveformActive.store(false, std::memory_order_release);
+void AudioWizardMainFullTrack::DeliverFullTrackResult(FullTrackTable& table, size_t trackIndex, uint32_t jobId) {
+	const auto& callback = AudioWizard::Main()->callbacks.fullTrackResultCallback;
+	auto& data = table.trackData[trackIndex];
+
+	if (callback.vt == VT_DISPATCH && callback.pdispVal != nullptr) {
+		std::array<double, Config::FULL_METRICS_PER_TRACK> metrics = {};
+		for (size_t m = 0; m < Config::FULL_METRICS_PER_TRACK; ++m) {
+			metrics[m] = Config::FULL_METRICS[m].accessor(*data);
+		}
+
+		// The variant takes ownership of the array, same layout as one GetFullTrackMetrics row
+		CComVariant metricsArray;
+		metricsArray.parray = AWHCOM::CreateSafeArrayFromData(metrics.begin(), metrics.end(), "DeliverFullTrackResult");
+		metricsArray.vt = metricsArray.parray ? VT_ARRAY | VT_R4 : VT_EMPTY;
+
+		AWHCOM::FireCallback(callback, {
+			CComVariant(static_cast<LONG>(trackIndex)), metricsArray, CComVariant(static_cast<LONG>(jobId))
+		});
 
-	if (fetcher.fullTrackFetcherFuture.valid()) {
-		fetcher.fullTrackFetcherFuture.wait();
+		// Only the delivered row is kept by the script, the track's analysis state is not needed anymore.
+		// The row belongs to this worker's slot of the job's own table, which no getter reads before it is published.
+		if (monitor.isReleasingDeliveredResults.load(std::memory_order_acquire)) {
+			data.reset();
+		}
 	}
+
+	// A resumed job skips this track, so its event is never sent twice
+	table.trackFinished[trackIndex].store(true, std::memory_order_release);
+}
+
+std::shared_ptr<abort_callback_impl> AudioWizardMainFullTrack::CreateJobAbort(const JobContext& job) {
+	// Canceling or preempting the job aborts the decode at its next abort check, the handler keeps the abort alive
+	auto abort = std::make_shared<abort_callback_impl>();
+	job.SetCancelHandler([abort] { abort->abort(); });
+	return abort;
 }
 #pragma endregion
 
@@ -320,7 +544,7 @@ void AudioWizardMainFullTrack::StopFullTrackWaveform() {
 //////////////////////////////////
 #pragma region Private Audio Processing
 void AudioWizardMainFullTrack::FullTrackAudioDecoder(const metadb_handle_ptr& track, FullTrackData& ftData, FullTrackResults* results,
-	abort_callback& abort, bool processMetrics, bool processWaveform, threaded_process_status* status) const {
+	abort_callback& abort, bool processMetrics, bool processWaveform, threaded_process_status* status, size_t waveformTrackIndex) const {
 
 	service_ptr_t<input_decoder> decoder;
 	service_ptr_t<file> fileHandle;
@@ -336,15 +560,16 @@ void AudioWizardMainFullTrack::FullTrackAudioDecoder(const metadb_handle_ptr& tr
 	double processedDuration = 0.0;
 	double trackDuration = track->get_length();
 
+	bool fullTrackMetricsActive = processMetrics && monitor.isFullTrackMetricsActive.load(std::memory_order_acquire);
+	bool fullTrackWaveformActive = processWaveform && monitor.isFullTrackWaveformActive.load(std::memory_order_acquire);
+
+	// A combined pass keeps the metrics chunk duration, rounded to whole waveform points below
 	int chunkDurationMs = monitor.monitorChunkDurationMs.load(std::memory_order_acquire);
-	if (monitor.isFullTrackWaveformActive.load(std::memory_order_acquire)) {
+	if (monitor.isFullTrackWaveformActive.load(std::memory_order_acquire) && !fullTrackMetricsActive) {
 		chunkDurationMs = monitor.waveformChunkDurationMs.load(std::memory_order_acquire);
 		AWHDebug::DebugLog("FullTrackAudioDecoder: Using waveform-specific duration ", chunkDurationMs, "ms");
 	}
 
-	bool fullTrackMetricsActive = processMetrics && monitor.isFullTrackMetricsActive.load(std::memory_order_acquire);
-	bool fullTrackWaveformActive = processWaveform && monitor.isFullTrackWaveformActive.load(std::memory_order_acquire);
-
 	auto processChunk = [&](t_size framesToProcess) {
 		if (framesToProcess == 0) return;
 
@@ -365,7 +590,7 @@ void AudioWizardMainFullTrack::FullTrackAudioDecoder(const metadb_handle_ptr& tr
 			AudioWizardAnalysisFullTrack::ProcessFullTrackChunk(processData, ftData);
 		}
 		if (fullTrackWaveformActive) {
-			AudioWizard::Waveform()->ProcessWaveformMetrics(processData);
+			AudioWizard::Waveform()->ProcessWaveformMetrics(processData, waveformTrackIndex);
 		}
 	};
 
@@ -383,13 +608,23 @@ void AudioWizardMainFullTrack::FullTrackAudioDecoder(const metadb_handle_ptr& tr
 	}
 
 	audio_chunk_impl chunk;
+	AW_STAGE_TIMER(timer, ftData.profile);
 
 	while (decoder->run(chunk, abort)) {
+		AW_STAGE_LAP(timer, STAGE_DECODE);
+
 		if (channels == 0) {
 			channels = chunk.get_channels();
 			sampleRate = chunk.get_srate();
 			targetFrames = static_cast<t_size>(sampleRate * (chunkDurationMs / 1000.0));
 			if (targetFrames < 1) targetFrames = 1;
+
+			// No waveform point may straddle two chunks, or it would be split into two shorter points
+			if (fullTrackMetricsActive && fullTrackWaveformActive) {
+				const int pointsPerSecond = std::max(1, AudioWizard::Waveform()->state.pointsPerSecond.load(std::memory_order_relaxed));
+				const auto framesPerPoint = std::max<t_size>(1, static_cast<t_size>(sampleRate / pointsPerSecond));
+				targetFrames = (targetFrames + framesPerPoint - 1) / framesPerPoint * framesPerPoint;
+			}
 			audioBuffer.reserve(targetFrames * channels * 2);
 		}
 
@@ -411,19 +646,27 @@ void AudioWizardMainFullTrack::FullTrackAudioDecoder(const metadb_handle_ptr& tr
 
 			abort.check();
 		}
+
+		// Chunk analysis charges its own stages, only the decoder time belongs to this timer
+		AW_STAGE_SKIP(timer);
 	}
 
 	// Drain remainder
 	processChunk(currentFrames);
+	AW_STAGE_SKIP(timer);
 
 	// Final processing
 	if (fullTrackMetricsActive || results) {
 		AudioWizardAnalysisFullTrack::ProcessOriginalBlocks(ftData);
+		AW_STAGE_LAP(timer, STAGE_FINALIZE);
 		AudioWizardAnalysisFullTrack::ProcessDynamicsFactors(ftData);
+		AudioWizardAnalysisFullTrack::ProcessFullTrackMemory(ftData);
+		AW_STAGE_SKIP(timer);
 	}
 
 	if (results) {
 		AudioWizardAnalysisFullTrack::ProcessFullTrackResults(track, ftData, *results);
+		AW_STAGE_LAP(timer, STAGE_FINALIZE);
 		AudioWizardAnalysisFullTrack::ResetFullTrackData(ftData);
 	}
 
@@ -436,60 +679,107 @@ void AudioWizardMainFullTrack::FullTrackAudioProcessor(const metadb_handle_ptr&
 		abort_callback_impl abort;
 		FullTrackAudioDecoder(track, ftData, results, abort, false, false, status);
 	}
-	else { // Processing for external API usage
-		fetcher.isFullTrackFetching.store(true, std::memory_order_release);
-		int writeIndex = (analysis.fullTrackIndex.load(std::memory_order_acquire) + 1) % 2;
-		analysis.fullTrackIndex.store(writeIndex, std::memory_order_release);
-		analysis.fullTrackData[writeIndex].clear();
-		analysis.fullTrackData[writeIndex].emplace_back(std::make_unique<FullTrackData>());
-
-		fetcher.fullTrackFetcherFuture = std::async(std::launch::async, [this, track, writeIndex] {
-			bool success = true;
-			try {
-				abort_callback_impl abort;
-				bool fullTrackMetricsActive = monitor.isFullTrackMetricsActive.load();
-				bool fullTrackWaveformActive = monitor.isFullTrackWaveformActive.load();
-
-				FullTrackAudioDecoder(track, *analysis.fullTrackData[writeIndex][0], nullptr, abort, fullTrackMetricsActive, fullTrackWaveformActive);
-
-				if (fullTrackWaveformActive) {
-					AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackWaveformCallback, true, [] {
-						AudioWizard::Waveform()->StopWaveformAnalysis();
-					});
-					monitor.isFullTrackWaveformActive.store(false, std::memory_order_release);
-				}
+	else { // Processing for external API usage, queued like any other analysis job
+		metadb_handle_list tracks;
+		tracks.add_item(track);
+		StartFullTrackAnalysis(tracks, monitor.monitorChunkDurationMs.load(std::memory_order_acquire),
+			AudioWizardJobs::Config::DEF_PRIORITY
+		);
+	}
+}
 
-				if (fullTrackMetricsActive) {
-					analysis.fullTrackIndex.store(writeIndex, std::memory_order_release);
-					monitor.isFullTrackMetricsComplete.store(true, std::memory_order_release);
-					analysis.lastAnalyzedTrack = track;
-					AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackAnalysisCallback, true);
-					monitor.isFullTrackMetricsActive.store(false, std::memory_order_release);
-				}
-			}
-			catch (const std::exception& e) {
-				FB2K_console_formatter() << "Audio Wizard => Full-track real-time analysis failed: " << e.what();
-				monitor.isFullTrackMetricsComplete.store(false, std::memory_order_release);
-				success = false;
-			}
-			catch (...) {
-				FB2K_console_formatter() << "Audio Wizard => Full-track real-time analysis failed: unknown exception";
-				monitor.isFullTrackMetricsComplete.store(false, std::memory_order_release);
-				success = false;
+void AudioWizardMainFullTrack::FullTrackWaveformWorker(FullTrackTable& table, size_t trackIndex, abort_callback& abort,
+	bool processMetrics, uint32_t jobId) {
+	auto* waveform = AudioWizard::Waveform();
+	const auto& track = table.tracks[trackIndex];
+	const AWHPerf::MemoryAccounting::JobScope memoryJob(jobId); // std::async threads do not inherit the job thread's job
+
+	try {
+		// A track finished before a preemption only needs its waveform again, its result was already delivered
+		const bool isMetricsPending = processMetrics && !table.IsFinished(trackIndex);
+
+		// A warm cache entry replaces the waveform part, the decode still runs when metrics are wanted
+		const bool isCached = waveform->LoadCachedWaveformTrack(trackIndex);
+		if (isCached) {
+			AWHDebug::DebugLog("FullTrackWaveformWorker: Loaded track ", trackIndex, " from cache - ", track->get_path());
+			if (!isMetricsPending) {
+				table.trackFinished[trackIndex].store(true, std::memory_order_release);
+				return;
 			}
-			fetcher.isFullTrackFetching.store(false, std::memory_order_release);
+		}
 
-			if (!success) { // Fire failure for relevant callbacks
-				if (monitor.isFullTrackWaveformActive.load()) {
-					AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackWaveformCallback, false, [] {
-						AudioWizard::Waveform()->StopWaveformAnalysis();
-					});
-				}
-				if (monitor.isFullTrackMetricsActive.load()) {
-					AWHCOM::FireCallback(AudioWizard::Main()->callbacks.fullTrackAnalysisCallback, false);
+		AWHDebug::DebugLog("FullTrackWaveformWorker: Processing track ", trackIndex, " - ", track->get_path());
+
+		// One decode feeds both the full-track metrics and the waveform from the same ChunkData
+		auto waveformOnlyData = isMetricsPending ? nullptr : std::make_unique<FullTrackData>();
+		FullTrackAudioDecoder(track, isMetricsPending ? *table.trackData[trackIndex] : *waveformOnlyData, nullptr, abort,
+			isMetricsPending, !isCached, nullptr, trackIndex
+		);
+		if (!isCached) {
+			waveform->FinalizeWaveformTrack(trackIndex);
+		}
+		if (abort.is_aborting()) return;
+
+		if (isMetricsPending) {
+			DeliverFullTrackResult(table, trackIndex, jobId);
+		}
+		else {
+			table.trackFinished[trackIndex].store(true, std::memory_order_release);
+		}
+	}
+	catch (const foobar2000_io::exception_aborted&) {
+		AWHDebug::DebugLog("FullTrackWaveformWorker: Aborted track ", trackIndex);
+	}
+	catch (const std::exception& e) {
+		FB2K_console_formatter() << "Audio Wizard => Waveform failed for track (skipping): " << track->get_path() << " - " << e.what();
+	}
+}
+
+void AudioWizardMainFullTrack::ProcessFullTrackBatch(FullTrackTable& table, bool processMetrics, abort_callback& abort,
+	const JobContext& job) {
+	std::deque<std::future<void>> activeFutures;
+	t_size nextTrack = 0;
+	t_size completedTracks = 0;
+	const t_size totalTracks = table.tracks.get_count();
+
+	// One core is left to playback and the UI, waveform batches run in the background
+	const t_size numProcessors = std::thread::hardware_concurrency();
+	const t_size maxConcurrent = std::max(t_size{ 1 }, numProcessors - (numProcessors > 1 ? 1 : 0));
+
+	// Each worker owns one track slot, so tracks are decoded in parallel without sharing state
+	while ((nextTrack < totalTracks && !abort.is_aborting()) || !activeFutures.empty()) {
+		// A resumed job skips the tracks its earlier run finished, as long as their waveform is still in the active table
+		if (nextTrack < totalTracks && !abort.is_aborting() && table.IsFinished(nextTrack) &&
+			AudioWizard::Waveform()->IsActiveWaveformTrackPublished(nextTrack)) {
+			job.SetProgress(static_cast<double>(++completedTracks) / static_cast<double>(totalTracks));
+			++nextTrack;
+			continue;
+		}
+
+		if (activeFutures.size() < maxConcurrent && nextTrack < totalTracks && !abort.is_aborting()) {
+			activeFutures.emplace_back(std::async(std::launch::async,
+				[this, &table, nextTrack, processMetrics, &abort, jobId = job.GetJobId()] {
+					FullTrackWaveformWorker(table, nextTrack, abort, processMetrics, jobId);
 				}
+			));
+			++nextTrack;
+			continue;
+		}
+
+		for (auto it = activeFutures.begin(); it != activeFutures.end(); ) {
+			if (it->wait_for(std::chrono::milliseconds(10)) == std::future_status::ready) {
+				it->get();
+				it = activeFutures.erase(it);
+				job.SetProgress(static_cast<double>(++completedTracks) / static_cast<double>(totalTracks));
 			}
-		});
+			else {
+				++it;
+			}
+		}
+	}
+
+	if (abort.is_aborting()) {
+		AWHDebug::DebugLog("ProcessFullTrackBatch: Aborted after ", completedTracks, " of ", totalTracks, " tracks");
 	}
 }
 #pragma endregion
@@ -22,11 +22,14 @@ public:
 	using ChunkData = AWHAudioData::ChunkData;
 	using FullTrackResults = AudioWizardAnalysisFullTrack::FullTrackResults;
 	using FullTrackData = AudioWizardAnalysisFullTrack::FullTrackData;
+	using JobContext = AudioWizardJobs::JobContext;
+	using WaveformPreparation = std::function<int(bool isResumed)>; // Resets or resumes the waveform state when the job runs, returns the waveform chunk duration in ms
 
 	// * MAIN CONFIG * //
 	struct Config {
 		static constexpr int FULL_METRICS_DATA_VERSION = 1; // NOTE: bump whenever FULL_METRICS_PER_TRACK or FULL_METRIC_NAMES changes.
 		static constexpr size_t FULL_METRICS_PER_TRACK = 12; // M LUFS, S LUFS, I LUFS, RMS, SP, TP, PSR, PLR, CF, LRA, DR, PD
+		static constexpr ULONG FULL_METRICS_MASK_ALL = (1UL << FULL_METRICS_PER_TRACK) - 1; // Bit n selects FULL_METRICS[n]
 
 		struct MetricEntry {
 			std::string_view name;
@@ -50,6 +53,10 @@ public:
 		static constexpr int DEF_CHUNK_DURATION_MS = 200;
 		static constexpr int MIN_CHUNK_DURATION_MS = 10;
 		static constexpr int MAX_CHUNK_DURATION_MS = 1000;
+
+		static constexpr std::string_view JOB_METRICS = "metrics";
+		static constexpr std::string_view JOB_WAVEFORM = "waveform";
+		static constexpr std::string_view JOB_COMBINED = "combined";
 	};
 
 	// * ANALYSIS RESULT * //
@@ -58,15 +65,28 @@ public:
 		std::vector<FullTrackResults> results;
 	};
 
+	// * FULL-TRACK TABLE * //
+	struct FullTrackTable { // The tracks and results of one analysis job, owned by the job and published once it completes
+		metadb_handle_list tracks;
+		std::vector<std::unique_ptr<FullTrackData>> trackData; // Index-stable, each slot is written by one worker only
+		std::vector<std::atomic<bool>> trackFinished;          // Set once a track's result is final and delivered, a resumed job skips it
+		bool isStarted = false;                                // Set by the first run, a preempted job resumes on its next run
+
+		explicit FullTrackTable(const metadb_handle_list& tracks) :
+			tracks(tracks), trackData(tracks.get_count()), trackFinished(tracks.get_count()) {}
+
+		bool IsFinished(size_t trackIndex) const {
+			return trackIndex < trackFinished.size() && trackFinished[trackIndex].load(std::memory_order_acquire);
+		}
+	};
+	using FullTrackTablePtr = std::shared_ptr<FullTrackTable>;
+
 	// * ANALYSIS STATE * //
 	struct AnalysisState {
 		metadb_handle_ptr lastAnalyzedTrack = nullptr;
-		metadb_handle_list lastAnalyzedTracks;
-		std::vector<std::vector<std::unique_ptr<FullTrackData>>> fullTrackData;
 		std::atomic<bool> isBatchProcessing = false;
-		std::atomic<int> fullTrackIndex = 0;
-		std::atomic<int> writeIndex = 0;
-		AnalysisState() { fullTrackData.resize(2); }
+		mutable std::mutex tableMutex; // Guards the pointer only, never held while a table is read
+		FullTrackTablePtr table = std::make_shared<FullTrackTable>(metadb_handle_list()); // The last completed job, read by the API and never written again
 	}; AnalysisState analysis;
 
 	// * MONITORING STATE * //
@@ -74,14 +94,14 @@ public:
 		std::atomic<bool> isFullTrackMetricsComplete = false;
 		std::atomic<bool> isFullTrackMetricsActive = false;
 		std::atomic<bool> isFullTrackWaveformActive = false;
+		std::atomic<bool> isReleasingDeliveredResults = false;
 		std::atomic<int> monitorChunkDurationMs = Config::DEF_CHUNK_DURATION_MS;
 		std::atomic<int> waveformChunkDurationMs = Config::MAX_CHUNK_DURATION_MS;
 	}; MonitorState monitor;
 
 	// * FETCHER STATE * //
 	struct FetcherState {
-		std::atomic<bool> isFullTrackFetching = false;
-		std::future<void> fullTrackFetcherFuture;
+		std::atomic<bool> isFullTrackFetching = false; // Set while a full-track job runs or the analysis dialog is open
 	}; FetcherState fetcher;
 
 	// * CONSTRUCTOR & DESTRUCTOR * //
@@ -90,20 +110,40 @@ public:
 
 	// * PUBLIC PROCESSING CONTROL * //
 	bool GetFullTrackAnalysisForDialog(const metadb_handle_list& tracks);
+	FullTrackTablePtr GetFullTrackTable() const;
 	void GetFullTrackMetrics(SAFEARRAY** fullTrackMetrics) const;
+	void GetFullTrackMetricsBatch(const std::vector<LONG>& trackIndices, ULONG metricMask, SAFEARRAY** fullTrackMetrics) const;
 	void GetFullTrackMetricsDataInfo(pfc::string8& json) const;
+	void GetFullTrackStageTimings(pfc::string8& json) const;
 	void SetFullTrackChunkDuration(int chunkDurationMs);
-	void StartFullTrackAnalysis(const metadb_handle_list& tracks, int chunkDurationMs);
+	uint32_t StartFullTrackAnalysis(const metadb_handle_list& tracks, int chunkDurationMs, int priority);
 	void StopFullTrackAnalysis();
-	void StartFullTrackWaveform(const metadb_handle_list& tracks, int chunkDurationMs);
+	uint32_t StartFullTrackWaveform(const metadb_handle_list& tracks, const WaveformPreparation& prepareWaveform, int priority);
 	void StopFullTrackWaveform();
+	uint32_t StartFullTrackCombined(const metadb_handle_list& tracks, int chunkDurationMs, const WaveformPreparation& prepareWaveform,
+		int priority
+	);
 
 private:
+	// * PRIVATE FULL-TRACK JOBS * //
+	bool RunFullTrackAnalysisJob(FullTrackTable& table, int chunkDurationMs, const JobContext& job);
+	bool RunFullTrackWaveformJob(FullTrackTable& table, const WaveformPreparation& prepareWaveform, const JobContext& job);
+	bool RunFullTrackCombinedJob(FullTrackTable& table, int chunkDurationMs, const WaveformPreparation& prepareWaveform,
+		const JobContext& job
+	);
+	static bool PrepareFullTrackTable(FullTrackTable& table, bool processMetrics);
+	void PublishFullTrackTable(FullTrackTable& table);
+	void DeliverFullTrackResult(FullTrackTable& table, size_t trackIndex, uint32_t jobId);
+	static std::shared_ptr<abort_callback_impl> CreateJobAbort(const JobContext& job);
+
 	// * PRIVATE AUDIO PROCESSING * //
 	void FullTrackAudioDecoder(const metadb_handle_ptr& track, FullTrackData& ftData, FullTrackResults* results,
-		abort_callback& abort, bool processMetrics = false, bool processWaveform = false, threaded_process_status* status = nullptr
+		abort_callback& abort, bool processMetrics = false, bool processWaveform = false, threaded_process_status* status = nullptr,
+		size_t waveformTrackIndex = 0
 	) const;
 	void FullTrackAudioProcessor(const metadb_handle_ptr& track, FullTrackResults* results = nullptr, threaded_process_status* status = nullptr);
+	void FullTrackWaveformWorker(FullTrackTable& table, size_t trackIndex, abort_callback& abort, bool processMetrics, uint32_t jobId);
+	void ProcessFullTrackBatch(FullTrackTable& table, bool processMetrics, abort_callback& abort, const JobContext& job);
 
 	// * PRIVATE AUDIO PROCESSING ANALYSIS DIALOG * //
 	void ProcessFullTracksForDialog(const metadb_handle_list& tracks, abort_callback const& abort,
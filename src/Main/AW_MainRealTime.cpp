@@ -32,21 +32,18 @@ AudioWizardMainRealTime::~AudioWizardMainRealTime() {
 ///////////////////////////////////
 #pragma region Public Processing Control
 void AudioWizardMainRealTime::ResetMetrics() {
-	metrics.momentaryLUFS = -INFINITY;
-	metrics.shortTermLUFS = -INFINITY;
-	metrics.leftRMS = -INFINITY;
-	metrics.rightRMS = -INFINITY;
-	metrics.leftSamplePeak = -INFINITY;
-	metrics.rightSamplePeak = -INFINITY;
-	metrics.truePeak = -INFINITY;
-	metrics.RMS = -INFINITY;
-	metrics.PSR = -INFINITY;
-	metrics.PLR = -INFINITY;
-	metrics.DR = -INFINITY;
-	metrics.PD = -INFINITY;
-	metrics.crestFactor = -INFINITY;
-	metrics.phaseCorrelation = -INFINITY;
-	metrics.stereoWidth = -INFINITY;
+	BeginMetricsUpdate();
+	for (const auto& entry : REAL_TIME_METRICS) {
+		(metrics.*entry.field).store(-INFINITY, std::memory_order_relaxed);
+	}
+	metrics.channelCount.store(0, std::memory_order_relaxed);
+	EndMetricsUpdate();
+	ResetTrackMetrics();
+}
+
+void AudioWizardMainRealTime::ResetTrackMetrics() {
+	// Deferred to the real-time thread, which owns the analysis state
+	monitor.isTrackResetPending.store(true, std::memory_order_release);
 }
 
 void AudioWizardMainRealTime::SetMonitoringChunkDuration(int chunkDurationMs) {
@@ -70,6 +67,10 @@ void AudioWizardMainRealTime::StartRealTimeMonitoring(int refreshRateMs, int chu
 	if (monitor.isRealTimeActive.load()) return;
 
 	analysis.realTimeData = AudioWizardAnalysisRealTime::RealTimeData();
+	{
+		std::scoped_lock lock(stageTiming.mutex);
+		stageTiming.snapshot = AWHPerf::StageProfile();
+	}
 
 	monitor.wasPeakmeterActiveBefore.store(monitor.isPeakmeterActive.load(), std::memory_order_release);
 	monitor.isRealTimeActive.store(true, std::memory_order_release);
@@ -148,18 +149,324 @@ void AudioWizardMainRealTime::GetRawAudioData(SAFEARRAY** data) const {
 		return;
 	}
 
-	size_t sample_count = rawAudioData->buffer.capacity();
-	std::vector<audioType> temp(sample_count);
+	// Read the latest published slot in place, the SAFEARRAY fill is the only copy
 	size_t read_count = 0;
-	bool has_data = rawAudioData->buffer.read(temp.data(), sample_count, &read_count);
+	const audioType* samples = rawAudioData->buffer.acquire(&read_count);
 
-	if (has_data && read_count > 0) {
-		*data = AWHCOM::CreateSafeArrayFromData(temp.begin(), temp.begin() + read_count, "GetRawAudioData");
+	if (read_count > 0) {
+		*data = AWHCOM::CreateSafeArrayFromData(samples, samples + read_count, "GetRawAudioData");
 	}
 	else {
 		*data = AWHCOM::CreateSafeArrayFromData(0, 0.0f, "GetRawAudioData"); // Empty array
 	}
 }
+
+bool AudioWizardMainRealTime::StartSharedAudioRing(const std::string& name, uint32_t capacityFrames, int refreshRateMs, int chunkDurationMs) {
+	{
+		std::scoped_lock lock(sharedRing.mutex);
+
+		if (sharedRing.ring.IsOpen() && sharedRing.ring.GetName() == name) {
+			return true;
+		}
+
+		sharedRing.ring.Close();
+
+		if (!sharedRing.ring.Create(name, capacityFrames)) {
+			monitor.isSharedRingActive.store(false, std::memory_order_release);
+			FB2K_console_formatter() << "Audio Wizard => StartSharedAudioRing: Could not create shared memory ring \"" << name.c_str() << "\"";
+			return false;
+		}
+	}
+
+	monitor.isSharedRingActive.store(true, std::memory_order_release);
+	SetMonitoringRefreshRate(refreshRateMs);
+	SetMonitoringChunkDuration(chunkDurationMs);
+
+	StartRealTimeAudioProcessor(refreshRateMs);
+	return true;
+}
+
+void AudioWizardMainRealTime::StopSharedAudioRing() {
+	if (!monitor.isSharedRingActive.load()) return;
+
+	monitor.isSharedRingActive.store(false, std::memory_order_release);
+	{
+		std::scoped_lock lock(sharedRing.mutex);
+		sharedRing.ring.Close();
+	}
+
+	if (!IsRealTimeAudioProcessorActive()) {
+		StopRealTimeAudioProcessor();
+	}
+}
+
+uint64_t AudioWizardMainRealTime::GetMetricsSnapshot(MetricsSnapshot& snapshot) const {
+	// Seqlock read side - retry until a copy is taken between two identical even sequence values
+	while (true) {
+		const uint64_t sequence = metrics.version.load(std::memory_order_acquire);
+
+		if (sequence & 1) {
+			std::this_thread::yield();
+			continue;
+		}
+
+		for (size_t i = 0; i < REAL_TIME_METRICS.size(); ++i) {
+			snapshot[i] = (metrics.*REAL_TIME_METRICS[i].field).load(std::memory_order_relaxed);
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if (metrics.version.load(std::memory_order_relaxed) == sequence) {
+			return sequence / 2;
+		}
+	}
+}
+
+void AudioWizardMainRealTime::GetRealTimeMetricsSnapshot(SAFEARRAY** snapshot) const {
+	if (!snapshot) {
+		FB2K_console_formatter() << "Audio Wizard => GetRealTimeMetricsSnapshot: Invalid output parameter";
+		return;
+	}
+
+	MetricsSnapshot values;
+	const uint64_t version = GetMetricsSnapshot(values);
+
+	// Element 0 carries the publish counter, wrapped to stay exact in a float
+	std::array<float, Config::REAL_TIME_METRICS_COUNT + 1> data;
+	data[0] = static_cast<float>(version & 0xFFFFFF);
+	for (size_t i = 0; i < values.size(); ++i) {
+		data[i + 1] = static_cast<float>(values[i]);
+	}
+
+	*snapshot = AWHCOM::CreateSafeArrayFromData(data.begin(), data.end(), "GetRealTimeMetricsSnapshot");
+}
+
+void AudioWizardMainRealTime::GetRealTimeMetricsDataInfo(pfc::string8& json) const {
+	std::ostringstream oss;
+
+	oss << "{"
+		<< R"("componentVersion":")" << ::AW_COMPONENT_VERSION << "\","
+		<< "\"realTimeMetricsDataVersion\":" << Config::REAL_TIME_METRICS_DATA_VERSION
+		<< ",\"metricsCount\":" << Config::REAL_TIME_METRICS_COUNT << ","
+		<< "\"metrics\":[";
+
+	for (size_t i = 0; i < REAL_TIME_METRICS.size(); ++i) {
+		if (i > 0) oss << ",";
+		oss << "\"" << REAL_TIME_METRICS[i].name << "\"";
+	}
+
+	oss << "]"
+		<< "}";
+
+	json = oss.str().c_str();
+
+	AWHDebug::DebugLog("GetRealTimeMetricsDataInfo: component info, ", json.get_length(), " bytes");
+}
+
+void AudioWizardMainRealTime::GetRealTimeStageTimings(pfc::string8& json) const {
+	using StageProfile = AWHPerf::StageProfile;
+
+	StageProfile profile;
+	{
+		std::scoped_lock lock(stageTiming.mutex);
+		profile = stageTiming.snapshot;
+	}
+
+	std::ostringstream oss;
+	oss << "{"
+		<< R"("componentVersion":")" << ::AW_COMPONENT_VERSION << "\","
+		<< "\"stageTimingDataVersion\":" << StageProfile::STAGE_TIMING_DATA_VERSION
+		<< ",\"enabled\":" << (StageProfile::ENABLED ? "true" : "false")
+		<< ",\"active\":" << (monitor.isRealTimeActive.load(std::memory_order_acquire) ? "true" : "false") << ","
+		<< "\"stages\":[";
+
+	for (size_t i = 0; i < StageProfile::STAGE_NAMES.size(); ++i) {
+		if (i > 0) oss << ",";
+		oss << "\"" << StageProfile::STAGE_NAMES[i] << "\"";
+	}
+
+	oss << "],";
+	profile.WriteJsonFields(oss);
+	oss << "}";
+
+	json = oss.str().c_str();
+
+	AWHDebug::DebugLog("GetRealTimeStageTimings: ", profile.chunks, " chunks, ", json.get_length(), " bytes");
+}
+
+void AudioWizardMainRealTime::GetRealTimeHistory(uint64_t since, int resolutionMs, SAFEARRAY** data) const {
+	if (!data) {
+		FB2K_console_formatter() << "Audio Wizard => GetRealTimeHistory: Invalid output parameter";
+		return;
+	}
+
+	const auto& resolutions = Config::HISTORY_RESOLUTIONS_MS;
+	const auto it = std::find(resolutions.begin(), resolutions.end(), resolutionMs);
+
+	if (it == resolutions.end()) {
+		FB2K_console_formatter() << "Audio Wizard => GetRealTimeHistory: Invalid resolution (" << resolutionMs << " ms)";
+		*data = SafeArrayCreateVector(VT_R8, 0, 0); // Empty array
+		return;
+	}
+
+	const auto& tier = history.tiers[static_cast<size_t>(std::distance(resolutions.begin(), it))];
+	std::vector<HistoryEntry> entries;
+	entries.reserve(tier.capacity); // Allocated up front, the copy below must stay short
+	uint64_t first = 0;
+
+	// Seqlock read side - copy the entries and retry if the real-time thread wrote meanwhile, it never waits for us
+	while (true) {
+		const uint64_t version = history.version.load(std::memory_order_acquire);
+		if (version & 1) {
+			std::this_thread::yield();
+			continue;
+		}
+
+		const uint64_t capacity = tier.capacity;
+		const uint64_t last = tier.sequence.load(std::memory_order_relaxed);
+		const uint64_t oldest = std::max(tier.firstSequence.load(std::memory_order_relaxed), last > capacity ? last - capacity + 1 : 1);
+		first = std::max(since + 1, oldest);
+		entries.clear();
+
+		for (uint64_t sequence = first; sequence <= last; ++sequence) {
+			const auto& slot = tier.slots[static_cast<size_t>((sequence - 1) % capacity)];
+			entries.push_back({
+				slot.momentaryLUFS.load(std::memory_order_relaxed),
+				slot.shortTermLUFS.load(std::memory_order_relaxed),
+				slot.peak.load(std::memory_order_relaxed)
+			});
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (history.version.load(std::memory_order_relaxed) == version) break;
+	}
+
+	// Doubles, so sequence numbers stay exact past 2^24 (about 19 days of 100 ms entries)
+	const size_t count = entries.size() * Config::HISTORY_VALUES_PER_ENTRY;
+	SAFEARRAY* psa = SafeArrayCreateVector(VT_R8, 0, static_cast<ULONG>(count));
+	if (!psa) {
+		FB2K_console_formatter() << "Audio Wizard => GetRealTimeHistory: Failed to create SAFEARRAY";
+		*data = nullptr;
+		return;
+	}
+
+	void* out = nullptr;
+	HRESULT hr = SafeArrayAccessData(psa, &out);
+	if (FAILED(hr)) {
+		FB2K_console_formatter() << "Audio Wizard => GetRealTimeHistory: SafeArrayAccessData failed: " << hr;
+		SafeArrayDestroy(psa);
+		*data = nullptr;
+		return;
+	}
+
+	auto* values = static_cast<double*>(out);
+	for (size_t i = 0; i < entries.size(); ++i) {
+		*values++ = static_cast<double>(first + i);
+		*values++ = entries[i].momentaryLUFS;
+		*values++ = entries[i].shortTermLUFS;
+		*values++ = entries[i].peak;
+	}
+
+	SafeArrayUnaccessData(psa);
+	*data = psa;
+}
+
+bool AudioWizardMainRealTime::IsValidHistoryResolution(int resolutionMs) {
+	const auto& resolutions = Config::HISTORY_RESOLUTIONS_MS;
+	return std::find(resolutions.begin(), resolutions.end(), resolutionMs) != resolutions.end();
+}
+
+void AudioWizardMainRealTime::StartSpectrumMonitoring(int bins, bool logBinning, double smoothing, double peakDecay) {
+	spectrum.bins.store(std::clamp(bins, Config::MIN_SPECTRUM_BINS, Config::MAX_SPECTRUM_BINS), std::memory_order_release);
+	spectrum.logBinning.store(logBinning, std::memory_order_release);
+	spectrum.smoothing.store(std::clamp(smoothing, 0.0, Config::MAX_SPECTRUM_SMOOTHING), std::memory_order_release);
+	spectrum.peakDecay.store(std::max(peakDecay, 0.0), std::memory_order_release);
+	spectrum.isSpectrumActive.store(true, std::memory_order_release);
+}
+
+void AudioWizardMainRealTime::StopSpectrumMonitoring() {
+	spectrum.isSpectrumActive.store(false, std::memory_order_release);
+}
+
+void AudioWizardMainRealTime::GetSpectrumData(SAFEARRAY** data) {
+	if (!data) {
+		FB2K_console_formatter() << "Audio Wizard => GetSpectrumData: Invalid output parameter";
+		return;
+	}
+
+	size_t count = 0;
+	const float* values = spectrum.isSpectrumActive.load(std::memory_order_acquire)
+		? spectrum.output.acquire(&count) : nullptr;
+
+	if (!values || count == 0) {
+		*data = AWHCOM::CreateSafeArrayFromData(0, 0.0f, "GetSpectrumData"); // Empty array
+		return;
+	}
+
+	*data = AWHCOM::CreateSafeArrayFromData(values, values + count, "GetSpectrumData");
+}
+
+void AudioWizardMainRealTime::GetSpectrumDataInfo(pfc::string8& json) const {
+	const int bins = spectrum.bins.load(std::memory_order_acquire);
+	const bool logBinning = spectrum.logBinning.load(std::memory_order_acquire);
+	const double sampleRate = spectrum.sampleRate.load(std::memory_order_acquire);
+	std::ostringstream oss;
+
+	oss << "{"
+		<< R"("componentVersion":")" << ::AW_COMPONENT_VERSION << "\","
+		<< "\"spectrumDataVersion\":" << Config::SPECTRUM_DATA_VERSION
+		<< ",\"bins\":" << bins
+		<< ",\"barkBands\":" << AWHAudioFFT::BARK_BAND_NUMBER
+		<< ",\"logBinning\":" << (logBinning ? "true" : "false")
+		<< ",\"sampleRate\":" << sampleRate << ","
+		<< "\"frequencies\":[";
+
+	// Bin centers are only known once the real-time thread has seen the stream's sample rate
+	if (sampleRate > 0.0) {
+		const double nyquist = sampleRate / 2.0;
+		for (size_t b = 0; b < static_cast<size_t>(bins); ++b) {
+			const double low = GetSpectrumBinEdge(b, bins, logBinning, nyquist);
+			const double high = GetSpectrumBinEdge(b + 1, bins, logBinning, nyquist);
+			if (b > 0) oss << ",";
+			oss << std::lround(logBinning ? std::sqrt(low * high) : (low + high) / 2.0);
+		}
+	}
+
+	oss << "],\"barkFrequencies\":[";
+
+	for (size_t band = 0; band < AWHAudioFFT::BARK_BAND_NUMBER; ++band) {
+		if (band > 0) oss << ",";
+		oss << std::lround(std::sqrt(AWHAudioFFT::BARK_BAND_FREQUENCY_EDGES[band] * AWHAudioFFT::BARK_BAND_FREQUENCY_EDGES[band + 1]));
+	}
+
+	oss << "]"
+		<< "}";
+
+	json = oss.str().c_str();
+
+	AWHDebug::DebugLog("GetSpectrumDataInfo: component info, ", json.get_length(), " bytes");
+}
+
+void AudioWizardMainRealTime::SetCpuBudget(double percent) {
+	governor.SetBudget(percent);
+	AWHDebug::DebugLog("SetCpuBudget: ", governor.GetBudget(), "% of one core");
+}
+
+int AudioWizardMainRealTime::GetQualityTier() const {
+	return governor.GetTier();
+}
+
+void AudioWizardMainRealTime::GetChannelRMS(SAFEARRAY** data) const {
+	GetChannelMetric(&Metrics::channelRMS, data, "GetChannelRMS");
+}
+
+void AudioWizardMainRealTime::GetChannelSamplePeaks(SAFEARRAY** data) const {
+	GetChannelMetric(&Metrics::channelSamplePeaks, data, "GetChannelSamplePeaks");
+}
+
+void AudioWizardMainRealTime::GetChannelTruePeaks(SAFEARRAY** data) const {
+	GetChannelMetric(&Metrics::channelTruePeaks, data, "GetChannelTruePeaks");
+}
 #pragma endregion
 
 
@@ -178,6 +485,10 @@ void AudioWizardMainRealTime::RealTimeAudioProcessor() {
 	auto lastNotify = std::chrono::steady_clock::now();
 	auto nextWakeup = lastNotify;
 
+	// Reused for every fetch, audio_chunk_impl keeps its storage between calls
+	AWHAudioData::Chunk chunk;
+	governor.Reset();
+
 	while (monitor.isFetching.load(std::memory_order_acquire)) {
 		double currTime = 0.0;
 		const int chunkMs = monitor.monitorChunkDurationMs.load(std::memory_order_relaxed);
@@ -207,31 +518,80 @@ void AudioWizardMainRealTime::RealTimeAudioProcessor() {
 			initialized = true;
 		}
 
-		// 4. Sequential Fetching
-		AWHAudioData::Chunk chunk;
+		// 4. Adaptive Batched Fetching - when behind, fetch several chunks in one call and slice them
+		int processedChunks = 0;
 
-		for (int i = 0; i < Config::MAX_CATCHUP_CHUNKS && nextFetchTime < currTime
-			&& monitor.isFetching.load(std::memory_order_relaxed); ++i) {
+		while (processedChunks < Config::MAX_CATCHUP_CHUNKS && nextFetchTime < currTime
+			&& monitor.isFetching.load(std::memory_order_relaxed)) {
 
-			if (!visStream->get_chunk_absolute(*chunk.chunk, nextFetchTime, chunkDurationSec)) {
+			const auto chunksBehind = static_cast<int>((currTime - nextFetchTime) / chunkDurationSec);
+			const int batchChunks = std::clamp(chunksBehind, 1, Config::MAX_BATCH_CHUNKS);
+			const double batchDurationSec = chunkDurationSec * batchChunks;
+
+			AW_STAGE_TIMER(fetchTimer, analysis.realTimeData.profile);
+			if (!visStream->get_chunk_absolute(*chunk.chunk, nextFetchTime, batchDurationSec)) {
 				break;
 			}
+			if (monitor.isRealTimeActive) AW_STAGE_LAP(fetchTimer, STAGE_DECODE);
 
 			chunk.metadata.timestamp.store(nextFetchTime, std::memory_order_release);
-			ChunkData data(*chunk.chunk);
+			const ChunkData batch(*chunk.chunk);
 
-			if (monitor.isRawAudioDataActive) ProcessRawAudioDataCapture(data);
+			// The stream may return less than requested near the end of its buffer, the next fetch starts where this one ended
+			const double fetchedDurationSec = batch.sampleRate > 0.0 ? static_cast<double>(batch.frames) / batch.sampleRate : 0.0;
+			if (fetchedDurationSec <= 0.0) break;
 
-			if (monitor.isRealTimeActive) {
-				ProcessRealTimeMetrics(data);
-				monitor.lastRealtimeUpdate.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_release);
-			}
-			else if (monitor.isPeakmeterActive) {
-				ProcessPeakmeterMetrics(data);
-				monitor.lastMonitoringUpdate.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_release);
+			const size_t sliceFrames = std::max<size_t>(1, static_cast<size_t>(chunkDurationSec * batch.sampleRate + 0.5));
+
+			for (size_t offset = 0; offset < batch.frames; offset += sliceFrames) {
+				ChunkData data;
+				data.data = batch.data + offset * batch.channels;
+				data.channels = batch.channels;
+				data.frames = std::min(sliceFrames, batch.frames - offset);
+				data.sampleRate = batch.sampleRate;
+
+				int64_t stageStart = governor.Now();
+
+				if (monitor.isRawAudioDataActive) {
+					ProcessRawAudioDataCapture(data);
+					const int64_t stageEnd = governor.Now();
+					governor.AddStageCost(AWHPerf::QualityGovernor::STAGE_RAW_AUDIO, stageEnd - stageStart);
+					stageStart = stageEnd;
+				}
+
+				if (monitor.isSharedRingActive) {
+					ProcessSharedRingCapture(data);
+					const int64_t stageEnd = governor.Now();
+					governor.AddStageCost(AWHPerf::QualityGovernor::STAGE_RAW_AUDIO, stageEnd - stageStart);
+					stageStart = stageEnd;
+				}
+
+				if (monitor.isRealTimeActive) {
+					ProcessRealTimeMetrics(data);
+					governor.AddStageCost(AWHPerf::QualityGovernor::STAGE_ANALYSIS, governor.Now() - stageStart);
+				}
+				else if (monitor.isPeakmeterActive) {
+					ProcessPeakmeterMetrics(data);
+					governor.AddStageCost(AWHPerf::QualityGovernor::STAGE_PEAKMETER, governor.Now() - stageStart);
+				}
+
+				++processedChunks;
 			}
 
-			nextFetchTime += chunkDurationSec;
+			const int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+			if (monitor.isRealTimeActive) monitor.lastRealtimeUpdate.store(now, std::memory_order_release);
+			else if (monitor.isPeakmeterActive) monitor.lastMonitoringUpdate.store(now, std::memory_order_release);
+
+			nextFetchTime += fetchedDurationSec;
+		}
+
+		governor.Evaluate();
+
+		if constexpr (AWHPerf::StageProfile::ENABLED) {
+			if (monitor.isRealTimeActive && processedChunks > 0) {
+				std::scoped_lock lock(stageTiming.mutex);
+				stageTiming.snapshot = analysis.realTimeData.profile;
+			}
 		}
 
 		// 5. UI Notification - only notify UI when new data was actually processed this iteration
@@ -282,7 +642,7 @@ void AudioWizardMainRealTime::StopRealTimeAudioProcessor() {
 }
 
 bool AudioWizardMainRealTime::IsRealTimeAudioProcessorActive() const {
-	return monitor.isPeakmeterActive || monitor.isRealTimeActive || monitor.isRawAudioDataActive;
+	return monitor.isPeakmeterActive || monitor.isRealTimeActive || monitor.isRawAudioDataActive || monitor.isSharedRingActive;
 }
 #pragma endregion
 
@@ -292,21 +652,32 @@ bool AudioWizardMainRealTime::IsRealTimeAudioProcessorActive() const {
 //////////////////////////////////////////////
 #pragma region Private Real-Time Metrics Processing
 void AudioWizardMainRealTime::ProcessRealTimeMetrics(const ChunkData& data) {
+	if (monitor.isTrackResetPending.exchange(false, std::memory_order_acq_rel)) {
+		AudioWizardAnalysisRealTime::ResetTrackState(analysis.realTimeData);
+		ResetHistory();
+	}
+
+	analysis.realTimeData.spectrumActive = spectrum.isSpectrumActive.load(std::memory_order_relaxed);
+	analysis.realTimeData.qualityTier = governor.GetTier();
 	AudioWizardAnalysisRealTime::ProcessRealtimeChunk(data, analysis.realTimeData);
+	if (analysis.realTimeData.spectrumActive) ProcessSpectrumOutput(data);
+
+	BeginMetricsUpdate();
 
 	// Continuous/Slow Metrics
-	metrics.momentaryLUFS.store(analysis.realTimeData.momentaryLUFS, std::memory_order_release);
-	metrics.shortTermLUFS.store(analysis.realTimeData.shortTermLUFS, std::memory_order_release);
-	metrics.RMS.store(analysis.realTimeData.RMS, std::memory_order_release);
-	metrics.phaseCorrelation.store(analysis.realTimeData.phaseCorrelation, std::memory_order_release);
-	metrics.stereoWidth.store(analysis.realTimeData.stereoWidth, std::memory_order_release);
-	metrics.DR.store(analysis.realTimeData.dynamicRange, std::memory_order_release);
-	metrics.PD.store(analysis.realTimeData.pureDynamics, std::memory_order_release);
+	metrics.momentaryLUFS.store(analysis.realTimeData.momentaryLUFS, std::memory_order_relaxed);
+	metrics.shortTermLUFS.store(analysis.realTimeData.shortTermLUFS, std::memory_order_relaxed);
+	metrics.integratedLUFS.store(AWHMath::RoundTo(analysis.realTimeData.integratedLUFS, 1), std::memory_order_relaxed);
+	metrics.RMS.store(analysis.realTimeData.RMS, std::memory_order_relaxed);
+	metrics.phaseCorrelation.store(analysis.realTimeData.phaseCorrelation, std::memory_order_relaxed);
+	metrics.stereoWidth.store(analysis.realTimeData.stereoWidth, std::memory_order_relaxed);
+	metrics.DR.store(analysis.realTimeData.dynamicRange, std::memory_order_relaxed);
+	metrics.PD.store(analysis.realTimeData.pureDynamics, std::memory_order_relaxed);
 
 	// Dynamics/Ratios
-	metrics.PSR.store(analysis.realTimeData.PSR, std::memory_order_release);
-	metrics.PLR.store(analysis.realTimeData.PLR, std::memory_order_release);
-	metrics.crestFactor.store(analysis.realTimeData.crestFactor, std::memory_order_release);
+	metrics.PSR.store(analysis.realTimeData.PSR, std::memory_order_relaxed);
+	metrics.PLR.store(analysis.realTimeData.PLR, std::memory_order_relaxed);
+	metrics.crestFactor.store(analysis.realTimeData.crestFactor, std::memory_order_relaxed);
 
 	// Transient Peaks
 	UpdateLatchedMetric(metrics.leftRMS, analysis.realTimeData.leftRMS);
@@ -315,6 +686,21 @@ void AudioWizardMainRealTime::ProcessRealTimeMetrics(const ChunkData& data) {
 	UpdateLatchedMetric(metrics.rightSamplePeak, analysis.realTimeData.rightSamplePeak);
 	UpdateLatchedMetric(metrics.truePeak, analysis.realTimeData.truePeak);
 
+	// Per-channel Metrics
+	const auto& rtData = analysis.realTimeData;
+	const size_t channelCount = std::min<size_t>(rtData.channelRMS.size(), Config::MAX_METER_CHANNELS);
+	const size_t truePeakCount = std::min(channelCount, rtData.channelTruePeaks.size());
+	for (size_t ch = 0; ch < channelCount; ++ch) {
+		metrics.channelRMS[ch].store(rtData.channelRMS[ch], std::memory_order_relaxed);
+		metrics.channelSamplePeaks[ch].store(rtData.channelSamplePeaks[ch], std::memory_order_relaxed);
+		metrics.channelTruePeaks[ch].store(ch < truePeakCount ? rtData.channelTruePeaks[ch] : -INFINITY, std::memory_order_relaxed);
+	}
+	metrics.channelCount.store(channelCount, std::memory_order_relaxed);
+
+	EndMetricsUpdate();
+
+	ProcessHistory(data);
+
 	AudioWizard::Peakmeter()->UpdatePeakmeter();
 }
 
@@ -323,10 +709,12 @@ void AudioWizardMainRealTime::ProcessPeakmeterMetrics(const ChunkData& data) {
 
 	auto [leftRMS, rightRMS] = AudioWizardAnalysisRealTime::ProcessFrameRMS(data);
 	auto [leftSamplePeak, rightSamplePeak] = AudioWizardAnalysisRealTime::ProcessFramePeaks(data);
-	metrics.leftRMS.store(leftRMS);
-	metrics.rightRMS.store(rightRMS);
-	metrics.leftSamplePeak.store(leftSamplePeak);
-	metrics.rightSamplePeak.store(rightSamplePeak);
+	BeginMetricsUpdate();
+	metrics.leftRMS.store(leftRMS, std::memory_order_relaxed);
+	metrics.rightRMS.store(rightRMS, std::memory_order_relaxed);
+	metrics.leftSamplePeak.store(leftSamplePeak, std::memory_order_relaxed);
+	metrics.rightSamplePeak.store(rightSamplePeak, std::memory_order_relaxed);
+	EndMetricsUpdate();
 
 	AudioWizard::Peakmeter()->UpdatePeakmeter();
 }
@@ -342,6 +730,166 @@ void AudioWizardMainRealTime::ProcessRawAudioDataCapture(const ChunkData& data)
 
 	rawAudioData->buffer.write(data.data, sample_count);
 }
+
+void AudioWizardMainRealTime::ProcessSharedRingCapture(const ChunkData& data) {
+	if (!monitor.isSharedRingActive || data.frames == 0) return;
+
+	std::scoped_lock lock(sharedRing.mutex);
+	if (!sharedRing.ring.IsOpen()) return;
+
+	sharedRing.ring.Write(data.data, data.frames, static_cast<uint32_t>(data.channels), static_cast<uint32_t>(data.sampleRate));
+}
+
+void AudioWizardMainRealTime::ProcessHistory(const ChunkData& data) {
+	if (data.sampleRate == 0) return;
+
+	const auto& rtData = analysis.realTimeData;
+	const auto periodFrames = static_cast<size_t>(data.sampleRate * Config::HISTORY_RESOLUTIONS_MS[0] / 1000);
+
+	// Loudness is already windowed, so the latest value represents the period; the peak is held across its chunks
+	// and covers every channel, not only the front pair
+	history.pending.momentaryLUFS = rtData.momentaryLUFS;
+	history.pending.shortTermLUFS = rtData.shortTermLUFS;
+	for (const double channelPeak : rtData.channelSamplePeaks) {
+		history.pending.peak = std::max(history.pending.peak, channelPeak);
+	}
+	history.pendingFrames += data.frames;
+
+	if (history.pendingFrames < periodFrames) return;
+
+	// Seqlock write side - the real-time thread is the only writer, readers retry instead of blocking it
+	const uint64_t version = history.version.load(std::memory_order_relaxed);
+	history.version.store(version + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	while (history.pendingFrames >= periodFrames) {
+		PushHistoryEntry(0, history.pending);
+		history.pendingFrames -= periodFrames;
+	}
+
+	history.version.store(version + 2, std::memory_order_release);
+	history.pending.peak = -INFINITY;
+}
+
+void AudioWizardMainRealTime::PushHistoryEntry(size_t tierIndex, const HistoryEntry& entry) {
+	auto& tier = history.tiers[tierIndex];
+	const uint64_t sequence = tier.sequence.load(std::memory_order_relaxed);
+	auto& slot = tier.slots[static_cast<size_t>(sequence % tier.capacity)];
+	slot.momentaryLUFS.store(entry.momentaryLUFS, std::memory_order_relaxed);
+	slot.shortTermLUFS.store(entry.shortTermLUFS, std::memory_order_relaxed);
+	slot.peak.store(entry.peak, std::memory_order_relaxed);
+	tier.sequence.store(sequence + 1, std::memory_order_relaxed);
+
+	if (tierIndex + 1 >= Config::HISTORY_TIERS) return;
+
+	// Downsample for the next tier: loudest momentary, latest short-term, highest peak
+	tier.pending.momentaryLUFS = std::max(tier.pending.momentaryLUFS, entry.momentaryLUFS);
+	tier.pending.shortTermLUFS = entry.shortTermLUFS;
+	tier.pending.peak = std::max(tier.pending.peak, entry.peak);
+
+	if (++tier.pendingCount < Config::HISTORY_TIER_FACTOR) return;
+
+	PushHistoryEntry(tierIndex + 1, tier.pending);
+	tier.pending = HistoryEntry();
+	tier.pendingCount = 0;
+}
+
+void AudioWizardMainRealTime::ResetHistory() {
+	// Sequences keep counting so callers' since cursors stay valid, only the retained entries are dropped
+	const uint64_t version = history.version.load(std::memory_order_relaxed);
+	history.version.store(version + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	for (auto& tier : history.tiers) {
+		tier.firstSequence.store(tier.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		tier.pending = HistoryEntry();
+		tier.pendingCount = 0;
+	}
+	history.pending = HistoryEntry();
+	history.pendingFrames = 0;
+
+	history.version.store(version + 2, std::memory_order_release);
+}
+
+void AudioWizardMainRealTime::ProcessSpectrumOutput(const ChunkData& data) {
+	auto& rtData = analysis.realTimeData;
+	if (data.sampleRate <= 0.0) return;
+
+	spectrum.elapsedSeconds += data.frames / data.sampleRate;
+	if (!rtData.spectrumFresh || rtData.spectrumPower.empty()) return;
+	rtData.spectrumFresh = false;
+
+	const int bins = spectrum.bins.load(std::memory_order_acquire);
+	const bool logBinning = spectrum.logBinning.load(std::memory_order_acquire);
+	const auto outputBins = static_cast<size_t>(bins);
+	const size_t barkBands = AWHAudioFFT::BARK_BAND_NUMBER;
+	const size_t fftBins = rtData.spectrumPower.size();
+
+	// Rebuild the output bin mapping and restart smoothing whenever the layout changes
+	if (bins != spectrum.layoutBins || logBinning != spectrum.layoutLogBinning || rtData.fftSize != spectrum.layoutFftSize) {
+		const double nyquist = data.sampleRate / 2.0;
+		const double binWidth = data.sampleRate / rtData.fftSize;
+		spectrum.binRanges.resize(outputBins);
+
+		for (size_t b = 0; b < outputBins; ++b) {
+			const double low = GetSpectrumBinEdge(b, bins, logBinning, nyquist);
+			const double high = GetSpectrumBinEdge(b + 1, bins, logBinning, nyquist);
+			auto first = std::min(static_cast<size_t>(std::ceil(low / binWidth)), fftBins - 1);
+			auto last = std::min(static_cast<size_t>(high / binWidth), fftBins - 1);
+
+			// Output bin narrower than one FFT bin (low end of a log scale), take the nearest FFT bin
+			if (last < first) {
+				first = last = std::min(static_cast<size_t>(std::lround((low + high) / 2.0 / binWidth)), fftBins - 1);
+			}
+
+			spectrum.binRanges[b] = { first, last };
+		}
+
+		spectrum.levels.assign(outputBins + barkBands, Config::SPECTRUM_FLOOR_DB);
+		spectrum.peaks.assign(outputBins + barkBands, Config::SPECTRUM_FLOOR_DB);
+		spectrum.frame.resize(2 * (outputBins + barkBands));
+		spectrum.layoutBins = bins;
+		spectrum.layoutLogBinning = logBinning;
+		spectrum.layoutFftSize = rtData.fftSize;
+		spectrum.sampleRate.store(data.sampleRate, std::memory_order_release);
+	}
+
+	const double smoothing = spectrum.smoothing.load(std::memory_order_relaxed);
+	const double peakFall = spectrum.peakDecay.load(std::memory_order_relaxed) * spectrum.elapsedSeconds;
+	spectrum.elapsedSeconds = 0.0;
+
+	auto update = [&](size_t index, double power) {
+		const double db = std::max(10.0 * std::log10(std::max(power, AWHAudioFFT::EPSILON)), Config::SPECTRUM_FLOOR_DB);
+		spectrum.levels[index] = smoothing * spectrum.levels[index] + (1.0 - smoothing) * db;
+		spectrum.peaks[index] = std::max(spectrum.levels[index], spectrum.peaks[index] - peakFall);
+	};
+
+	for (size_t b = 0; b < outputBins; ++b) {
+		const auto [first, last] = spectrum.binRanges[b];
+		double power = 0.0;
+		for (size_t k = first; k <= last; ++k) {
+			power = std::max(power, rtData.spectrumPower[k]);
+		}
+		update(b, power);
+	}
+
+	for (size_t band = 0; band < barkBands; ++band) {
+		update(outputBins + band, rtData.spectrumBarkPowers[band]);
+	}
+
+	// Frame layout: bin levels, bin peaks, Bark levels, Bark peaks
+	float* frame = spectrum.frame.data();
+	for (size_t b = 0; b < outputBins; ++b) {
+		frame[b] = static_cast<float>(spectrum.levels[b]);
+		frame[outputBins + b] = static_cast<float>(spectrum.peaks[b]);
+	}
+	for (size_t band = 0; band < barkBands; ++band) {
+		frame[2 * outputBins + band] = static_cast<float>(spectrum.levels[outputBins + band]);
+		frame[2 * outputBins + barkBands + band] = static_cast<float>(spectrum.peaks[outputBins + band]);
+	}
+
+	spectrum.output.write(frame, spectrum.frame.size());
+}
 #pragma endregion
 
 
@@ -349,6 +897,31 @@ void AudioWizardMainRealTime::ProcessRawAudioDataCapture(const ChunkData& data)
 // * PRIVATE HELPERS * //
 /////////////////////////
 #pragma region Private Helpers
+void AudioWizardMainRealTime::BeginMetricsUpdate() {
+	// Seqlock write side - claim an even sequence by making it odd, serializing concurrent writers (e.g. ResetMetrics)
+	uint64_t sequence = metrics.version.load(std::memory_order_relaxed);
+
+	while (true) {
+		if (sequence & 1) {
+			std::this_thread::yield();
+			sequence = metrics.version.load(std::memory_order_relaxed);
+			continue;
+		}
+
+		if (metrics.version.compare_exchange_weak(
+				sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed)
+			) {
+			break;
+		}
+	}
+
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+void AudioWizardMainRealTime::EndMetricsUpdate() {
+	metrics.version.fetch_add(1, std::memory_order_release);
+}
+
 void AudioWizardMainRealTime::UpdateLatchedMetric(std::atomic<double>& metric, double newValue) const {
 	double current = metric.load(std::memory_order_relaxed);
 
@@ -361,4 +934,52 @@ void AudioWizardMainRealTime::UpdateLatchedMetric(std::atomic<double>& metric, d
 		// If CAS fails, 'current' is updated with the latest value, loop continues
 	}
 }
+
+void AudioWizardMainRealTime::GetChannelMetric(Metrics::ChannelMetrics Metrics::* field, SAFEARRAY** data, const char* context) const {
+	if (!data) {
+		FB2K_console_formatter() << "Audio Wizard => " << context << ": Invalid output parameter";
+		return;
+	}
+
+	const auto& values = metrics.*field;
+	std::array<float, Config::MAX_METER_CHANNELS> copy;
+	size_t count = 0;
+
+	// Seqlock read side, same protocol as GetMetricsSnapshot
+	while (true) {
+		const uint64_t sequence = metrics.version.load(std::memory_order_acquire);
+
+		if (sequence & 1) {
+			std::this_thread::yield();
+			continue;
+		}
+
+		count = std::min(metrics.channelCount.load(std::memory_order_relaxed), Config::MAX_METER_CHANNELS);
+		for (size_t ch = 0; ch < count; ++ch) {
+			copy[ch] = static_cast<float>(values[ch].load(std::memory_order_relaxed));
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if (metrics.version.load(std::memory_order_relaxed) == sequence) break;
+	}
+
+	if (count > 0) {
+		*data = AWHCOM::CreateSafeArrayFromData(copy.begin(), copy.begin() + count, context);
+	}
+	else {
+		*data = AWHCOM::CreateSafeArrayFromData(0, 0.0f, context); // Empty array
+	}
+}
+
+double AudioWizardMainRealTime::GetSpectrumBinEdge(size_t edge, int bins, bool logBinning, double nyquist) {
+	const double position = static_cast<double>(edge) / bins;
+
+	if (!logBinning) {
+		return position * nyquist;
+	}
+
+	const double minFrequency = std::min(Config::SPECTRUM_MIN_FREQUENCY, nyquist);
+	return minFrequency * std::pow(nyquist / minFrequency, position);
+}
 #pragma endregion
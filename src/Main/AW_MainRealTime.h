@@ -20,7 +20,7 @@ class AudioWizardMainRealTime {
 public:
 	// * TYPE ALIASES * //
 	using ChunkData = AWHAudioData::ChunkData;
-	using DoubleBuffer = AWHAudioBuffer::DoubleBuffer<audioType>;
+	using TripleBuffer = AWHAudioBuffer::TripleBuffer<audioType>;
 	static inline service_ptr_t<visualisation_stream_v3>& visStream = AWHAudioData::visStream;
 
 	// * REAL-TIME DIALOG WINDOW HANDLE * //
@@ -41,7 +41,25 @@ public:
 		static constexpr int MIN_CHUNK_DURATION_MS = 10;
 		static constexpr int MAX_CHUNK_DURATION_MS = 100;
 		static constexpr int MAX_CATCHUP_CHUNKS = 500;
+		static constexpr int MAX_BATCH_CHUNKS = 20;
 		static constexpr double DISCONTINUITY_THRESHOLD = 1.0;
+		static constexpr int REAL_TIME_METRICS_DATA_VERSION = 1; // NOTE: bump whenever REAL_TIME_METRICS changes.
+		static constexpr size_t REAL_TIME_METRICS_COUNT = 16; // M LUFS, S LUFS, I LUFS, RMS, L RMS, R RMS, L SP, R SP, TP, PSR, PLR, CF, DR, PD, PC, SW
+		static constexpr size_t HISTORY_TIERS = 3;
+		static constexpr size_t HISTORY_VALUES_PER_ENTRY = 4; // Sequence, M LUFS, S LUFS, Peak
+		static constexpr size_t HISTORY_TIER_FACTOR = 10; // Each tier downsamples the previous one 10:1
+		static constexpr std::array<int, HISTORY_TIERS> HISTORY_RESOLUTIONS_MS = { 100, 1000, 10000 };
+		static constexpr std::array<size_t, HISTORY_TIERS> HISTORY_CAPACITIES = { 600, 600, 360 }; // 1 min, 10 min, 1 hour
+		static constexpr int SPECTRUM_DATA_VERSION = 1; // NOTE: bump whenever the GetSpectrumData layout changes.
+		static constexpr int DEF_SPECTRUM_BINS = 256;
+		static constexpr int MIN_SPECTRUM_BINS = 16;
+		static constexpr int MAX_SPECTRUM_BINS = 2048;
+		static constexpr double DEF_SPECTRUM_SMOOTHING = 0.5;
+		static constexpr double MAX_SPECTRUM_SMOOTHING = 0.99;
+		static constexpr double DEF_SPECTRUM_PEAK_DECAY = 20.0; // dB per second
+		static constexpr double SPECTRUM_MIN_FREQUENCY = 20.0;
+		static constexpr double SPECTRUM_FLOOR_DB = -120.0;
+		static constexpr size_t MAX_METER_CHANNELS = 24; // Largest BS.2051 layout handled by the K-weighting
 	};
 
 	// * AUDIO METRICS * //
@@ -49,6 +67,7 @@ public:
 		// Continuous Metrics (LUFS, Phase - these change slowly)
 		std::atomic<double> momentaryLUFS = -INFINITY;
 		std::atomic<double> shortTermLUFS = -INFINITY;
+		std::atomic<double> integratedLUFS = -INFINITY;
 		std::atomic<double> RMS = -INFINITY;
 		std::atomic<double> DR = -INFINITY;
 		std::atomic<double> PD = -INFINITY;
@@ -64,11 +83,46 @@ public:
 		std::atomic<double> PSR = -INFINITY;
 		std::atomic<double> PLR = -INFINITY;
 		std::atomic<double> crestFactor = -INFINITY;
+
+		// Per-channel Metrics (source channel order, first channelCount entries are valid)
+		using ChannelMetrics = std::array<std::atomic<double>, Config::MAX_METER_CHANNELS>;
+		ChannelMetrics channelRMS;
+		ChannelMetrics channelSamplePeaks;
+		ChannelMetrics channelTruePeaks;
+		std::atomic<size_t> channelCount = 0;
+
+		// Seqlock sequence - odd while a writer is publishing, even when the fields are consistent
+		std::atomic<uint64_t> version = 0;
 	}; Metrics metrics;
 
+	// * AUDIO METRICS SCHEMA * //
+	struct MetricEntry {
+		std::string_view name;
+		std::atomic<double> Metrics::* field;
+	};
+	static constexpr std::array<MetricEntry, Config::REAL_TIME_METRICS_COUNT> REAL_TIME_METRICS = {{
+		{ "M LUFS", &Metrics::momentaryLUFS    },
+		{ "S LUFS", &Metrics::shortTermLUFS    },
+		{ "I LUFS", &Metrics::integratedLUFS   },
+		{ "RMS",    &Metrics::RMS              },
+		{ "L RMS",  &Metrics::leftRMS          },
+		{ "R RMS",  &Metrics::rightRMS         },
+		{ "L SP",   &Metrics::leftSamplePeak   },
+		{ "R SP",   &Metrics::rightSamplePeak  },
+		{ "TP",     &Metrics::truePeak         },
+		{ "PSR",    &Metrics::PSR              },
+		{ "PLR",    &Metrics::PLR              },
+		{ "CF",     &Metrics::crestFactor      },
+		{ "DR",     &Metrics::DR               },
+		{ "PD",     &Metrics::PD               },
+		{ "PC",     &Metrics::phaseCorrelation },
+		{ "SW",     &Metrics::stereoWidth      }
+	}};
+	using MetricsSnapshot = std::array<double, Config::REAL_TIME_METRICS_COUNT>;
+
 	// * RAW AUDIO DATA * //
 	struct RawAudioData {
-		DoubleBuffer buffer;
+		TripleBuffer buffer;
 		explicit RawAudioData(size_t sample_rate, double max_chunk_duration_ms, size_t channels) :
 			buffer(static_cast<size_t>(sample_rate* (max_chunk_duration_ms / 1000.0)* channels)) {}
 	};
@@ -89,19 +143,93 @@ public:
 		std::atomic<bool> isPeakmeterActive = false;
 		std::atomic<bool> isRealTimeActive = false;
 		std::atomic<bool> isRawAudioDataActive = false;
+		std::atomic<bool> isSharedRingActive = false;
 		std::atomic<int64_t> lastRealtimeUpdate = 0;
 		std::atomic<int64_t> lastMonitoringUpdate = 0;
 		std::atomic<bool> isFetching = false;
 		std::atomic<bool> isUIMessagePending = false;
+		std::atomic<bool> isTrackResetPending = false;
 		std::thread realTimeThread;
 	}; MonitorState monitor;
 
+	// * METRIC HISTORY * //
+	struct HistoryEntry {
+		double momentaryLUFS = -INFINITY;
+		double shortTermLUFS = -INFINITY;
+		double peak = -INFINITY;
+	};
+	struct HistorySlot {
+		std::atomic<double> momentaryLUFS = -INFINITY;
+		std::atomic<double> shortTermLUFS = -INFINITY;
+		std::atomic<double> peak = -INFINITY;
+	};
+	struct HistoryTier {
+		std::unique_ptr<HistorySlot[]> slots;    // Fixed-size ring, slot = (sequence - 1) % capacity
+		size_t capacity = 0;
+		std::atomic<uint64_t> sequence = 0;      // Sequence number of the newest entry, 0 when empty
+		std::atomic<uint64_t> firstSequence = 1; // Oldest sequence still valid, moved past all entries on reset
+		HistoryEntry pending;                    // Entry being downsampled from the tier below, real-time thread only
+		size_t pendingCount = 0;
+	};
+	struct HistoryState { // Written by the real-time thread only, published to readers with a seqlock
+		std::array<HistoryTier, Config::HISTORY_TIERS> tiers;
+		HistoryEntry pending;      // 100 ms entry being accumulated from chunks
+		size_t pendingFrames = 0;
+		std::atomic<uint64_t> version = 0; // Odd while the real-time thread is writing
+		HistoryState() {
+			for (size_t i = 0; i < Config::HISTORY_TIERS; ++i) {
+				tiers[i].capacity = Config::HISTORY_CAPACITIES[i];
+				tiers[i].slots = std::make_unique<HistorySlot[]>(tiers[i].capacity);
+			}
+		}
+	}; HistoryState history;
+
+	// * SPECTRUM STATE * //
+	struct SpectrumState {
+		// Configuration, written by the COM thread
+		std::atomic<bool> isSpectrumActive = false;
+		std::atomic<int> bins = Config::DEF_SPECTRUM_BINS;
+		std::atomic<bool> logBinning = true;
+		std::atomic<double> smoothing = Config::DEF_SPECTRUM_SMOOTHING;
+		std::atomic<double> peakDecay = Config::DEF_SPECTRUM_PEAK_DECAY;
+		std::atomic<double> sampleRate = 0.0;
+
+		// Display state, owned by the real-time thread
+		std::vector<std::pair<size_t, size_t>> binRanges; // FFT bin range [first, last] per output bin
+		std::vector<double> levels; // Smoothed dB, output bins followed by Bark bands
+		std::vector<double> peaks;
+		std::vector<float> frame;
+		size_t layoutFftSize = 0;
+		int layoutBins = 0;
+		bool layoutLogBinning = false;
+		double elapsedSeconds = 0.0;
+
+		// Published frame: levels, peaks, Bark levels, Bark peaks
+		AWHAudioBuffer::TripleBuffer<float> output{ 2 * (Config::MAX_SPECTRUM_BINS + AWHAudioFFT::BARK_BAND_NUMBER) };
+	}; SpectrumState spectrum;
+
+	// * STAGE TIMINGS * //
+	struct StageTimingState {
+		mutable std::mutex mutex;
+		AWHPerf::StageProfile snapshot; // Copy of the analysis profile, published once per processing cycle
+	}; StageTimingState stageTiming;
+
+	// * SHARED AUDIO RING * //
+	struct SharedRingState {
+		AWHAudioBuffer::SharedAudioRing ring; // Named mapping read by external visualizers
+		std::mutex mutex;                     // Serializes the real-time writer against Start/Stop
+	}; SharedRingState sharedRing;
+
+	// * QUALITY GOVERNOR * //
+	AWHPerf::QualityGovernor governor;
+
 	// * CONSTRUCTOR & DESTRUCTOR * //
 	AudioWizardMainRealTime();
 	~AudioWizardMainRealTime();
 
 	// * PUBLIC PROCESSING CONTROL * //
 	void ResetMetrics();
+	void ResetTrackMetrics();
 	void SetMonitoringChunkDuration(int chunkDurationMs);
 	void SetMonitoringRefreshRate(int refreshRateMs);
 	void StartRealTimeMonitoring(int refreshRateMs, int chunkDurationMs);
@@ -111,6 +239,23 @@ public:
 	void StartRawAudioMonitoring(int refreshRateMs, int chunkDurationMs);
 	void StopRawAudioMonitoring();
 	void GetRawAudioData(SAFEARRAY** data) const;
+	bool StartSharedAudioRing(const std::string& name, uint32_t capacityFrames, int refreshRateMs, int chunkDurationMs);
+	void StopSharedAudioRing();
+	uint64_t GetMetricsSnapshot(MetricsSnapshot& snapshot) const;
+	void GetRealTimeMetricsSnapshot(SAFEARRAY** snapshot) const;
+	void GetRealTimeMetricsDataInfo(pfc::string8& json) const;
+	void GetRealTimeStageTimings(pfc::string8& json) const;
+	void GetRealTimeHistory(uint64_t since, int resolutionMs, SAFEARRAY** data) const;
+	static bool IsValidHistoryResolution(int resolutionMs);
+	void StartSpectrumMonitoring(int bins, bool logBinning, double smoothing, double peakDecay);
+	void StopSpectrumMonitoring();
+	void GetSpectrumData(SAFEARRAY** data);
+	void GetSpectrumDataInfo(pfc::string8& json) const;
+	void SetCpuBudget(double percent);
+	int GetQualityTier() const;
+	void GetChannelRMS(SAFEARRAY** data) const;
+	void GetChannelSamplePeaks(SAFEARRAY** data) const;
+	void GetChannelTruePeaks(SAFEARRAY** data) const;
 
 private:
 	// * PRIVATE REAL-TIME AUDIO PROCESSING * //
@@ -123,8 +268,17 @@ private:
 	void ProcessRealTimeMetrics(const ChunkData& data);
 	void ProcessPeakmeterMetrics(const ChunkData& data);
 	void ProcessRawAudioDataCapture(const ChunkData& data);
+	void ProcessSharedRingCapture(const ChunkData& data);
+	void ProcessHistory(const ChunkData& data);
+	void PushHistoryEntry(size_t tierIndex, const HistoryEntry& entry);
+	void ResetHistory();
+	void ProcessSpectrumOutput(const ChunkData& data);
 
 	// * PRIVATE HELPERS * //
+	void BeginMetricsUpdate();
+	void EndMetricsUpdate();
 	void UpdateLatchedMetric(std::atomic<double>& metric, double newValue) const;
+	void GetChannelMetric(Metrics::ChannelMetrics Metrics::* field, SAFEARRAY** data, const char* context) const;
+	static double GetSpectrumBinEdge(size_t edge, int bins, bool logBinning, double nyquist);
 };
 #pragma endregion
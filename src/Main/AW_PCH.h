@@ -9,6 +9,11 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 
+// * Headless build - the analysis core without Windows or the foobar2000 SDK, see CMakeLists.txt * //
+#ifdef AW_HEADLESS
+#include "../Headless/AW_Headless.h"
+#else
+
 #define NOMINMAX
 #define STRICT
 #define WIN32_LEAN_AND_MEAN
@@ -28,9 +33,12 @@
 #include <chrono>
 #include <cmath>
 #include <complex>
+#include <condition_variable>
 #include <ctime>
 #include <deque>
 #include <execution>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <future>
 #include <iomanip>
@@ -40,6 +48,8 @@
 #include <mutex>
 #include <numeric>
 #include <optional>
+#include <set>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -83,3 +93,4 @@ using audioType = audio_sample; // Alias for foobar2000 SDK `audio_sample` type
 #pragma comment(lib, "dwmapi.lib")
 #pragma comment(lib, "Gdiplus.lib")
 #pragma comment(lib, "Pdh.lib")
+#endif
@@ -19,7 +19,9 @@
 // * CONSTRUCTOR & DESTRUCTOR * //
 //////////////////////////////////
 #pragma region Constructor & Destructor
-AudioWizardWaveform::AudioWizardWaveform() = default;
+AudioWizardWaveform::AudioWizardWaveform() :
+	cache(GetWaveformCacheDirectory(), static_cast<uint64_t>(Config::DEF_CACHE_LIMIT_MB) * 1024 * 1024) {
+}
 AudioWizardWaveform::~AudioWizardWaveform() = default;
 #pragma endregion
 
@@ -28,57 +30,35 @@ AudioWizardWaveform::~AudioWizardWaveform() = default;
 // * PUBLIC METHODS * //
 ////////////////////////
 #pragma region Public Methods
-void AudioWizardWaveform::StartWaveformAnalysis(const metadb_handle_list & tracks, int pointsPerSec, bool downmixToMono) {
-	if (state.isAnalyzing.load()) {
-		StopWaveformAnalysis();
-	}
-
-	// Initialize per-track storage
-	state.trackWaveforms.clear();
-	state.trackWaveforms.resize(tracks.get_count());
-
-	int clampedPointsPerSec = std::clamp(
-		pointsPerSec, Config::MIN_POINTS_PER_SEC, Config::MAX_POINTS_PER_SEC
+uint32_t AudioWizardWaveform::StartWaveformAnalysis(const metadb_handle_list& tracks, int pointsPerSec, bool downmixToMono,
+	WaveformEncoding encoding, int priority) {
+	// The API sees the new track count right away, the job prepares its own table and never touches the running one
+	PublishWaveformTable(CreateWaveformTable(tracks, encoding), false);
+	return AudioWizard::Main()->StartFullTrackWaveform(tracks, CreateWaveformPreparation(tracks, pointsPerSec, downmixToMono, encoding),
+		priority
 	);
+}
 
-	state.downmixToMono.store(downmixToMono, std::memory_order_release);
-
-	AWHDebug::DebugLog("StartWaveformAnalysis: Initialized ",
-		tracks.get_count(), " tracks at ", clampedPointsPerSec, " points/sec",
-		downmixToMono ? " (downmix to mono)" : ""
+uint32_t AudioWizardWaveform::StartCombinedAnalysis(const metadb_handle_list& tracks, int pointsPerSec, bool downmixToMono,
+	WaveformEncoding encoding, int metricsChunkDurationMs, int priority) {
+	PublishWaveformTable(CreateWaveformTable(tracks, encoding), false);
+	return AudioWizard::Main()->StartFullTrackCombined(tracks, metricsChunkDurationMs,
+		CreateWaveformPreparation(tracks, pointsPerSec, downmixToMono, encoding), priority
 	);
-
-	for (t_size i = 0; i < tracks.get_count(); ++i) {
-		auto& track = state.trackWaveforms[i];
-		track.handle = tracks[i];
-		track.duration = tracks[i]->get_length();
-		track.reset();
-
-		// Pre-reserve: divide by channel count when downmixing (1 channel output)
-		const size_t effectiveChannels = 1; // always 1 here for reserve; channels set by ProcessWaveformMetrics
-		auto expectedSamples = static_cast<size_t>(
-			track.duration * clampedPointsPerSec * Config::WAVEFORM_CHUNK_ELEMENTS
-		);
-		track.samples.reserve(std::min(expectedSamples, Config::MAX_SAMPLES));
-	}
-
-	state.currentTrackIndex.store(0, std::memory_order_release);
-	state.pointsPerSecond.store(clampedPointsPerSec, std::memory_order_release);
-	state.isAnalysisComplete.store(false, std::memory_order_release);
-	state.isAnalyzing.store(true, std::memory_order_release);
-
-	int chunkDurationMs = 1000 / clampedPointsPerSec;
-	AudioWizard::Main()->StartFullTrackWaveform(tracks, chunkDurationMs);
 }
 
 void AudioWizardWaveform::StopWaveformAnalysis() {
+	AudioWizard::Main()->StopFullTrackWaveform();
+	CompleteWaveformAnalysis();
+}
+
+void AudioWizardWaveform::CompleteWaveformAnalysis() {
 	if (!state.isAnalyzing.load()) return;
 
 	state.isAnalyzing.store(false, std::memory_order_release);
 	state.isAnalysisComplete.store(true, std::memory_order_release);
 
-	AWHDebug::DebugLog("StopWaveformAnalysis: Completed with ", state.trackWaveforms.size(), " tracks");
-	AudioWizard::Main()->StopFullTrackWaveform();
+	AWHDebug::DebugLog("CompleteWaveformAnalysis: Completed with ", GetActiveWaveformTable()->trackWaveforms.size(), " tracks");
 }
 #pragma endregion
 
@@ -94,9 +74,10 @@ bool AudioWizardWaveform::IsWaveformAnalysisComplete(double trackDurationSec) co
 
 	double resolutionSec = 1.0 / state.pointsPerSecond.load();
 	double expectedPoints = (trackDurationSec / resolutionSec) * Config::WAVEFORM_CHUNK_ELEMENTS;
+	const WaveformTablePtr table = GetWaveformTable();
 
-	for (const auto& track : state.trackWaveforms) {
-		if (track.samples.size() >= static_cast<size_t>(expectedPoints * 0.95)) {
+	for (size_t i = 0; i < table->trackWaveforms.size(); ++i) {
+		if (table->IsPublished(i) && table->trackWaveforms[i].samples.elements >= static_cast<size_t>(expectedPoints * 0.95)) {
 			return true;
 		}
 	}
@@ -104,68 +85,65 @@ bool AudioWizardWaveform::IsWaveformAnalysisComplete(double trackDurationSec) co
 	return false;
 }
 
-void AudioWizardWaveform::GetWaveformData(size_t trackIndex, SAFEARRAY** data) const {
+void AudioWizardWaveform::GetWaveformData(size_t trackIndex, SAFEARRAY** data, double startSec, double endSec, size_t pixelWidth) const {
 	if (!data) return;
 
-	if (trackIndex >= state.trackWaveforms.size()) {
+	// The snapshot keeps the table alive while it is read, even if a new analysis replaces it meanwhile
+	const WaveformTablePtr table = GetWaveformTable();
+
+	if (trackIndex >= table->trackWaveforms.size()) {
 		FB2K_console_formatter() << "Audio Wizard => GetWaveformData: Invalid index " << trackIndex;
 		SAFEARRAYBOUND bound = { 0, 0 };
 		*data = SafeArrayCreate(VT_VARIANT, 1, &bound);
 		return;
 	}
 
-	const auto& track = state.trackWaveforms[trackIndex];
-	const unsigned channels = track.channels;
-	const size_t metricsPC = Config::WAVEFORM_CHUNK_ELEMENTS; // 5
-	const size_t step = channels * metricsPC;
-	const size_t total = track.samples.size();
-	const size_t numPoints = (step > 0 && total >= step) ? (total / step) : 0;
-
-	SAFEARRAYBOUND outerBound = { channels, 0 };
-	SAFEARRAY* outerArray = SafeArrayCreate(VT_VARIANT, 1, &outerBound);
-	if (!outerArray) {
-		FB2K_console_formatter() << "Audio Wizard => GetWaveformData: Failed to create outer SAFEARRAY";
-		*data = nullptr;
+	if (!table->IsPublished(trackIndex)) {
+		AWHDebug::DebugLog("GetWaveformData[", trackIndex, "]: Track not ready yet");
+		SAFEARRAYBOUND bound = { 0, 0 };
+		*data = SafeArrayCreate(VT_VARIANT, 1, &bound);
 		return;
 	}
 
-	for (unsigned c = 0; c < channels; ++c) {
-		std::vector<double> chData;
-		chData.reserve(numPoints * metricsPC);
-		const size_t offset = c * metricsPC;
-
-		for (size_t t = 0; t < numPoints; ++t) {
-			const size_t base = t * step + offset;
-			chData.insert(chData.end(),
-				track.samples.begin() + base,
-				track.samples.begin() + base + metricsPC);
-		}
+	const auto& track = table->trackWaveforms[trackIndex];
+	const WaveformRange range = GetWaveformRange(track, startSec, endSec, pixelWidth);
 
-		SAFEARRAY* innerArray = AWHCOM::CreateSafeArrayFromData(
-			chData.begin(), chData.end(), "GetWaveformData"
-		);
+	// Compact encodings are decoded once for the whole range
+	std::vector<double> decoded;
+	const double* values = ReadWaveformPoints(track, GetWaveformLevelData(track, range.level), range.firstPoint, range.numPoints, decoded);
 
-		if (!innerArray) {
-			FB2K_console_formatter() << "Audio Wizard => GetWaveformData: Failed inner SAFEARRAY for ch " << c;
-			continue;
-		}
+	*data = CreateWaveformChannelArrays(values, range.numPoints, track.channels, "GetWaveformData");
 
-		VARIANT v;
-		VariantInit(&v);
-		V_VT(&v) = VT_ARRAY | VT_R4;
-		V_ARRAY(&v) = innerArray;
-		auto idx = static_cast<LONG>(c);
+	AWHDebug::DebugLog("GetWaveformData[", trackIndex, "]: ", range.numPoints, " points x ", track.channels, " channels at level ", range.level);
+}
 
-		HRESULT hr = SafeArrayPutElement(outerArray, &idx, &v); // deep-copies innerArray
-		if (FAILED(hr)) {
-			FB2K_console_formatter() << "Audio Wizard => GetWaveformData: SafeArrayPutElement failed ch " << c << " hr=" << hr;
-		}
-		SafeArrayDestroy(innerArray); // free local reference
+void AudioWizardWaveform::GetWaveformDataFlat(size_t trackIndex, SAFEARRAY** data, double startSec, double endSec, size_t pixelWidth,
+	bool doublePrecision) const {
+	if (!data) return;
+
+	const VARTYPE vt = doublePrecision ? VT_R8 : VT_R4;
+	const WaveformTablePtr table = GetWaveformTable();
 
-		AWHDebug::DebugLog("GetWaveformData[", trackIndex, "] ch", c, ": ", chData.size(), " values");
+	if (trackIndex >= table->trackWaveforms.size()) {
+		FB2K_console_formatter() << "Audio Wizard => GetWaveformDataFlat: Invalid index " << trackIndex;
+		*data = SafeArrayCreateVector(vt, 0, 0);
+		return;
 	}
 
-	*data = outerArray;
+	if (!table->IsPublished(trackIndex)) {
+		AWHDebug::DebugLog("GetWaveformDataFlat[", trackIndex, "]: Track not ready yet");
+		*data = SafeArrayCreateVector(vt, 0, 0);
+		return;
+	}
+
+	const auto& track = table->trackWaveforms[trackIndex];
+	const WaveformRange range = GetWaveformRange(track, startSec, endSec, pixelWidth);
+
+	*data = CreateWaveformFlatArray(track, range, doublePrecision);
+
+	AWHDebug::DebugLog("GetWaveformDataFlat[", trackIndex, "]: ", range.numPoints, " points x ", track.channels,
+		" channels at level ", range.level, doublePrecision ? " (VT_R8)" : " (VT_R4)"
+	);
 }
 
 void AudioWizardWaveform::GetWaveformDataInfo(size_t trackIndex, bool hasTrackIndex, pfc::string8& json) const {
@@ -176,15 +154,23 @@ void AudioWizardWaveform::GetWaveformDataInfo(size_t trackIndex, bool hasTrackIn
 		<< R"("componentVersion":")" << ::AW_COMPONENT_VERSION << "\","
 		<< "\"waveformDataVersion\":" << Config::WAVEFORM_DATA_VERSION;
 
-	if (hasTrackIndex && trackIndex < state.trackWaveforms.size()) {
-		pfc::string8 path;
-		double duration = 0.0;
-		GetWaveformTrackInfo(trackIndex, path, duration);
-		const unsigned channels = GetWaveformTrackChannels(trackIndex);
+	const WaveformTablePtr table = GetWaveformTable();
+
+	if (hasTrackIndex && trackIndex < table->trackWaveforms.size()) {
+		const auto& track = table->trackWaveforms[trackIndex];
+		const bool isPublished = table->IsPublished(trackIndex);
+		const pfc::string8 path = track.handle.is_valid() ? track.handle->get_path() : "";
+		const double duration = isPublished ? track.duration : track.handle.is_valid() ? track.handle->get_length() : 0.0;
 
-		oss << ",\"channels\":" << channels
+		// Fields written by the worker are only read once the track is published
+		oss << ",\"channels\":" << (isPublished ? track.channels : 0u)
+			<< ",\"encodingBits\":" << GetWaveformEncodingBits(track.encoding)
+			<< ",\"peakScale\":" << (isPublished ? track.peakScale : 1.0)
 			<< R"(,"path":")" << AWHString::EscapeJsonString(path.c_str()) << "\""
-			<< ",\"duration\":" << duration;
+			<< ",\"duration\":" << duration
+			<< ",\"pyramidLevels\":" << (isPublished ? track.pyramid.size() + 1 : 0)
+			<< ",\"cached\":" << (isPublished && track.isCached ? "true" : "false")
+			<< ",\"ready\":" << (isPublished ? "true" : "false");
 	}
 
 	oss << ",\"metricsPerChannel\":" << Config::WAVEFORM_CHUNK_ELEMENTS << ","
@@ -207,25 +193,104 @@ void AudioWizardWaveform::GetWaveformDataInfo(size_t trackIndex, bool hasTrackIn
 	);
 }
 
+void AudioWizardWaveform::GetWaveformStream(size_t trackIndex, size_t cursor, size_t level, SAFEARRAY** data) const {
+	if (!data) return;
+
+	const WaveformTablePtr table = GetWaveformTable();
+
+	if (trackIndex >= table->trackWaveforms.size()) {
+		FB2K_console_formatter() << "Audio Wizard => GetWaveformStream: Invalid index " << trackIndex;
+		SAFEARRAYBOUND bound = { 0, 0 };
+		*data = SafeArrayCreate(VT_VARIANT, 1, &bound);
+		return;
+	}
+
+	const auto& track = table->trackWaveforms[trackIndex];
+	const size_t metricsPC = Config::WAVEFORM_CHUNK_ELEMENTS;
+	std::vector<double> values;
+	unsigned channels = 0;
+	bool isStreaming = false;
+
+	// While decoding, only the segments flushed so far are visible, the lock is held just for the copy
+	if (!table->IsPublished(trackIndex) && track.stream) {
+		std::scoped_lock lock(track.stream->mutex);
+
+		if (!track.stream->isClosed) {
+			isStreaming = true;
+			channels = track.stream->channels;
+			const size_t step = channels * metricsPC;
+
+			if (step > 0) {
+				// Only complete groups are returned so a streamed point never changes once delivered
+				const size_t available = (track.stream->points.size() / step) >> level;
+				const size_t first = std::min(cursor, available);
+				values.assign(
+					track.stream->points.begin() + static_cast<ptrdiff_t>((first << level) * step),
+					track.stream->points.begin() + static_cast<ptrdiff_t>((available << level) * step)
+				);
+			}
+		}
+	}
+
+	if (isStreaming) {
+		MergeWaveformLevels(values, channels, level, false);
+	}
+	else if (table->IsPublished(trackIndex)) {
+		// Levels above the top of the pyramid are merged on the fly from the top level
+		channels = track.channels;
+		const size_t step = channels * metricsPC;
+		const size_t sourceLevel = std::min(level, track.pyramid.size());
+		const size_t extraLevels = level - sourceLevel;
+		const WaveformLevel& levelData = GetWaveformLevelData(track, sourceLevel);
+		const size_t sourcePoints = step > 0 ? levelData.elements / step : 0;
+		const size_t first = std::min(cursor << extraLevels, sourcePoints);
+
+		std::vector<double> decoded;
+		const double* points = ReadWaveformPoints(track, levelData, first, sourcePoints - first, decoded);
+		values.assign(points, points + (sourcePoints - first) * step);
+		MergeWaveformLevels(values, channels, extraLevels, true);
+	}
+
+	const size_t step = channels * metricsPC;
+	const size_t numPoints = step > 0 ? values.size() / step : 0;
+	*data = CreateWaveformChannelArrays(values.data(), numPoints, channels, "GetWaveformStream");
+
+	AWHDebug::DebugLog("GetWaveformStream[", trackIndex, "]: ", numPoints, " new points from cursor ", cursor,
+		" at level ", level, isStreaming ? " (streaming)" : ""
+	);
+}
+
+void AudioWizardWaveform::SetWaveformStreamInterval(int intervalMs) {
+	const int clampedIntervalMs = intervalMs > 0
+		? std::clamp(intervalMs, Config::MIN_STREAM_INTERVAL_MS, Config::MAX_STREAM_INTERVAL_MS)
+		: 0;
+
+	state.streamIntervalMs.store(clampedIntervalMs, std::memory_order_relaxed);
+	AWHDebug::DebugLog("SetWaveformStreamInterval: ", clampedIntervalMs, "ms");
+}
+
 unsigned AudioWizardWaveform::GetWaveformTrackChannels(size_t trackIndex) const {
-	if (trackIndex < state.trackWaveforms.size()) {
-		return state.trackWaveforms[trackIndex].channels;
+	const WaveformTablePtr table = GetWaveformTable();
+	if (table->IsPublished(trackIndex)) {
+		return table->trackWaveforms[trackIndex].channels;
 	}
 	return 0;
 }
 
 size_t AudioWizardWaveform::GetWaveformTrackCount() const {
-	return state.trackWaveforms.size();
+	return GetWaveformTable()->trackWaveforms.size();
 }
 
 void AudioWizardWaveform::GetWaveformTrackInfo(size_t trackIndex, pfc::string8& path, double& duration) const {
-	if (trackIndex >= state.trackWaveforms.size()) {
+	const WaveformTablePtr table = GetWaveformTable();
+
+	if (trackIndex >= table->trackWaveforms.size()) {
 		path = "";
 		duration = 0.0;
 		return;
 	}
 
-	const auto& track = state.trackWaveforms[trackIndex];
+	const auto& track = table->trackWaveforms[trackIndex];
 
 	if (track.handle.is_valid()) {
 		path = track.handle->get_path();
@@ -234,7 +299,17 @@ void AudioWizardWaveform::GetWaveformTrackInfo(size_t trackIndex, pfc::string8&
 		path = "";
 	}
 
-	duration = track.duration;
+	// Until the track is published the decoded duration is still being written, use the metadata length instead
+	duration = table->IsPublished(trackIndex) ? track.duration
+		: track.handle.is_valid() ? track.handle->get_length() : 0.0;
+}
+
+bool AudioWizardWaveform::IsWaveformTrackPublished(size_t trackIndex) const {
+	return GetWaveformTable()->IsPublished(trackIndex);
+}
+
+bool AudioWizardWaveform::IsActiveWaveformTrackPublished(size_t trackIndex) const {
+	return GetActiveWaveformTable()->IsPublished(trackIndex);
 }
 
 void AudioWizardWaveform::SetWaveformMetric(WaveformMetric metric) {
@@ -243,22 +318,69 @@ void AudioWizardWaveform::SetWaveformMetric(WaveformMetric metric) {
 #pragma endregion
 
 
+///////////////////////////////
+// * PUBLIC WAVEFORM CACHE * //
+///////////////////////////////
+#pragma region Public Waveform Cache
+void AudioWizardWaveform::SetWaveformCache(bool enabled, LONG limitMB) {
+	const LONG clampedLimitMB = std::clamp(limitMB, Config::MIN_CACHE_LIMIT_MB, Config::MAX_CACHE_LIMIT_MB);
+	cache.SetCache(enabled, static_cast<uint64_t>(clampedLimitMB) * 1024 * 1024);
+
+	AWHDebug::DebugLog("SetWaveformCache: ", enabled ? "Enabled" : "Disabled", " with a limit of ", clampedLimitMB, " MB");
+}
+
+void AudioWizardWaveform::ClearWaveformCache() const {
+	cache.Clear();
+
+	AWHDebug::DebugLog("ClearWaveformCache: Removed all cached waveforms");
+}
+
+bool AudioWizardWaveform::LoadCachedWaveformTrack(size_t trackIndex) {
+	const WaveformTablePtr table = GetActiveWaveformTable();
+
+	if (!cache.IsEnabled() || trackIndex >= table->trackWaveforms.size()) {
+		return false;
+	}
+
+	auto& track = table->trackWaveforms[trackIndex];
+	const std::string key = GetWaveformCacheKey(track);
+	if (key.empty()) return false;
+
+	const bool isLoaded = cache.Load(key, static_cast<uint32_t>(GetWaveformEncodingBits(track.encoding)), Config::WAVEFORM_CHUNK_ELEMENTS,
+		[&track](const AudioWizardWaveformCache::FileHeader& header, const char* view) { ReadCachedWaveformTrack(track, header, view); }
+	);
+
+	AWHDebug::DebugLog("LoadCachedWaveformTrack[", trackIndex, "]: ", isLoaded ? "Hit" : "Miss or stale entry", ", ",
+		track.samples.elements, " values"
+	);
+
+	if (isLoaded) {
+		PublishWaveformTrack(*table, trackIndex);
+		ProcessWaveformMemory(track);
+	}
+
+	return isLoaded;
+}
+#pragma endregion
+
+
 ////////////////////////////////////////////
 // * PUBLIC WAVEFORM METRICS PROCESSING * //
 ////////////////////////////////////////////
 #pragma region Public Waveform Metrics Processing
-void AudioWizardWaveform::ProcessWaveformMetrics(const ChunkData& data) {
+void AudioWizardWaveform::ProcessWaveformMetrics(const ChunkData& data, size_t trackIndex) {
 	if (!AudioWizard::Waveform() || !state.isAnalyzing.load(std::memory_order_relaxed)) {
 		return;
 	}
 
-	const size_t currentIndex = state.currentTrackIndex.load(std::memory_order_acquire);
-	if (currentIndex >= state.trackWaveforms.size()) {
-		AWHDebug::DebugLog("ProcessWaveformMetrics: Invalid track index ", currentIndex);
+	const WaveformTablePtr table = GetActiveWaveformTable();
+
+	if (trackIndex >= table->trackWaveforms.size() || table->IsPublished(trackIndex)) {
+		AWHDebug::DebugLog("ProcessWaveformMetrics: Invalid track index ", trackIndex);
 		return;
 	}
 
-	auto& track = state.trackWaveforms[currentIndex];
+	auto& track = table->trackWaveforms[trackIndex];
 	const bool downmix = state.downmixToMono.load(std::memory_order_relaxed);
 	const unsigned effectiveChannels = downmix ? 1u : data.channels;
 
@@ -266,6 +388,7 @@ void AudioWizardWaveform::ProcessWaveformMetrics(const ChunkData& data) {
 	if (track.channels != effectiveChannels) {
 		track.channels = effectiveChannels;
 		track.activeRMSPeaks.assign(effectiveChannels, -100.0);
+		InitWaveformEncoding(track);
 	}
 
 	// 2. Setup Processing Constants
@@ -274,8 +397,7 @@ void AudioWizardWaveform::ProcessWaveformMetrics(const ChunkData& data) {
 	const size_t framesPerResolution = std::max<size_t>(1, static_cast<size_t>(data.sampleRate / safePPS));
 	const size_t numChunks = (data.frames + framesPerResolution - 1) / framesPerResolution;
 	const size_t elementsPerChunk = effectiveChannels * Config::WAVEFORM_CHUNK_ELEMENTS;
-	const size_t outputStart = track.samples.size();
-	track.samples.resize(outputStart + numChunks * elementsPerChunk);
+	track.pointScratch.resize(numChunks * elementsPerChunk);
 
 	// 3. Hoist Allocations  sized for effectiveChannels
 	std::vector<double> sumSquares(effectiveChannels);
@@ -333,7 +455,7 @@ void AudioWizardWaveform::ProcessWaveformMetrics(const ChunkData& data) {
 		}
 
 		// Finalize metrics and store
-		size_t outIdx = outputStart + chunkIdx * elementsPerChunk;
+		size_t outIdx = chunkIdx * elementsPerChunk;
 		double chunkGlobalMax = 0.0;
 
 		for (size_t c = 0; c < effectiveChannels; ++c) {
@@ -347,11 +469,11 @@ void AudioWizardWaveform::ProcessWaveformMetrics(const ChunkData& data) {
 			rmsPeakDb = std::clamp((rmsDb > rmsPeakDb) ? rmsDb : rmsPeakDb - decayAmount, -100.0, 0.0);
 
 			// Store metrics in order: rms, rms_peak, sample_peak, min, max
-			track.samples[outIdx++] = std::round(rmsDb);
-			track.samples[outIdx++] = std::round(rmsPeakDb);
-			track.samples[outIdx++] = std::round(samplePeakDb);
-			track.samples[outIdx++] = std::clamp(minSample[c], -1.0, 1.0);
-			track.samples[outIdx++] = std::clamp(maxSample[c], -1.0, 1.0);
+			track.pointScratch[outIdx++] = std::round(rmsDb);
+			track.pointScratch[outIdx++] = std::round(rmsPeakDb);
+			track.pointScratch[outIdx++] = std::round(samplePeakDb);
+			track.pointScratch[outIdx++] = std::clamp(minSample[c], -1.0, 1.0);
+			track.pointScratch[outIdx++] = std::clamp(maxSample[c], -1.0, 1.0);
 
 			chunkGlobalMax = std::max(chunkGlobalMax, maxAbs[c]);
 		}
@@ -362,5 +484,675 @@ void AudioWizardWaveform::ProcessWaveformMetrics(const ChunkData& data) {
 
 	track.duration = currentTime;
 	track.lastSampleTime = currentTime;
+
+	AppendWaveformPoints(track, track.samples, track.pointScratch.data(), track.pointScratch.size());
+	ProcessWaveformPyramid(track);
+	ProcessWaveformMemory(track);
+
+	// The first chunk is flushed immediately, later segments at the configured cadence
+	const int streamIntervalMs = state.streamIntervalMs.load(std::memory_order_relaxed);
+	if (streamIntervalMs > 0 && std::chrono::steady_clock::now() - track.lastStreamFlush >= std::chrono::milliseconds(streamIntervalMs)) {
+		FlushWaveformStream(track, trackIndex);
+	}
+}
+
+void AudioWizardWaveform::FinalizeWaveformTrack(size_t trackIndex) {
+	const WaveformTablePtr table = GetActiveWaveformTable();
+	if (trackIndex >= table->trackWaveforms.size()) return;
+
+	auto& track = table->trackWaveforms[trackIndex];
+	ProcessWaveformPyramid(track, true);
+	StoreCachedWaveformTrack(track);
+	PublishWaveformTrack(*table, trackIndex);
+	ProcessWaveformMemory(track);
+}
+#pragma endregion
+
+
+//////////////////////////////////////
+// * PRIVATE WAVEFORM PREPARATION * //
+//////////////////////////////////////
+#pragma region Private Waveform Preparation
+std::function<int(bool)> AudioWizardWaveform::CreateWaveformPreparation(const metadb_handle_list& tracks, int pointsPerSec,
+	bool downmixToMono, WaveformEncoding encoding) {
+	// The job remembers the table it prepared without keeping it alive, a resumed run picks it up again if it is still active
+	auto preparedTable = std::make_shared<std::weak_ptr<WaveformTable>>();
+
+	return [this, tracks, pointsPerSec, downmixToMono, encoding, preparedTable](bool isResumed) {
+		if (const int chunkDurationMs = isResumed ? ResumeWaveformAnalysis(preparedTable->lock()) : 0; chunkDurationMs > 0) {
+			return chunkDurationMs;
+		}
+
+		const int chunkDurationMs = PrepareWaveformAnalysis(tracks, pointsPerSec, downmixToMono, encoding);
+		*preparedTable = GetActiveWaveformTable();
+		return chunkDurationMs;
+	};
+}
+
+int AudioWizardWaveform::PrepareWaveformAnalysis(const metadb_handle_list& tracks, int pointsPerSec, bool downmixToMono,
+	WaveformEncoding encoding) {
+	if (state.isAnalyzing.load()) {
+		CompleteWaveformAnalysis();
+	}
+
+	int clampedPointsPerSec = std::clamp(
+		pointsPerSec, Config::MIN_POINTS_PER_SEC, Config::MAX_POINTS_PER_SEC
+	);
+
+	state.downmixToMono.store(downmixToMono, std::memory_order_release);
+	state.encoding.store(encoding, std::memory_order_release);
+
+	AWHDebug::DebugLog("PrepareWaveformAnalysis: Initialized ",
+		tracks.get_count(), " tracks at ", clampedPointsPerSec, " points/sec",
+		downmixToMono ? " (downmix to mono)" : "", ", ", GetWaveformEncodingBits(encoding), "-bit storage"
+	);
+
+	// A fresh table is filled before it is published, the one readers or a superseded job still hold is left alone
+	const WaveformTablePtr table = CreateWaveformTable(tracks, encoding);
+
+	for (t_size i = 0; i < tracks.get_count(); ++i) {
+		auto& track = table->trackWaveforms[i];
+		track.stream = std::make_unique<WaveformStream>();
+
+		// Compact encodings quantize min/max against the ReplayGain track peak when it is known
+		metadb_info_container::ptr infoContainer;
+		if (encoding != WaveformEncoding::Float64 && tracks[i]->get_info_ref(infoContainer)) {
+			const replaygain_info replayGain = infoContainer->info().get_replaygain();
+			if (replayGain.is_track_peak_present() && replayGain.m_track_peak > 0.0f && replayGain.m_track_peak < 1.0f) {
+				track.peakScale = replayGain.m_track_peak;
+			}
+		}
+
+		// Pre-reserve: divide by channel count when downmixing (1 channel output)
+		const size_t effectiveChannels = 1; // always 1 here for reserve; channels set by ProcessWaveformMetrics
+		auto expectedSamples = std::min(static_cast<size_t>(
+			track.duration * clampedPointsPerSec * Config::WAVEFORM_CHUNK_ELEMENTS
+		), Config::MAX_SAMPLES);
+
+		switch (encoding) {
+			case WaveformEncoding::Int16: track.samples.values16.reserve(expectedSamples); break;
+			case WaveformEncoding::Int8: track.samples.values8.reserve(expectedSamples); break;
+			default: track.samples.values.reserve(expectedSamples); break;
+		}
+		ProcessWaveformMemory(track);
+	}
+
+	PublishWaveformTable(table, true);
+	state.pointsPerSecond.store(clampedPointsPerSec, std::memory_order_release);
+	state.isAnalysisComplete.store(false, std::memory_order_release);
+	state.isAnalyzing.store(true, std::memory_order_release);
+
+	return 1000 / clampedPointsPerSec;
+}
+
+int AudioWizardWaveform::ResumeWaveformAnalysis(const WaveformTablePtr& table) {
+	// Another waveform or combined job prepared its own table in the meantime, the caller starts over
+	if (!table || GetActiveWaveformTable() != table) return 0;
+
+	// Published tracks are kept, the slots the preempted run left half written are decoded again
+	for (size_t i = 0; i < table->trackWaveforms.size(); ++i) {
+		if (table->IsPublished(i)) continue;
+
+		auto& track = table->trackWaveforms[i];
+		track.reset();
+		track.duration = track.handle.is_valid() ? track.handle->get_length() : 0.0;
+		track.streamedElements = 0;
+		track.lastStreamFlush = {};
+
+		if (track.stream) {
+			std::scoped_lock lock(track.stream->mutex);
+			track.stream->points.clear();
+			track.stream->channels = 0;
+		}
+		ProcessWaveformMemory(track);
+	}
+
+	state.isAnalysisComplete.store(false, std::memory_order_release);
+	state.isAnalyzing.store(true, std::memory_order_release);
+
+	AWHDebug::DebugLog("ResumeWaveformAnalysis: Kept ", table->publishedTracks.load(std::memory_order_acquire), " of ",
+		table->trackWaveforms.size(), " tracks"
+	);
+
+	return 1000 / state.pointsPerSecond.load(std::memory_order_acquire);
+}
+
+AudioWizardWaveform::WaveformTablePtr AudioWizardWaveform::CreateWaveformTable(const metadb_handle_list& tracks, WaveformEncoding encoding) {
+	auto table = std::make_shared<WaveformTable>(tracks.get_count());
+
+	for (t_size i = 0; i < tracks.get_count(); ++i) {
+		auto& track = table->trackWaveforms[i];
+		track.handle = tracks[i];
+		track.duration = tracks[i]->get_length();
+		track.encoding = encoding;
+		track.reset();
+	}
+
+	return table;
+}
+#pragma endregion
+
+
+/////////////////////////////////////
+// * PRIVATE WAVEFORM PUBLISHING * //
+/////////////////////////////////////
+#pragma region Private Waveform Publishing
+AudioWizardWaveform::WaveformTablePtr AudioWizardWaveform::GetWaveformTable() const {
+	std::scoped_lock lock(state.tableMutex);
+	return state.table;
+}
+
+AudioWizardWaveform::WaveformTablePtr AudioWizardWaveform::GetActiveWaveformTable() const {
+	std::scoped_lock lock(state.tableMutex);
+	return state.activeTable;
+}
+
+void AudioWizardWaveform::PublishWaveformTable(const WaveformTablePtr& table, bool isActive) {
+	// Only the pointers are swapped under the lock, a replaced table is freed when its last reader or worker lets go of it
+	WaveformTablePtr replaced;
+	WaveformTablePtr replacedActive;
+	{
+		std::scoped_lock lock(state.tableMutex);
+		replaced = std::exchange(state.table, table);
+		if (isActive) replacedActive = std::exchange(state.activeTable, table);
+	}
+}
+
+void AudioWizardWaveform::PublishWaveformTrack(WaveformTable& table, size_t trackIndex) {
+	// Release pairs with the acquire in WaveformTable::IsPublished, the worker never touches the slot again
+	table.trackPublished[trackIndex].store(true, std::memory_order_release);
+	const size_t published = table.publishedTracks.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+	// Stream readers switch to the published track, so the streamed copy is released
+	const auto& track = table.trackWaveforms[trackIndex];
+	if (track.stream) {
+		std::scoped_lock lock(track.stream->mutex);
+		track.stream->isClosed = true;
+		track.stream->points.clear();
+		track.stream->points.shrink_to_fit();
+	}
+
+	const size_t step = track.channels * Config::WAVEFORM_CHUNK_ELEMENTS;
+	const size_t points = step > 0 ? track.samples.elements / step : 0;
+	AWHCOM::FireCallback(AudioWizard::Main()->callbacks.waveformProgressCallback, {
+		CComVariant(static_cast<LONG>(trackIndex)), CComVariant(static_cast<LONG>(points)), CComVariant(true)
+	});
+
+	AWHDebug::DebugLog("PublishWaveformTrack[", trackIndex, "]: ", published, " of ", table.trackWaveforms.size(), " tracks ready");
+}
+
+void AudioWizardWaveform::FlushWaveformStream(TrackWaveform& track, size_t trackIndex) const {
+	const size_t step = track.channels * Config::WAVEFORM_CHUNK_ELEMENTS;
+	if (!track.stream || step == 0 || track.samples.elements <= track.streamedElements) return;
+
+	// Decoded outside the lock, readers only wait for the append
+	const size_t firstPoint = track.streamedElements / step;
+	const size_t numPoints = track.samples.elements / step - firstPoint;
+	std::vector<double> decoded;
+	const double* values = ReadWaveformPoints(track, track.samples, firstPoint, numPoints, decoded);
+	size_t streamedPoints = 0;
+
+	{
+		std::scoped_lock lock(track.stream->mutex);
+		auto& points = track.stream->points;
+		const size_t start = points.size();
+
+		track.stream->channels = track.channels;
+		points.resize(start + numPoints * step);
+		std::transform(values, values + numPoints * step, points.begin() + static_cast<ptrdiff_t>(start),
+			[](double value) { return static_cast<float>(value); }
+		);
+		streamedPoints = points.size() / step;
+	}
+
+	track.streamedElements = track.samples.elements;
+	track.lastStreamFlush = std::chrono::steady_clock::now();
+
+	AWHCOM::FireCallback(AudioWizard::Main()->callbacks.waveformProgressCallback, {
+		CComVariant(static_cast<LONG>(trackIndex)), CComVariant(static_cast<LONG>(streamedPoints)), CComVariant(false)
+	});
+}
+
+void AudioWizardWaveform::ProcessWaveformMemory(TrackWaveform& track) {
+	using AWHPerf::GetVectorBytes;
+
+	const auto levelBytes = [](const WaveformLevel& level) {
+		return GetVectorBytes(level.values) + GetVectorBytes(level.values16) + GetVectorBytes(level.values8);
+	};
+
+	size_t bytes = levelBytes(track.samples) + GetVectorBytes(track.pyramid) + GetVectorBytes(track.activeRMSPeaks) +
+		GetVectorBytes(track.quantSteps) + GetVectorBytes(track.pointScratch);
+
+	for (const auto& level : track.pyramid) {
+		bytes += levelBytes(level);
+	}
+
+	// Only the analysis worker resizes the stream copy, so its capacity is read without the stream lock
+	if (track.stream) {
+		bytes += GetVectorBytes(track.stream->points);
+	}
+
+	track.memory.Set(bytes);
+}
+
+SAFEARRAY* AudioWizardWaveform::CreateWaveformChannelArrays(const double* values, size_t numPoints, unsigned channels, const char* context) {
+	const size_t metricsPC = Config::WAVEFORM_CHUNK_ELEMENTS; // 5
+	const size_t step = channels * metricsPC;
+
+	SAFEARRAYBOUND outerBound = { channels, 0 };
+	SAFEARRAY* outerArray = SafeArrayCreate(VT_VARIANT, 1, &outerBound);
+	if (!outerArray) {
+		FB2K_console_formatter() << "Audio Wizard => " << context << ": Failed to create outer SAFEARRAY";
+		return nullptr;
+	}
+
+	VARIANT* outerData = nullptr;
+	HRESULT hr = SafeArrayAccessData(outerArray, reinterpret_cast<void**>(&outerData));
+	if (FAILED(hr)) {
+		FB2K_console_formatter() << "Audio Wizard => " << context << ": SafeArrayAccessData failed: " << hr;
+		SafeArrayDestroy(outerArray);
+		return nullptr;
+	}
+
+	for (unsigned c = 0; c < channels; ++c) {
+		SAFEARRAY* innerArray = SafeArrayCreateVector(VT_R4, 0, static_cast<ULONG>(numPoints * metricsPC));
+
+		if (!innerArray) {
+			FB2K_console_formatter() << "Audio Wizard => " << context << ": Failed inner SAFEARRAY for ch " << c;
+			continue;
+		}
+
+		// Gather the channel's points straight into the inner array
+		{
+			AWHCOM::SafeArrayAccess access(innerArray);
+			if (float* out = access.getData()) {
+				const double* point = values + c * metricsPC;
+				for (size_t t = 0; t < numPoints; ++t, point += step, out += metricsPC) {
+					for (size_t m = 0; m < metricsPC; ++m) {
+						out[m] = static_cast<float>(point[m]);
+					}
+				}
+			}
+		}
+
+		// The outer array takes ownership of innerArray, no deep copy
+		V_VT(&outerData[c]) = VT_ARRAY | VT_R4;
+		V_ARRAY(&outerData[c]) = innerArray;
+	}
+
+	SafeArrayUnaccessData(outerArray);
+
+	return outerArray;
+}
+
+SAFEARRAY* AudioWizardWaveform::CreateWaveformFlatArray(const TrackWaveform& track, const WaveformRange& range, bool doublePrecision) {
+	const size_t count = range.numPoints * track.channels * Config::WAVEFORM_CHUNK_ELEMENTS;
+
+	if (count > std::numeric_limits<ULONG>::max()) {
+		FB2K_console_formatter() << "Audio Wizard => GetWaveformDataFlat: Invalid size (" << count << ")";
+		return nullptr;
+	}
+
+	SAFEARRAY* psa = SafeArrayCreateVector(doublePrecision ? VT_R8 : VT_R4, 0, static_cast<ULONG>(count));
+	if (!psa) {
+		FB2K_console_formatter() << "Audio Wizard => GetWaveformDataFlat: Failed to create SAFEARRAY";
+		return nullptr;
+	}
+
+	void* out = nullptr;
+	HRESULT hr = SafeArrayAccessData(psa, &out);
+	if (FAILED(hr)) {
+		FB2K_console_formatter() << "Audio Wizard => GetWaveformDataFlat: SafeArrayAccessData failed: " << hr;
+		SafeArrayDestroy(psa);
+		return nullptr;
+	}
+
+	// The stored point layout is the documented flat layout, so the range is written in one pass
+	const WaveformLevel& levelData = GetWaveformLevelData(track, range.level);
+	if (doublePrecision) {
+		CopyWaveformPoints(track, levelData, range.firstPoint, range.numPoints, static_cast<double*>(out));
+	}
+	else {
+		CopyWaveformPoints(track, levelData, range.firstPoint, range.numPoints, static_cast<float*>(out));
+	}
+
+	SafeArrayUnaccessData(psa);
+
+	return psa;
+}
+
+
+//////////////////////////////////
+// * PRIVATE WAVEFORM PYRAMID * //
+//////////////////////////////////
+#pragma region Private Waveform Pyramid
+void AudioWizardWaveform::ProcessWaveformPyramid(TrackWaveform& track, bool isFinal) {
+	const size_t step = track.channels * Config::WAVEFORM_CHUNK_ELEMENTS;
+	if (step == 0) return;
+
+	// Each level merges pairs of the level below, only the points added since the last call are visited
+	std::vector<double> decoded;
+	std::vector<double> merged;
+
+	for (size_t level = 1; level <= Config::MAX_PYRAMID_LEVELS; ++level) {
+		if (track.pyramid.size() < level) {
+			if (GetWaveformLevelData(track, level - 1).elements < 2 * step) break;
+			track.pyramid.emplace_back();
+		}
+
+		// Looked up after emplace_back, which may move the pyramid levels
+		const WaveformLevel& source = GetWaveformLevelData(track, level - 1);
+		WaveformLevel& target = track.pyramid[level - 1];
+		const size_t sourcePoints = source.elements / step;
+		const size_t targetPoints = target.elements / step;
+		const size_t pairedPoints = sourcePoints / 2;
+
+		if (pairedPoints > targetPoints) {
+			const size_t newPoints = pairedPoints - targetPoints;
+			const double* pairs = ReadWaveformPoints(track, source, 2 * targetPoints, 2 * newPoints, decoded);
+
+			merged.resize(newPoints * step);
+			for (size_t p = 0; p < newPoints; ++p) {
+				const double* first = pairs + 2 * p * step;
+				MergeWaveformPoints(first, first + step, merged.data() + p * step, track.channels);
+			}
+
+			AppendWaveformPoints(track, target, merged.data(), merged.size());
+		}
+
+		// At track end an unpaired trailing point is carried up as-is so every level covers the full duration
+		if (isFinal && (sourcePoints & 1) != 0) {
+			const double* last = ReadWaveformPoints(track, source, sourcePoints - 1, 1, decoded);
+			AppendWaveformPoints(track, target, last, step);
+		}
+	}
+}
+
+void AudioWizardWaveform::MergeWaveformPoints(const double* first, const double* second, double* out, unsigned channels) {
+	for (unsigned c = 0; c < channels; ++c, first += Config::WAVEFORM_CHUNK_ELEMENTS, second += Config::WAVEFORM_CHUNK_ELEMENTS) {
+		// RMS is averaged in the power domain, peaks and extremes keep the strongest value
+		const double power = (std::pow(10.0, first[0] / 10.0) + std::pow(10.0, second[0] / 10.0)) * 0.5;
+		*out++ = std::round(std::clamp(10.0 * std::log10(power), -100.0, 0.0));
+		*out++ = std::max(first[1], second[1]);
+		*out++ = std::max(first[2], second[2]);
+		*out++ = std::min(first[3], second[3]);
+		*out++ = std::max(first[4], second[4]);
+	}
+}
+
+void AudioWizardWaveform::MergeWaveformLevels(std::vector<double>& values, unsigned channels, size_t levels, bool keepRemainder) {
+	const size_t step = channels * Config::WAVEFORM_CHUNK_ELEMENTS;
+	if (step == 0) return;
+
+	// Same pairwise merge as the pyramid, done in place since each output point sits before its inputs
+	for (size_t level = 0; level < levels; ++level) {
+		const size_t points = values.size() / step;
+		const size_t pairs = points / 2;
+
+		for (size_t p = 0; p < pairs; ++p) {
+			const double* first = values.data() + 2 * p * step;
+			MergeWaveformPoints(first, first + step, values.data() + p * step, channels);
+		}
+
+		const bool hasRemainder = keepRemainder && (points & 1) != 0;
+		if (hasRemainder && pairs > 0) {
+			std::copy_n(values.begin() + static_cast<ptrdiff_t>((points - 1) * step), step, values.begin() + static_cast<ptrdiff_t>(pairs * step));
+		}
+
+		values.resize((pairs + (hasRemainder ? 1 : 0)) * step);
+	}
+}
+
+size_t AudioWizardWaveform::GetWaveformLevel(const TrackWaveform& track, double basePointsPerPixel) {
+	if (basePointsPerPixel < 2.0) return 0;
+
+	const auto level = static_cast<size_t>(std::floor(std::log2(basePointsPerPixel)));
+	return std::min(level, track.pyramid.size());
+}
+
+AudioWizardWaveform::WaveformRange AudioWizardWaveform::GetWaveformRange(const TrackWaveform& track,
+	double startSec, double endSec, size_t pixelWidth) const {
+	const size_t step = track.channels * Config::WAVEFORM_CHUNK_ELEMENTS;
+	const size_t basePoints = step > 0 ? track.samples.elements / step : 0;
+
+	// Resolve the requested time range in base points, an empty range means the whole track
+	const double pointsPerSecond = state.pointsPerSecond.load(std::memory_order_relaxed);
+	const auto rangeStart = std::min(basePoints, static_cast<size_t>(std::max(0.0, startSec) * pointsPerSecond));
+	const size_t rangeEnd = endSec > startSec
+		? std::clamp(static_cast<size_t>(std::ceil(endSec * pointsPerSecond)), rangeStart, basePoints)
+		: basePoints;
+
+	// Pick the coarsest pyramid level that still provides at least one point per pixel
+	WaveformRange range;
+	range.level = pixelWidth > 0
+		? GetWaveformLevel(track, static_cast<double>(rangeEnd - rangeStart) / static_cast<double>(pixelWidth))
+		: 0;
+
+	const size_t levelPoints = step > 0 ? GetWaveformLevelData(track, range.level).elements / step : 0;
+	range.firstPoint = std::min(rangeStart >> range.level, levelPoints);
+	const size_t lastPoint = std::clamp((rangeEnd + (size_t{ 1 } << range.level) - 1) >> range.level, range.firstPoint, levelPoints);
+	range.numPoints = lastPoint - range.firstPoint;
+
+	return range;
+}
+
+const AudioWizardWaveform::WaveformLevel& AudioWizardWaveform::GetWaveformLevelData(const TrackWaveform& track, size_t level) {
+	return level == 0 ? track.samples : track.pyramid[level - 1];
+}
+#pragma endregion
+
+
+///////////////////////////////////
+// * PRIVATE WAVEFORM ENCODING * //
+///////////////////////////////////
+#pragma region Private Waveform Encoding
+void AudioWizardWaveform::InitWaveformEncoding(TrackWaveform& track) {
+	const auto& steps = track.encoding == WaveformEncoding::Int8 ? Config::INT8_STEPS : Config::INT16_STEPS;
+	track.quantSteps.resize(track.channels * Config::WAVEFORM_CHUNK_ELEMENTS);
+
+	for (size_t c = 0; c < track.channels; ++c) {
+		for (size_t m = 0; m < Config::WAVEFORM_CHUNK_ELEMENTS; ++m) {
+			// rms, rms_peak and sample_peak are dB, min and max are linear samples scaled to the track peak
+			const bool isLinear = m >= 3;
+			track.quantSteps[c * Config::WAVEFORM_CHUNK_ELEMENTS + m] = isLinear ? steps[m] * track.peakScale : steps[m];
+		}
+	}
+}
+
+void AudioWizardWaveform::AppendWaveformPoints(const TrackWaveform& track, WaveformLevel& level, const double* values, size_t count) {
+	const double* steps = track.quantSteps.data();
+	const size_t step = track.quantSteps.size();
+
+	switch (track.encoding) {
+		case WaveformEncoding::Int16: EncodeQuantized(values, count, steps, step, level.values16); break;
+		case WaveformEncoding::Int8: EncodeQuantized(values, count, steps, step, level.values8); break;
+		default: level.values.insert(level.values.end(), values, values + count); break;
+	}
+
+	level.elements += count;
+}
+
+const double* AudioWizardWaveform::ReadWaveformPoints(const TrackWaveform& track, const WaveformLevel& level,
+	size_t firstPoint, size_t numPoints, std::vector<double>& scratch) {
+	const double* steps = track.quantSteps.data();
+	const size_t step = track.quantSteps.size();
+	const size_t first = firstPoint * step;
+
+	switch (track.encoding) {
+		case WaveformEncoding::Int16:
+			scratch.resize(numPoints * step);
+			DecodeQuantized(level.values16.data() + first, numPoints, steps, step, scratch.data());
+			return scratch.data();
+
+		case WaveformEncoding::Int8:
+			scratch.resize(numPoints * step);
+			DecodeQuantized(level.values8.data() + first, numPoints, steps, step, scratch.data());
+			return scratch.data();
+
+		default:
+			return level.values.data() + first;
+	}
+}
+
+template <typename Out>
+void AudioWizardWaveform::CopyWaveformPoints(const TrackWaveform& track, const WaveformLevel& level,
+	size_t firstPoint, size_t numPoints, Out* out) {
+	const double* steps = track.quantSteps.data();
+	const size_t step = track.quantSteps.size();
+	const size_t first = firstPoint * step;
+	const size_t count = numPoints * step;
+
+	switch (track.encoding) {
+		case WaveformEncoding::Int16:
+			DecodeQuantized(level.values16.data() + first, numPoints, steps, step, out);
+			break;
+
+		case WaveformEncoding::Int8:
+			DecodeQuantized(level.values8.data() + first, numPoints, steps, step, out);
+			break;
+
+		default:
+			if constexpr (std::is_same_v<Out, double>) {
+				std::memcpy(out, level.values.data() + first, count * sizeof(double));
+			}
+			else {
+				std::transform(level.values.data() + first, level.values.data() + first + count, out,
+					[](double value) { return static_cast<Out>(value); }
+				);
+			}
+			break;
+	}
+}
+
+template <typename T>
+void AudioWizardWaveform::EncodeQuantized(const double* values, size_t count, const double* steps, size_t step, std::vector<T>& out) {
+	constexpr auto MIN_VALUE = static_cast<double>(std::numeric_limits<T>::min());
+	constexpr auto MAX_VALUE = static_cast<double>(std::numeric_limits<T>::max());
+
+	const size_t start = out.size();
+	out.resize(start + count);
+	T* dst = out.data() + start;
+
+	for (size_t i = 0; i < count; i += step) {
+		for (size_t j = 0; j < step; ++j) {
+			dst[i + j] = static_cast<T>(std::clamp(std::round(values[i + j] / steps[j]), MIN_VALUE, MAX_VALUE));
+		}
+	}
+}
+
+template <typename T, typename Out>
+void AudioWizardWaveform::DecodeQuantized(const T* values, size_t numPoints, const double* steps, size_t step, Out* out) {
+	// One multiply per element against a per-point step table, the inner loop vectorizes
+	for (size_t p = 0; p < numPoints; ++p, values += step, out += step) {
+		for (size_t j = 0; j < step; ++j) {
+			out[j] = static_cast<Out>(static_cast<double>(values[j]) * steps[j]);
+		}
+	}
+}
+
+size_t AudioWizardWaveform::GetWaveformEncodingBits(WaveformEncoding encoding) {
+	switch (encoding) {
+		case WaveformEncoding::Int16: return 16;
+		case WaveformEncoding::Int8: return 8;
+		default: return 64;
+	}
+}
+#pragma endregion
+
+
+////////////////////////////////
+// * PRIVATE WAVEFORM CACHE * //
+////////////////////////////////
+#pragma region Private Waveform Cache
+std::string AudioWizardWaveform::GetWaveformCacheKey(const TrackWaveform& track) const {
+	if (!track.handle.is_valid()) return {};
+
+	// Size and timestamp invalidate the entry when the file is replaced or retagged
+	const t_filestats stats = track.handle->get_filestats();
+	if (stats.m_size == filesize_invalid || stats.m_timestamp == filetimestamp_invalid) return {};
+
+	std::ostringstream oss;
+	oss << track.handle->get_path()
+		<< '|' << track.handle->get_subsong_index()
+		<< '|' << stats.m_size
+		<< '|' << stats.m_timestamp
+		<< '|' << state.pointsPerSecond.load(std::memory_order_relaxed)
+		<< '|' << (state.downmixToMono.load(std::memory_order_relaxed) ? 1 : 0)
+		<< '|' << GetWaveformEncodingBits(track.encoding)
+		<< '|' << Config::WAVEFORM_DATA_VERSION;
+
+	return oss.str();
+}
+
+void AudioWizardWaveform::StoreCachedWaveformTrack(const TrackWaveform& track) const {
+	if (!cache.IsEnabled() || track.isCached || track.samples.elements == 0) {
+		return;
+	}
+
+	const std::string key = GetWaveformCacheKey(track);
+	if (key.empty()) return;
+
+	AudioWizardWaveformCache::Entry entry;
+	entry.channels = track.channels;
+	entry.pointsPerSecond = static_cast<uint32_t>(state.pointsPerSecond.load(std::memory_order_relaxed));
+	entry.encodingBits = static_cast<uint32_t>(GetWaveformEncodingBits(track.encoding));
+	entry.duration = track.duration;
+	entry.peakScale = track.peakScale;
+	entry.maxAmplitude = track.maxAmplitude;
+
+	for (size_t level = 0; level <= track.pyramid.size(); ++level) {
+		const WaveformLevel& levelData = GetWaveformLevelData(track, level);
+		const void* data = track.encoding == WaveformEncoding::Int16 ? static_cast<const void*>(levelData.values16.data()) :
+			track.encoding == WaveformEncoding::Int8 ? static_cast<const void*>(levelData.values8.data()) :
+			static_cast<const void*>(levelData.values.data());
+
+		entry.levels.push_back({ data, levelData.elements });
+	}
+
+	cache.Store(key, entry);
+}
+
+void AudioWizardWaveform::ReadCachedWaveformTrack(TrackWaveform& track, const AudioWizardWaveformCache::FileHeader& header, const char* view) {
+	track.reset();
+	track.channels = header.channels;
+	track.peakScale = header.peakScale;
+	track.duration = header.duration;
+	track.lastSampleTime = header.duration;
+	track.maxAmplitude = header.maxAmplitude;
+	InitWaveformEncoding(track);
+	track.pyramid.resize(header.levelCount - 1);
+
+	// The cache validated the layout, so each level is copied straight out of the mapped view without parsing
+	for (size_t level = 0; level < header.levelCount; ++level) {
+		WaveformLevel& target = level == 0 ? track.samples : track.pyramid[level - 1];
+		const char* source = view + header.levelOffsets[level];
+		const auto elements = static_cast<size_t>(header.levelElements[level]);
+
+		switch (track.encoding) {
+			case WaveformEncoding::Int16:
+				target.values16.resize(elements);
+				std::memcpy(target.values16.data(), source, elements * sizeof(int16_t));
+				break;
+
+			case WaveformEncoding::Int8:
+				target.values8.resize(elements);
+				std::memcpy(target.values8.data(), source, elements * sizeof(int8_t));
+				break;
+
+			default:
+				target.values.resize(elements);
+				std::memcpy(target.values.data(), source, elements * sizeof(double));
+				break;
+		}
+
+		target.elements = elements;
+	}
+
+	track.isCached = true;
+}
+
+std::filesystem::path AudioWizardWaveform::GetWaveformCacheDirectory() {
+	const pfc::string8 profilePath = AWHPath::GetPhysicalFilePath(core_api::get_profile_path());
+	return std::filesystem::path(pfc::stringcvt::string_wide_from_utf8(profilePath).get_ptr()) / Config::CACHE_DIRECTORY;
 }
 #pragma endregion
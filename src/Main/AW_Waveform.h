@@ -25,6 +25,10 @@ public:
 		RMS, RMSPeak, SamplePeak, Waveform
 	};
 
+	enum class WaveformEncoding {
+		Float64, Int16, Int8
+	};
+
 	struct Config {
 		static constexpr int WAVEFORM_DATA_VERSION = 1; // NOTE: bump whenever WAVEFORM_CHUNK_ELEMENTS or WAVEFORM_METRIC_NAMES changes.
 		static constexpr size_t WAVEFORM_CHUNK_ELEMENTS = 5; // RMS, RMSPeak, SamplePeak, Min, Max
@@ -36,54 +40,190 @@ public:
 		static constexpr int MIN_POINTS_PER_SEC = 1;
 		static constexpr int MAX_POINTS_PER_SEC = 1000;
 		static constexpr size_t MAX_SAMPLES = 1000000;
+		static constexpr size_t MAX_PYRAMID_LEVELS = 20; // Level n holds 2^n base points per entry
 		static constexpr double NORMALIZATION_FACTOR = 1.0;
+		static constexpr WaveformEncoding DEFAULT_ENCODING = WaveformEncoding::Float64;
+		static constexpr std::array<double, WAVEFORM_CHUNK_ELEMENTS> INT8_STEPS = { 1.0, 1.0, 1.0, 1.0 / 127, 1.0 / 127 };
+		static constexpr std::array<double, WAVEFORM_CHUNK_ELEMENTS> INT16_STEPS = { 0.01, 0.01, 0.01, 1.0 / 32767, 1.0 / 32767 };
+		static constexpr std::wstring_view CACHE_DIRECTORY = L"audio_wizard_waveforms";
+		static constexpr LONG DEF_CACHE_LIMIT_MB = 256;
+		static constexpr LONG MIN_CACHE_LIMIT_MB = 1;
+		static constexpr LONG MAX_CACHE_LIMIT_MB = 65536;
+		static constexpr int DEF_STREAM_INTERVAL_MS = 250; // 0 disables progressive streaming
+		static constexpr int MIN_STREAM_INTERVAL_MS = 50;
+		static constexpr int MAX_STREAM_INTERVAL_MS = 10000;
 	};
+	static_assert(AudioWizardWaveformCache::Config::MAX_LEVELS == Config::MAX_PYRAMID_LEVELS + 1, "Cache files hold every pyramid level");
 
 	// * WAVEFORM STATE * //
+	struct WaveformLevel {
+		std::vector<double> values;    // WaveformEncoding::Float64
+		std::vector<int16_t> values16; // WaveformEncoding::Int16
+		std::vector<int8_t> values8;   // WaveformEncoding::Int8
+		size_t elements = 0;
+
+		void clear() {
+			values.clear();
+			values16.clear();
+			values8.clear();
+			elements = 0;
+		}
+	};
+
+	struct WaveformStream {
+		mutable std::mutex mutex;
+		std::vector<float> points; // Base points decoded so far, same layout as samples
+		unsigned channels = 0;
+		bool isClosed = false;     // Set once the track is published, reads then go to the track itself
+	};
+
+	struct WaveformRange {
+		size_t level = 0;      // Pyramid level, one point spans 2^level base points
+		size_t firstPoint = 0; // In points of that level
+		size_t numPoints = 0;
+	};
+
 	struct TrackWaveform {
-		std::vector<double> samples;
+		WaveformLevel samples;
+		std::vector<WaveformLevel> pyramid; // pyramid[n - 1] is level n, same layout as samples
 		std::vector<double> activeRMSPeaks;
+		std::vector<double> quantSteps;  // Per-element decode step for one point, channels * WAVEFORM_CHUNK_ELEMENTS
+		std::vector<double> pointScratch;
+		std::unique_ptr<WaveformStream> stream;
+		std::chrono::steady_clock::time_point lastStreamFlush;
+		size_t streamedElements = 0;
 		metadb_handle_ptr handle;
+		WaveformEncoding encoding = Config::DEFAULT_ENCODING;
 		unsigned channels = 0;
 		double duration = 0.0;
 		double lastSampleTime = 0.0;
 		double maxAmplitude = 0.0;
+		double peakScale = 1.0; // Full scale of min/max in compact encodings, from the ReplayGain track peak when known
+		bool isCached = false;  // Loaded from the on-disk waveform cache instead of decoded
+		AWHPerf::MemoryCharge memory{ AWHPerf::MemoryAccounting::CATEGORY_WAVEFORM }; // Refreshed by ProcessWaveformMemory
 
 		void reset() {
 			samples.clear();
+			pyramid.clear();
 			channels = 0;
+			isCached = false;
 			lastSampleTime = 0.0;
 			maxAmplitude = 0.0;
 		}
 	};
 
+	struct WaveformTable { // The tracks of one analysis run, replaced as a whole so readers never see the vectors resized
+		std::vector<TrackWaveform> trackWaveforms;     // Index-stable, each slot is written by one worker only
+		std::vector<std::atomic<bool>> trackPublished; // Set once a slot is final, readers skip slots still being written
+		std::atomic<size_t> publishedTracks = 0;
+
+		explicit WaveformTable(size_t trackCount) : trackWaveforms(trackCount), trackPublished(trackCount) {}
+
+		bool IsPublished(size_t trackIndex) const {
+			return trackIndex < trackPublished.size() && trackPublished[trackIndex].load(std::memory_order_acquire);
+		}
+	};
+	using WaveformTablePtr = std::shared_ptr<WaveformTable>;
+
 	struct State {
 		std::atomic<WaveformMetric> metric = Config::DEFAULT_METRIC;
 		std::atomic<bool> isAnalyzing = false;
 		std::atomic<bool> isAnalysisComplete = false;
 		std::atomic<bool> downmixToMono = false;
+		std::atomic<WaveformEncoding> encoding = Config::DEFAULT_ENCODING;
 		std::atomic<int> pointsPerSecond = Config::DEF_POINTS_PER_SEC;
-		std::atomic<size_t> currentTrackIndex = 0;
-		std::vector<TrackWaveform> trackWaveforms;
+		std::atomic<int> streamIntervalMs = Config::DEF_STREAM_INTERVAL_MS;
+		mutable std::mutex tableMutex; // Guards the two pointers only, never held while a table is read or written
+		WaveformTablePtr table = std::make_shared<WaveformTable>(0);       // Read by the API, replaced on start and when a job prepares
+		WaveformTablePtr activeTable = std::make_shared<WaveformTable>(0); // Written by the workers of the running job
 	}; State state;
 
+	// * WAVEFORM CACHE * //
+	AudioWizardWaveformCache cache;
+
 	AudioWizardWaveform();
 	~AudioWizardWaveform();
 
 	// * PUBLIC MAIN METHODS * //
-	void StartWaveformAnalysis(const metadb_handle_list& tracks, int pointsPerSecond, bool downmixToMono = false);
+	uint32_t StartWaveformAnalysis(const metadb_handle_list& tracks, int pointsPerSecond, bool downmixToMono = false,
+		WaveformEncoding encoding = Config::DEFAULT_ENCODING, int priority = AudioWizardJobs::Config::DEF_PRIORITY
+	);
+	uint32_t StartCombinedAnalysis(const metadb_handle_list& tracks, int pointsPerSecond, bool downmixToMono,
+		WaveformEncoding encoding, int metricsChunkDurationMs, int priority = AudioWizardJobs::Config::DEF_PRIORITY
+	);
 	void StopWaveformAnalysis();
+	void CompleteWaveformAnalysis();
 
 	// * PUBLIC API METHODS * //
 	bool IsWaveformAnalysisComplete(double trackDurationSec) const;
-	void GetWaveformData(size_t trackIndex, SAFEARRAY** data) const;
+	void GetWaveformData(size_t trackIndex, SAFEARRAY** data, double startSec = 0.0, double endSec = 0.0, size_t pixelWidth = 0) const;
+	void GetWaveformDataFlat(size_t trackIndex, SAFEARRAY** data, double startSec = 0.0, double endSec = 0.0, size_t pixelWidth = 0,
+		bool doublePrecision = false
+	) const;
 	void GetWaveformDataInfo(size_t trackIndex, bool hasTrackIndex, pfc::string8& json) const;
+	void GetWaveformStream(size_t trackIndex, size_t cursor, size_t level, SAFEARRAY** data) const;
+	void SetWaveformStreamInterval(int intervalMs);
 	unsigned GetWaveformTrackChannels(size_t trackIndex) const;
 	size_t GetWaveformTrackCount() const;
 	void GetWaveformTrackInfo(size_t trackIndex, pfc::string8& path, double& duration) const;
+	bool IsWaveformTrackPublished(size_t trackIndex) const;
+	bool IsActiveWaveformTrackPublished(size_t trackIndex) const;
 	void SetWaveformMetric(WaveformMetric metric);
 
+	// * PUBLIC WAVEFORM CACHE * //
+	void SetWaveformCache(bool enabled, LONG limitMB);
+	void ClearWaveformCache() const;
+	bool LoadCachedWaveformTrack(size_t trackIndex);
+
 	// * PUBLIC WAVEFORM METRICS PROCESSING * //
-	void ProcessWaveformMetrics(const ChunkData& data);
+	void ProcessWaveformMetrics(const ChunkData& data, size_t trackIndex);
+	void FinalizeWaveformTrack(size_t trackIndex);
+
+private:
+	// * PRIVATE WAVEFORM PREPARATION * //
+	std::function<int(bool)> CreateWaveformPreparation(const metadb_handle_list& tracks, int pointsPerSecond, bool downmixToMono,
+		WaveformEncoding encoding
+	);
+	int PrepareWaveformAnalysis(const metadb_handle_list& tracks, int pointsPerSecond, bool downmixToMono, WaveformEncoding encoding);
+	int ResumeWaveformAnalysis(const WaveformTablePtr& table);
+	static WaveformTablePtr CreateWaveformTable(const metadb_handle_list& tracks, WaveformEncoding encoding);
+
+	// * PRIVATE WAVEFORM PUBLISHING * //
+	WaveformTablePtr GetWaveformTable() const;
+	WaveformTablePtr GetActiveWaveformTable() const;
+	void PublishWaveformTable(const WaveformTablePtr& table, bool isActive);
+	void PublishWaveformTrack(WaveformTable& table, size_t trackIndex);
+	void FlushWaveformStream(TrackWaveform& track, size_t trackIndex) const;
+	static void ProcessWaveformMemory(TrackWaveform& track);
+	static SAFEARRAY* CreateWaveformChannelArrays(const double* values, size_t numPoints, unsigned channels, const char* context);
+	static SAFEARRAY* CreateWaveformFlatArray(const TrackWaveform& track, const WaveformRange& range, bool doublePrecision);
+
+	// * PRIVATE WAVEFORM CACHE * //
+	std::string GetWaveformCacheKey(const TrackWaveform& track) const;
+	void StoreCachedWaveformTrack(const TrackWaveform& track) const;
+	static void ReadCachedWaveformTrack(TrackWaveform& track, const AudioWizardWaveformCache::FileHeader& header, const char* view);
+	static std::filesystem::path GetWaveformCacheDirectory();
+
+	// * PRIVATE WAVEFORM PYRAMID * //
+	static void ProcessWaveformPyramid(TrackWaveform& track, bool isFinal = false);
+	static void MergeWaveformPoints(const double* first, const double* second, double* out, unsigned channels);
+	static void MergeWaveformLevels(std::vector<double>& values, unsigned channels, size_t levels, bool keepRemainder);
+	static size_t GetWaveformLevel(const TrackWaveform& track, double basePointsPerPixel);
+	WaveformRange GetWaveformRange(const TrackWaveform& track, double startSec, double endSec, size_t pixelWidth) const;
+	static const WaveformLevel& GetWaveformLevelData(const TrackWaveform& track, size_t level);
+
+	// * PRIVATE WAVEFORM ENCODING * //
+	static void InitWaveformEncoding(TrackWaveform& track);
+	static void AppendWaveformPoints(const TrackWaveform& track, WaveformLevel& level, const double* values, size_t count);
+	static const double* ReadWaveformPoints(const TrackWaveform& track, const WaveformLevel& level,
+		size_t firstPoint, size_t numPoints, std::vector<double>& scratch
+	);
+	template <typename Out>
+	static void CopyWaveformPoints(const TrackWaveform& track, const WaveformLevel& level, size_t firstPoint, size_t numPoints, Out* out);
+	template <typename T>
+	static void EncodeQuantized(const double* values, size_t count, const double* steps, size_t step, std::vector<T>& out);
+	template <typename T, typename Out>
+	static void DecodeQuantized(const T* values, size_t numPoints, const double* steps, size_t step, Out* out);
+	static size_t GetWaveformEncodingBits(WaveformEncoding encoding);
 };
 #pragma endregion
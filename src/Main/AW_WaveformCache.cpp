@@ -0,0 +1,279 @@
+/////////////////////////////////////////////////////////////////////////////////
+// * FB2K Component: Audio Wizard                                            * //
+// * Description:  Audio Wizard Waveform Cache Source File           * //
+// * Author:     TT                           * //
+// * Website:    https://github.com/The-Wizardium/Audio-Wizard        * //
+// * Version:    0.6.0                            * //
+// * Dev. started:  19-10-2026                       * //
+// * Last change:  19-10-2026                       * //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#include "AW_PCH.h"
+#include "AW_Helpers.h"
+#include "AW_WaveformCache.h"
+
+
+//////////////////////////////////
+// * CONSTRUCTOR & DESTRUCTOR * //
+//////////////////////////////////
+#pragma region Constructor & Destructor
+AudioWizardWaveformCache::AudioWizardWaveformCache(std::filesystem::path directory, uint64_t limitBytes) :
+	directory(std::move(directory)), limitBytes(limitBytes) {
+}
+#pragma endregion
+
+
+////////////////////////
+// * PUBLIC METHODS * //
+////////////////////////
+#pragma region Public Methods
+void AudioWizardWaveformCache::SetCache(bool enabled, uint64_t limit) {
+	limitBytes.store(limit, std::memory_order_relaxed);
+	isEnabled.store(enabled, std::memory_order_release);
+
+	// A lowered limit takes effect right away instead of on the next store
+	if (enabled) {
+		std::scoped_lock lock(mutex);
+		Evict(limit);
+	}
+}
+
+void AudioWizardWaveformCache::Clear() const {
+	std::scoped_lock lock(mutex);
+	Evict(0);
+}
+
+bool AudioWizardWaveformCache::Store(const std::string& key, const Entry& entry) const {
+	const size_t levelCount = entry.levels.size();
+	if (key.empty() || levelCount == 0 || levelCount > Config::MAX_LEVELS || entry.encodingBits % 8 != 0) {
+		return false;
+	}
+
+	const auto align = [](uint64_t offset) { return (offset + Config::CACHE_ALIGNMENT - 1) & ~(Config::CACHE_ALIGNMENT - 1); };
+	const size_t elementBytes = entry.encodingBits / 8;
+
+	FileHeader header = {};
+	header.magic = Config::CACHE_MAGIC;
+	header.version = Config::CACHE_FORMAT_VERSION;
+	header.headerSize = sizeof(FileHeader);
+	header.keyLength = static_cast<uint32_t>(key.size());
+	header.channels = entry.channels;
+	header.pointsPerSecond = entry.pointsPerSecond;
+	header.encodingBits = entry.encodingBits;
+	header.levelCount = static_cast<uint32_t>(levelCount);
+	header.duration = entry.duration;
+	header.peakScale = entry.peakScale;
+	header.maxAmplitude = entry.maxAmplitude;
+
+	uint64_t fileSize = align(sizeof(FileHeader) + key.size());
+	for (size_t level = 0; level < levelCount; ++level) {
+		header.levelOffsets[level] = fileSize;
+		header.levelElements[level] = entry.levels[level].elements;
+		fileSize = align(fileSize + header.levelElements[level] * elementBytes);
+	}
+
+	// The whole file is assembled in memory so it is written in one call
+	std::vector<char> buffer(fileSize, 0);
+	std::memcpy(buffer.data(), &header, sizeof(FileHeader));
+	std::memcpy(buffer.data() + sizeof(FileHeader), key.data(), key.size());
+
+	for (size_t level = 0; level < levelCount; ++level) {
+		const size_t bytes = header.levelElements[level] * elementBytes;
+		if (bytes > 0) {
+			std::memcpy(buffer.data() + header.levelOffsets[level], entry.levels[level].data, bytes);
+		}
+	}
+
+	std::scoped_lock lock(mutex);
+	std::error_code ec;
+	const std::filesystem::path filePath = GetFilePath(key);
+	std::filesystem::create_directories(directory, ec);
+
+	// Written to a temporary file first, so a reader never maps a partially written entry
+	std::filesystem::path tempPath = filePath;
+	tempPath += L".tmp";
+	{
+		std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+		file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+		if (!file) {
+			FB2K_console_formatter() << "Audio Wizard => AudioWizardWaveformCache: Failed to write " << GetDisplayPath(tempPath).c_str();
+			file.close();
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+	}
+
+	std::filesystem::rename(tempPath, filePath, ec);
+	if (ec) {
+		FB2K_console_formatter() << "Audio Wizard => AudioWizardWaveformCache: Failed to replace " << GetDisplayPath(filePath).c_str();
+		std::filesystem::remove(tempPath, ec);
+		return false;
+	}
+
+	Evict(limitBytes.load(std::memory_order_relaxed), filePath);
+
+	AWHDebug::DebugLog("AudioWizardWaveformCache: Stored ", levelCount, " levels, ", fileSize, " bytes");
+	return true;
+}
+
+bool AudioWizardWaveformCache::Load(const std::string& key, uint32_t encodingBits, size_t valuesPerChannel, const Reader& reader) const {
+	if (key.empty()) return false;
+
+	std::scoped_lock lock(mutex);
+	const std::filesystem::path filePath = GetFilePath(key);
+	bool isLoaded = false;
+
+#ifdef _WIN32
+	const HANDLE file = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) return false;
+
+	LARGE_INTEGER fileSize = {};
+	const bool hasHeader = GetFileSizeEx(file, &fileSize) && fileSize.QuadPart >= static_cast<LONGLONG>(sizeof(FileHeader));
+	const HANDLE mapping = hasHeader ? CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+	const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+	const auto viewSize = static_cast<uint64_t>(fileSize.QuadPart);
+
+	if (view && IsValidFile(static_cast<const char*>(view), viewSize, key, encodingBits, valuesPerChannel)) {
+		FileHeader header;
+		std::memcpy(&header, view, sizeof(FileHeader));
+		reader(header, static_cast<const char*>(view));
+		isLoaded = true;
+	}
+
+	if (view) UnmapViewOfFile(view);
+	if (mapping) CloseHandle(mapping);
+	CloseHandle(file);
+#else
+	const int file = open(filePath.c_str(), O_RDONLY);
+	if (file < 0) return false;
+
+	struct stat fileStat = {};
+	const bool hasHeader = fstat(file, &fileStat) == 0 && static_cast<uint64_t>(fileStat.st_size) >= sizeof(FileHeader);
+	const auto viewSize = static_cast<uint64_t>(fileStat.st_size);
+	void* view = hasHeader ? mmap(nullptr, static_cast<size_t>(viewSize), PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+
+	if (view != MAP_FAILED && IsValidFile(static_cast<const char*>(view), viewSize, key, encodingBits, valuesPerChannel)) {
+		FileHeader header;
+		std::memcpy(&header, view, sizeof(FileHeader));
+		reader(header, static_cast<const char*>(view));
+		isLoaded = true;
+	}
+
+	if (view != MAP_FAILED) munmap(view, static_cast<size_t>(viewSize));
+	close(file);
+#endif
+
+	// A hit refreshes the last write time the LRU eviction sorts on
+	if (isLoaded) {
+		std::error_code ec;
+		std::filesystem::last_write_time(filePath, std::filesystem::file_time_type::clock::now(), ec);
+	}
+
+	return isLoaded;
+}
+
+std::filesystem::path AudioWizardWaveformCache::GetFilePath(const std::string& key) const {
+	// 64-bit FNV-1a of the key, stable across builds unlike std::hash, the full key in the file resolves collisions
+	uint64_t hash = 14695981039346656037ull;
+	for (const unsigned char c : key) {
+		hash = (hash ^ c) * 1099511628211ull;
+	}
+
+	std::wostringstream name;
+	name << std::hex << std::setw(16) << std::setfill(L'0') << hash << Config::CACHE_EXTENSION;
+	return directory / name.str();
+}
+
+bool AudioWizardWaveformCache::IsValidFile(const char* view, uint64_t viewSize, const std::string& key,
+	uint32_t encodingBits, size_t valuesPerChannel) {
+	if (!view || viewSize < sizeof(FileHeader) || encodingBits == 0 || encodingBits % 8 != 0) return false;
+
+	FileHeader header;
+	std::memcpy(&header, view, sizeof(FileHeader));
+
+	const bool isValidHeader = header.magic == Config::CACHE_MAGIC
+		&& header.version == Config::CACHE_FORMAT_VERSION
+		&& header.headerSize == sizeof(FileHeader)
+		&& header.encodingBits == encodingBits
+		&& header.channels > 0
+		&& header.levelCount > 0 && header.levelCount <= Config::MAX_LEVELS
+		&& header.keyLength == key.size() && sizeof(FileHeader) + key.size() <= viewSize
+		&& std::memcmp(view + sizeof(FileHeader), key.data(), key.size()) == 0;
+
+	if (!isValidHeader) return false;
+
+	const uint64_t step = static_cast<uint64_t>(header.channels) * valuesPerChannel;
+	const uint64_t elementBytes = encodingBits / 8;
+
+	// Every level must hold whole points and lie inside the file, so the reader can copy without checks
+	for (size_t level = 0; level < header.levelCount; ++level) {
+		const uint64_t offset = header.levelOffsets[level];
+		const uint64_t elements = header.levelElements[level];
+
+		if (elements % step != 0 || offset % Config::CACHE_ALIGNMENT != 0 || offset > viewSize
+			|| elements > (viewSize - offset) / elementBytes) {
+			return false;
+		}
+	}
+
+	return true;
+}
+#pragma endregion
+
+
+/////////////////////////
+// * PRIVATE METHODS * //
+/////////////////////////
+#pragma region Private Methods
+void AudioWizardWaveformCache::Evict(uint64_t limit, const std::filesystem::path& keepPath) const {
+	struct CacheEntry {
+		std::filesystem::file_time_type lastWrite;
+		uint64_t size;
+		std::filesystem::path path;
+	};
+
+	std::vector<CacheEntry> entries;
+	uint64_t totalBytes = 0;
+	std::error_code ec;
+	std::error_code entryEc;
+
+	for (auto it = std::filesystem::directory_iterator(directory, ec);
+		!ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+		if (!it->is_regular_file(entryEc) || it->path().extension() != Config::CACHE_EXTENSION) continue;
+
+		const uint64_t size = it->file_size(entryEc);
+		const auto lastWrite = it->last_write_time(entryEc);
+		if (entryEc) continue;
+
+		entries.push_back({ lastWrite, size, it->path() });
+		totalBytes += size;
+	}
+
+	if (totalBytes <= limit) return;
+
+	// Least recently used first, cache hits refresh the last write time
+	std::sort(entries.begin(), entries.end(), [](const CacheEntry& a, const CacheEntry& b) {
+		return a.lastWrite < b.lastWrite;
+	});
+
+	size_t removed = 0;
+	for (const auto& entry : entries) {
+		if (totalBytes <= limit) break;
+		if (entry.path == keepPath) continue;
+
+		if (std::filesystem::remove(entry.path, entryEc)) {
+			totalBytes -= entry.size;
+			++removed;
+		}
+	}
+
+	AWHDebug::DebugLog("AudioWizardWaveformCache: Evicted ", removed, " entries, ", totalBytes, " bytes remaining");
+}
+
+std::string AudioWizardWaveformCache::GetDisplayPath(const std::filesystem::path& path) {
+	const std::u8string utf8 = path.u8string();
+	return std::string(utf8.begin(), utf8.end());
+}
+#pragma endregion
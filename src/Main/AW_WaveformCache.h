@@ -0,0 +1,87 @@
+/////////////////////////////////////////////////////////////////////////////////
+// * FB2K Component: Audio Wizard                                            * //
+// * Description:  Audio Wizard Waveform Cache Header File           * //
+// * Author:     TT                           * //
+// * Website:    https://github.com/The-Wizardium/Audio-Wizard        * //
+// * Version:    0.6.0                            * //
+// * Dev. started:  19-10-2026                       * //
+// * Last change:  19-10-2026                       * //
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+
+////////////////////////
+// * WAVEFORM CACHE * //
+////////////////////////
+#pragma region Waveform Cache
+// On-disk cache of finished waveforms, one file per track. The file is a fixed header, the key and the
+// level payloads at CACHE_ALIGNMENT offsets, mapped and handed to the caller without parsing. It knows
+// nothing about tracks or the SDK, so the format, validation and eviction are covered by aw_tests.
+class AudioWizardWaveformCache {
+public:
+	struct Config {
+		static constexpr uint32_t CACHE_FORMAT_VERSION = 1; // NOTE: bump whenever FileHeader changes.
+		static constexpr std::array<char, 4> CACHE_MAGIC = { 'A', 'W', 'W', 'F' };
+		static constexpr std::wstring_view CACHE_EXTENSION = L".awwf";
+		static constexpr uint64_t CACHE_ALIGNMENT = 8;
+		static constexpr size_t MAX_LEVELS = 21; // Base level plus AudioWizardWaveform::Config::MAX_PYRAMID_LEVELS
+	};
+
+	struct FileHeader { // Fixed layout, followed by the key and the level payloads
+		std::array<char, 4> magic;
+		uint32_t version;
+		uint32_t headerSize;
+		uint32_t keyLength;
+		uint32_t channels;
+		uint32_t pointsPerSecond;
+		uint32_t encodingBits;
+		uint32_t levelCount;
+		double duration;
+		double peakScale;
+		double maxAmplitude;
+		std::array<uint64_t, Config::MAX_LEVELS> levelOffsets; // Bytes from the start of the file
+		std::array<uint64_t, Config::MAX_LEVELS> levelElements;
+	};
+
+	struct Level {
+		const void* data = nullptr;
+		uint64_t elements = 0;
+	};
+
+	struct Entry { // Everything stored for one track, levels[0] is the base level
+		uint32_t channels = 0;
+		uint32_t pointsPerSecond = 0;
+		uint32_t encodingBits = 0;
+		double duration = 0.0;
+		double peakScale = 1.0;
+		double maxAmplitude = 0.0;
+		std::vector<Level> levels;
+	};
+
+	// Called with a validated header and the mapped file, level n starts at view + header.levelOffsets[n]
+	using Reader = std::function<void(const FileHeader& header, const char* view)>;
+
+	AudioWizardWaveformCache(std::filesystem::path directory, uint64_t limitBytes);
+
+	// * PUBLIC METHODS * //
+	void SetCache(bool enabled, uint64_t limit);
+	bool IsEnabled() const { return isEnabled.load(std::memory_order_acquire); }
+	void Clear() const;
+	bool Store(const std::string& key, const Entry& entry) const;
+	bool Load(const std::string& key, uint32_t encodingBits, size_t valuesPerChannel, const Reader& reader) const;
+	std::filesystem::path GetFilePath(const std::string& key) const;
+	static bool IsValidFile(const char* view, uint64_t viewSize, const std::string& key, uint32_t encodingBits, size_t valuesPerChannel);
+
+private:
+	std::filesystem::path directory;
+	std::atomic<bool> isEnabled = false;
+	std::atomic<uint64_t> limitBytes = 0;
+	mutable std::mutex mutex; // Serializes file access, stores and evictions never overlap a load
+
+	// * PRIVATE METHODS * //
+	void Evict(uint64_t limit, const std::filesystem::path& keepPath = {}) const;
+	static std::string GetDisplayPath(const std::filesystem::path& path);
+};
+#pragma endregion